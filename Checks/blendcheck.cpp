@@ -0,0 +1,114 @@
+#include "../Graphics/Image.h"
+#include <chrono>
+#include <vector>
+
+//Checks Image::BlendRow against the scalar fixed point blend bit for bit, and that blending onto an opaque image
+//leaves it opaque, then times it against the float lerp ColorBetween used to be
+//	blendcheck
+
+//The float path from before 8.8 blending, colors only, the result is opaque
+static uint32_t ColorBetween_float(uint32_t one, uint32_t two, float a){
+	const float r = (Image::Red_f(two) * a) + (Image::Red_f(one) * (1.0f - a));
+	const float g = (Image::Green_f(two) * a) + (Image::Green_f(one) * (1.0f - a));
+	const float b = (Image::Blue_f(two) * a) + (Image::Blue_f(one) * (1.0f - a));
+	return Image::Color_f(r, g, b);
+}
+
+//Blends dest through BlendRow and the scalar path and counts the pixels that differ
+static size_t Compare(std::vector<uint32_t> & dest, const std::vector<uint32_t> & source, uint32_t weight){
+	std::vector<uint32_t> expected(dest);
+	for(size_t i = 0; i < dest.size(); ++i){
+		expected[i] = Image::ColorBetween_fixed(expected[i], source[i], Image::BlendWeight(weight, Image::Alpha(source[i])));
+	}
+	Image::BlendRow(dest.data(), source.data(), static_cast<int>(dest.size()), weight);
+	size_t wrong = 0;
+	for(size_t i = 0; i < dest.size(); ++i){
+		if (dest[i] != expected[i]) ++wrong;
+	}
+	return wrong;
+}
+
+int main(){
+	size_t wrong = 0;
+	std::vector<uint32_t> source(256), dest(256);
+
+	//Every weight with every source alpha, the channels sweep their whole range along the row
+	for(uint32_t weight = 0; weight <= 256; ++weight){
+		for(uint32_t alpha = 0; alpha < 256; ++alpha){
+			for(uint32_t i = 0; i < 256; ++i){
+				source[i] = Image::Color(i, 255 - i, (i * 7) & 255, alpha);
+				dest[i] = Image::Color((i * 13) & 255, i ^ 0x55, 255 - i, (i * 29) & 255);
+			}
+			wrong += Compare(dest, source, weight);
+		}
+	}
+
+	//Every pair of channel values at every weight an opaque source passes through unchanged
+	for(uint32_t weight = 0; weight <= 256; ++weight){
+		for(uint32_t s = 0; s < 256; ++s){
+			for(uint32_t d = 0; d < 256; ++d){
+				source[d] = Image::Color(s, 255 - s, s ^ 0xAA, 255);
+				dest[d] = Image::Color(d, 255 - d, d ^ 0x33, d);
+			}
+			wrong += Compare(dest, source, weight);
+		}
+	}
+	std::cout << "BlendRow against ColorBetween_fixed: " << wrong << " pixels differ" << std::endl;
+
+	//Anything blended onto an opaque image leaves it opaque, whatever the source alpha and weight
+	size_t holes = 0;
+	for(uint32_t weight = 0; weight <= 256; ++weight){
+		for(uint32_t alpha = 0; alpha < 256; ++alpha){
+			for(uint32_t i = 0; i < 256; ++i){
+				source[i] = Image::Color(i, 255 - i, i ^ 0x0F, alpha);
+				dest[i] = Image::Color(255 - i, i, i ^ 0xF0, 255);
+			}
+			Image::BlendRow(dest.data(), source.data(), static_cast<int>(dest.size()), weight);
+			for(uint32_t pixel : dest){
+				if (Image::Alpha(pixel) != 255) ++holes;
+			}
+		}
+	}
+	Image white(8, 1, Image::Color(255, 255, 255));
+	white.pset_blend(0, 0, Image::Color(255, 0, 0, 128));
+	white.put_blend(Image(7, 1, Image::Color(255, 0, 0, 128)), 1, 0);
+	for(int x = 0; x < white.width(); ++x){
+		if (Image::Alpha(white.point(x, 0)) != 255) ++holes;
+	}
+	if (Image::Alpha(Image::ColorBetween(Image::Color(255, 255, 255), Image::Color(255, 0, 0, 0), 0.5f)) != 255) ++holes;
+	std::cout << "Opaque pixels left translucent: " << holes << std::endl;
+
+	//Timing over 1M pixel rows
+	const size_t count = 1 << 20;
+	const int runs = 50;
+	std::vector<uint32_t> row(count), over(count);
+	uint32_t seed = 1;
+	for(size_t i = 0; i < count; ++i){
+		seed = seed * 1103515245u + 12345u;
+		row[i] = seed;
+		seed = seed * 1103515245u + 12345u;
+		over[i] = seed;
+	}
+	std::vector<uint32_t> work(row);
+	auto start = std::chrono::steady_clock::now();
+	for(int run = 0; run < runs; ++run){
+		for(size_t i = 0; i < count; ++i) work[i] = ColorBetween_float(work[i], over[i], 0.4f * Image::Alpha_f(over[i]));
+	}
+	const double floatMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / runs;
+
+	work = row;
+	start = std::chrono::steady_clock::now();
+	for(int run = 0; run < runs; ++run){
+		const uint32_t weight = Image::BlendWeight(0.4f);
+		for(size_t i = 0; i < count; ++i) work[i] = Image::ColorBetween_fixed(work[i], over[i], Image::BlendWeight(weight, Image::Alpha(over[i])));
+	}
+	const double fixedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / runs;
+
+	work = row;
+	start = std::chrono::steady_clock::now();
+	for(int run = 0; run < runs; ++run) Image::BlendRow(work.data(), over.data(), static_cast<int>(count), Image::BlendWeight(0.4f));
+	const double rowMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / runs;
+
+	std::cout << "1M pixels: float " << floatMs << " ms, scalar fixed " << fixedMs << " ms, BlendRow " << rowMs << " ms (" << work[count / 2] << ")" << std::endl;
+	return wrong == 0 && holes == 0 ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+#include "../Graphics/lodepng.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+//Checks lodepng_decode_into against lodepng_decode for PNGs whose header color type matches the one asked for, but
+//whose tRNS or PLTE, read after the header, makes the modes differ.  Those used to free the caller's buffer.  Best
+//built with -fsanitize=address
+//	decodecheck
+
+struct Case {
+	const char * name;
+	LodePNGColorType colortype;
+	unsigned bitdepth;
+	bool key;
+};
+
+static bool Check(const Case & c){
+	const unsigned w = 16, h = 8;
+	lodepng::State encode;
+	encode.encoder.auto_convert = 0;
+	encode.info_raw.colortype = encode.info_png.color.colortype = c.colortype;
+	encode.info_raw.bitdepth = encode.info_png.color.bitdepth = c.bitdepth;
+	if (c.colortype == LCT_PALETTE){
+		for(unsigned i = 0; i < (1u << c.bitdepth); ++i){
+			lodepng_palette_add(&encode.info_png.color, i * 17, 255 - i * 17, i * 5, i == 0 ? 0 : 255);
+			lodepng_palette_add(&encode.info_raw, i * 17, 255 - i * 17, i * 5, i == 0 ? 0 : 255);
+		}
+	}
+	if (c.key){
+		encode.info_png.color.key_defined = encode.info_raw.key_defined = 1;
+		encode.info_png.color.key_r = encode.info_raw.key_r = 3;
+		encode.info_png.color.key_g = encode.info_raw.key_g = 3;
+		encode.info_png.color.key_b = encode.info_raw.key_b = 3;
+	}
+	std::vector<unsigned char> pixels(lodepng_get_raw_size(w, h, &encode.info_raw));
+	for(size_t i = 0; i < pixels.size(); ++i) pixels[i] = static_cast<unsigned char>((i * 7) % (c.colortype == LCT_PALETTE ? 256 : 5));
+	std::vector<unsigned char> png;
+	if (lodepng::encode(png, pixels, w, h, encode)){
+		std::cerr << c.name << ": couldn't encode" << std::endl;
+		return false;
+	}
+
+	//Both ask for the color type in the header, without the key or palette
+	LodePNGColorMode asked = lodepng_color_mode_make(c.colortype, c.bitdepth);
+	lodepng::State whole, into;
+	lodepng_color_mode_copy(&whole.info_raw, &asked);
+	lodepng_color_mode_copy(&into.info_raw, &asked);
+	unsigned char * expected = nullptr;
+	unsigned ew = 0, eh = 0, iw = 0, ih = 0;
+	const unsigned error = lodepng_decode(&expected, &ew, &eh, &whole, png.data(), png.size());
+	const size_t size = lodepng_get_raw_size(w, h, &asked);
+	std::vector<unsigned char> out(size + 1, 0xCD);
+	const unsigned errorInto = lodepng_decode_into(out.data(), size, &iw, &ih, &into, png.data(), png.size());
+	//Both fail alike where lodepng can't convert to the mode, 56 for the bit packed ones
+	bool same = error == errorInto && out[size] == 0xCD;
+	if (same && !error) same = iw == w && ih == h && memcmp(expected, out.data(), size) == 0 && memcmp(expected, pixels.data(), size) == 0;
+	free(expected);
+	lodepng_color_mode_cleanup(&asked);
+	std::cout << c.name << ": " << (same ? "ok" : "differs") << ", errors " << error << " and " << errorInto << std::endl;
+	return same;
+}
+
+int main(){
+	const Case cases[] = {
+		{"RGB8 with a key", LCT_RGB, 8, true},
+		{"RGB16 with a key", LCT_RGB, 16, true},
+		{"GREY8 with a key", LCT_GREY, 8, true},
+		{"GREY2 with a key", LCT_GREY, 2, true},
+		{"8 bit palette to palette", LCT_PALETTE, 8, false},
+		{"4 bit palette to palette", LCT_PALETTE, 4, false},
+		{"RGB8", LCT_RGB, 8, false}
+	};
+	bool ok = true;
+	for(const Case & c : cases) ok = Check(c) && ok;
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+#include "../Graphics/lodepng.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+//Times lodepng's inflate over a few kinds of zlib stream.  Build it twice, once with -DLODEPNG_NO_FAST_INFLATE, to
+//compare the table driven fast path with the regular one, check.sh does both
+//	inflatebench [file ...]
+//Files given are compressed and timed as well
+
+struct Stream {
+	std::string name;
+	std::vector<unsigned char> zlib;
+	std::vector<unsigned char> data;
+};
+
+//Words picked by an LCG, so every build times the same text
+static std::vector<unsigned char> Text(size_t size){
+	static const char * words[] = {"the", "arch", "stone", "corbel", "of", "and", "a", "weight", "to", "in", "line", "is", "that", "curve", "block", "with", "thrust", "on", "each", "catenary"};
+	std::vector<unsigned char> text;
+	uint32_t seed = 7;
+	while(text.size() < size){
+		seed = seed * 1103515245u + 12345u;
+		const std::string word = words[(seed >> 16) % 20];
+		text.insert(text.end(), word.begin(), word.end());
+		text.push_back((seed >> 8) % 11 == 0 ? '\n' : ' ');
+	}
+	text.resize(size);
+	return text;
+}
+
+//Runs of random bytes repeated a random number of times
+static std::vector<unsigned char> Runs(size_t size){
+	std::vector<unsigned char> data;
+	uint32_t seed = 3;
+	while(data.size() < size){
+		seed = seed * 1103515245u + 12345u;
+		const size_t length = 1 + (seed >> 24) % 40;
+		const size_t repeats = 1 + (seed >> 8) % 6;
+		std::vector<unsigned char> run;
+		for(size_t i = 0; i < length; ++i){
+			seed = seed * 1103515245u + 12345u;
+			run.push_back(static_cast<unsigned char>(seed >> 24));
+		}
+		for(size_t r = 0; r < repeats; ++r) data.insert(data.end(), run.begin(), run.end());
+	}
+	data.resize(size);
+	return data;
+}
+
+static bool Add(std::vector<Stream> & streams, const std::string & name, const std::vector<unsigned char> & data, unsigned btype, unsigned lz77, unsigned window){
+	LodePNGCompressSettings settings;
+	lodepng_compress_settings_init(&settings);
+	settings.btype = btype;
+	settings.use_lz77 = lz77;
+	settings.windowsize = window;
+	unsigned char * out = nullptr;
+	size_t outsize = 0;
+	const unsigned error = lodepng_zlib_compress(&out, &outsize, data.data(), data.size(), &settings);
+	if (error){
+		std::cerr << name << ": " << lodepng_error_text(error) << std::endl;
+		return false;
+	}
+	streams.push_back({name, std::vector<unsigned char>(out, out + outsize), data});
+	free(out);
+	return true;
+}
+
+int main(int argc, char ** argv){
+	const size_t size = 8 << 20;
+	const std::vector<unsigned char> text = Text(size);
+	std::vector<Stream> streams;
+	bool ok = Add(streams, "text, dynamic trees", text, 2, 1, 32768);
+	ok = ok && Add(streams, "text, fixed trees", text, 1, 1, 32768);
+	ok = ok && Add(streams, "text, huffman only", text, 2, 0, 2048);
+	ok = ok && Add(streams, "mixed runs", Runs(size), 2, 1, 32768);
+	ok = ok && Add(streams, "zeros", std::vector<unsigned char>(size, 0), 2, 1, 32768);
+	for(int i = 1; i < argc && ok; ++i){
+		std::vector<unsigned char> file;
+		if (lodepng::load_file(file, argv[i]) || file.empty()){
+			std::cerr << "Couldn't load " << argv[i] << std::endl;
+			return 1;
+		}
+		ok = Add(streams, argv[i], file, 2, 1, 32768);
+	}
+	if (!ok) return 1;
+
+#ifdef LODEPNG_NO_FAST_INFLATE
+	std::cout << "regular inflate, MB/s of output, best of 20" << std::endl;
+#else
+	std::cout << "fast inflate, MB/s of output, best of 20" << std::endl;
+#endif
+	LodePNGDecompressSettings settings;
+	lodepng_decompress_settings_init(&settings);
+	for(const Stream & stream : streams){
+		double best = 0;
+		for(int run = 0; run < 20; ++run){
+			unsigned char * out = nullptr;
+			size_t outsize = 0;
+			const auto start = std::chrono::steady_clock::now();
+			const unsigned error = lodepng_zlib_decompress(&out, &outsize, stream.zlib.data(), stream.zlib.size(), &settings);
+			const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			const bool same = !error && outsize == stream.data.size() && memcmp(out, stream.data.data(), outsize) == 0;
+			free(out);
+			if (!same){
+				std::cerr << stream.name << ": decoding failed" << std::endl;
+				return 1;
+			}
+			best = std::max(best, static_cast<double>(outsize) / seconds / 1e6);
+		}
+		std::cout << "  " << stream.name << ": " << static_cast<int>(best) << std::endl;
+	}
+	return 0;
+}
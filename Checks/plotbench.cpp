@@ -0,0 +1,61 @@
+#define STRESSCALC_NO_MAIN
+#include "../stresscalc.cpp"
+#include <chrono>
+
+//Times plot, the chain of line segments stresscalc searches, against plotSmooth, the anti-aliased curve it draws on
+//the report, over the corbels of an arch the size of a report's
+//	plotbench
+
+//Corbels stepping in toward the middle on both sides, like the markers getAllArches finds
+static std::vector<std::pair<int, int> > Corbels(int mid, int bottom){
+	std::vector<std::pair<int, int> > corbels;
+	for(int k = 0; k < 7; ++k){
+		corbels.push_back(std::pair<int, int>(mid - 150 + k * 20, bottom - k * 40));
+		corbels.push_back(std::pair<int, int>(mid + 150 - k * 20, bottom - k * 40));
+	}
+	return corbels;
+}
+
+//Milliseconds for one pass over every corbel, best of runs
+template<typename Func>
+static double Time(Func func, int runs){
+	double best = 1e30;
+	for(int run = 0; run < runs; ++run){
+		const auto start = std::chrono::steady_clock::now();
+		func();
+		best = std::min(best, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+	}
+	return best;
+}
+
+//Pixels that aren't white any more
+static size_t Drawn(const Image & img){
+	size_t count = 0;
+	for(int y = 0; y < img.height(); ++y){
+		for(int x = 0; x < img.width(); ++x){
+			if (img.point_unsafe(x, y) != Image::Color(255, 255, 255)) ++count;
+		}
+	}
+	return count;
+}
+
+int main(){
+	const int width = 600, height = 500, mid = 300, top = 170, bottom = 450;
+	const int runs = 200;
+	const std::vector<std::pair<int, int> > corbels = Corbels(mid, bottom);
+	Image chain(width, height, Image::Color(255, 255, 255));
+	Image smooth(width, height, Image::Color(255, 255, 255));
+
+	//Drawing over and over into the same image only repaints the same pixels
+	const double chainMs = Time([&](){
+		for(const auto & corbel : corbels) plot(corbel, mid, top, chain, Image::Color(255, 0, 0));
+	}, runs);
+	const double smoothMs = Time([&](){
+		for(const auto & corbel : corbels) plotSmooth(corbel, mid, top, smooth, Image::Color(255, 0, 0));
+	}, runs);
+
+	std::cout << corbels.size() << " curves on " << width << " x " << height << ", best of " << runs << std::endl;
+	std::cout << "  plot: " << chainMs << " ms, " << Drawn(chain) << " pixels drawn" << std::endl;
+	std::cout << "  plotSmooth: " << smoothMs << " ms, " << Drawn(smooth) << " pixels drawn" << std::endl;
+	return Drawn(smooth) == 0 ? 1 : 0;
+}
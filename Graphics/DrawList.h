@@ -0,0 +1,138 @@
+#ifndef DRAWLIST_H
+#define DRAWLIST_H
+
+#include "./Image.h"
+#include <thread>
+#include <atomic>
+#include <memory>
+
+//Records drawing calls and plays them back band by band, so each band of rows is only walked once while it's in cache.
+//Calls are replayed in the order they were made, so the result matches drawing straight onto the image
+class DrawList {
+public:
+	static const int BAND_HEIGHT = 32;
+
+	inline void pset(int x, int y, uint32_t color){
+		add(Command::Pixel, x, y, x, y, color, nullptr, y, y);
+	}
+
+	inline void line(int x, int y, int x2, int y2, uint32_t color){
+		add(Command::Line, x, y, x2, y2, color, nullptr, std::min(y, y2), std::max(y, y2));
+	}
+
+	void polyline(const std::vector<std::pair<int, int> > & points, uint32_t color){
+		for(size_t i = 1; i < points.size(); ++i){
+			line(points[i - 1].first, points[i - 1].second, points[i].first, points[i].second, color);
+		}
+	}
+
+	inline void rect_fill_x2_and_y2(int x, int y, int x2, int y2, uint32_t color){
+		if (x2 < x){ int tmp = x; x = x2; x2 = tmp; }
+		if (y2 < y){ int tmp = y; y = y2; y2 = tmp; }
+		add(Command::RectFill, x, y, x2, y2, color, nullptr, y, y2);
+	}
+
+	//Only keeps a pointer to img, it has to outlive render
+	inline void put_mask(const Image & img, int x, int y){
+		if (img.width() <= 0 || img.height() <= 0) return;
+		add(Command::Mask, x, y, x + img.width() - 1, y + img.height() - 1, 0, &img, y, y + img.height() - 1);
+	}
+
+	//Keeps img alive until the list is cleared
+	inline void put_mask(std::shared_ptr<const Image> img, int x, int y){
+		if (img == nullptr) return;
+		put_mask(*img, x, y);
+		_owned.push_back(std::move(img));
+	}
+
+	inline void clear(){ _commands.clear(); _owned.clear(); }
+	inline bool empty() const { return _commands.empty(); }
+
+	//Threads each take whole bands, so nothing is shared between them
+	void render(Image & img, unsigned int threads = 1) const {
+		if (_commands.empty() || img._width <= 0 || img._height <= 0) return;
+
+		//Bin commands into the bands they touch, keeping their order
+		const int bands = (img._height + BAND_HEIGHT - 1) / BAND_HEIGHT;
+		std::vector<std::vector<size_t> > binned(static_cast<size_t>(bands));
+		for(size_t i = 0; i < _commands.size(); ++i){
+			const Command & c = _commands[i];
+			if (c.bottom < 0 || c.top >= img._height) continue;
+			const int first = std::max(c.top, 0) / BAND_HEIGHT;
+			const int last = std::min(c.bottom, img._height - 1) / BAND_HEIGHT;
+			for(int band = first; band <= last; ++band) binned[static_cast<size_t>(band)].push_back(i);
+		}
+
+		if (threads <= 1 || bands == 1){
+			for(int band = 0; band < bands; ++band) renderBand(img, band, binned[static_cast<size_t>(band)]);
+			return;
+		}
+
+		std::atomic<int> next(0);
+		std::vector<std::thread> workers;
+		const unsigned int count = std::min(threads, static_cast<unsigned int>(bands));
+		for(unsigned int t = 0; t < count; ++t){
+			workers.emplace_back([&](){
+				for(int band = next++; band < bands; band = next++) renderBand(img, band, binned[static_cast<size_t>(band)]);
+			});
+		}
+		for(auto & w : workers) w.join();
+	}
+
+private:
+	struct Command {
+		enum Kind : uint8_t { Pixel, Line, RectFill, Mask };
+		Kind kind;
+		int x, y, x2, y2;
+		uint32_t color;
+		const Image * mask;
+		int top, bottom;
+	};
+
+	inline void add(Command::Kind kind, int x, int y, int x2, int y2, uint32_t color, const Image * mask, int top, int bottom){
+		_commands.push_back({kind, x, y, x2, y2, color, mask, top, bottom});
+	}
+
+	void renderBand(Image & img, int band, const std::vector<size_t> & commands) const {
+		const int top = band * BAND_HEIGHT;
+		const int bottom = std::min(top + BAND_HEIGHT, img._height) - 1;
+		for(size_t i : commands){
+			const Command & c = _commands[i];
+			switch(c.kind){
+				case Command::Pixel:
+					img.pset(c.x, c.y, c.color);
+					break;
+				case Command::Line:
+					img.line_in_rows(c.x, c.y, c.x2, c.y2, c.color, top, bottom);
+					break;
+				case Command::RectFill:
+					if (c.y <= bottom && c.y2 >= top) img.rect_fill_x2_and_y2(c.x, std::max(c.y, top), c.x2, std::min(c.y2, bottom), c.color);
+					break;
+				case Command::Mask:
+					renderMask(img, c, top, bottom);
+					break;
+			}
+		}
+	}
+
+	//Same as Image::put_mask, but only the rows in the band
+	static void renderMask(Image & img, const Command & c, int top, int bottom){
+		const int xStart = std::max(c.x, 0);
+		const int xEnd = std::min(c.x2, img._width - 1);
+		const int yStart = std::max(c.y, top);
+		const int yEnd = std::min(c.y2, bottom);
+		if (xStart > xEnd) return;
+		for(int y = yStart; y <= yEnd; ++y){
+			const uint32_t * source = &c.mask->point_unsafe(xStart - c.x, y - c.y);
+			uint32_t * dest = reinterpret_cast<uint32_t*>(&img._image[img.pixelIndex(xStart, y)]);
+			for(int x = xStart; x <= xEnd; ++x, ++source, ++dest){
+				if (Image::Alpha(*source) == 255) *dest = *source;
+			}
+		}
+	}
+
+	std::vector<Command> _commands;
+	std::vector<std::shared_ptr<const Image> > _owned;
+};
+
+#endif
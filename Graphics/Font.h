@@ -2,10 +2,132 @@
 #define FONT_H
 
 #include "./Image.h"
+#include "./DrawList.h"
+#include <memory>
+#include <unordered_map>
+#include <ostream>
+#include <map>
+#include <mutex>
+
+//A font that's already been cropped, scaled and packed into an atlas, see bakefont.cpp
+struct BakedFont {
+	int lineHeight;
+	int atlasWidth;
+	int atlasHeight;
+	const uint16_t * glyphWidths;  //256 of them, each glyph starts where the last one ended
+	const uint32_t * runs;  //The atlas row by row as (count, color) pairs
+	size_t runCount;
+};
 
 class Font {
 public:
 	Font(const std::string & filename, int characterWidth = -1, int characterHeight = -1, bool vflip = false, float scalar = 1.0f){
+		Image characters[256];
+		loadGlyphs(filename, characterWidth, characterHeight, vflip, characters);
+		for(auto & c : characters) c = scaleGlyph(c, scalar);
+		buildAtlas(characters);
+	}
+	
+	//Glyphs that are already cropped and scaled
+	Font(const Image (&characters)[256]){
+		buildAtlas(characters);
+	}
+	
+	Font(const BakedFont & baked){
+		_lineHeight = baked.lineHeight;
+		_atlas = Image(baked.atlasWidth, baked.atlasHeight, true);
+		uint32_t * dest = reinterpret_cast<uint32_t*>(_atlas.data());
+		for(size_t i = 0; i + 1 < baked.runCount; i += 2){
+			std::fill_n(dest, baked.runs[i], baked.runs[i + 1]);
+			dest += baked.runs[i];
+		}
+		int x = 0;
+		for(size_t i = 0; i < 256; ++i){
+			_glyphs[i].x = x;
+			_glyphs[i].width = baked.glyphWidths[i];
+			findSpans(_atlas, x, _glyphs[i].width, _glyphs[i].spans);
+			x += _glyphs[i].width;
+		}
+	}
+	
+	inline int height() const { return _lineHeight; }
+	
+	//Writes the atlas out as C++ tables that the BakedFont constructor can load.  Only opaque pixels are ever drawn, so
+	//everything else is stored as clear to keep the runs long
+	void bake(std::ostream & out, const std::string & name) const {
+		out << "static const uint16_t " << name << "_glyphWidths[256] = {";
+		for(size_t i = 0; i < 256; ++i) out << (i % 32 == 0 ? "\n\t" : " ") << _glyphs[i].width << ",";
+		out << "\n};\n";
+		
+		std::vector<uint32_t> runs;
+		const uint32_t * source = reinterpret_cast<const uint32_t*>(_atlas.data());
+		const size_t count = static_cast<size_t>(_atlas.width()) * static_cast<size_t>(_atlas.height());
+		for(size_t i = 0; i < count; ++i){
+			const uint32_t color = (Image::Alpha(source[i]) == 255) ? source[i] : 0;
+			if (!runs.empty() && runs.back() == color){
+				++runs[runs.size() - 2];
+			} else {
+				runs.push_back(1);
+				runs.push_back(color);
+			}
+		}
+		out << "static const uint32_t " << name << "_runs[" << runs.size() << "] = {";
+		for(size_t i = 0; i < runs.size(); ++i) out << (i % 16 == 0 ? "\n\t" : " ") << runs[i] << (i & 1 ? "u," : ",");
+		out << "\n};\n";
+		out << "static const BakedFont " << name << " = { " << _lineHeight << ", " << _atlas.width() << ", " << _atlas.height() << ", " << name << "_glyphWidths, " << name << "_runs, " << runs.size() << " };\n";
+	}
+	
+	void write(const std::string & str, Image & img, int x, int y){
+		std::shared_ptr<const TextRun> run = getRun(str);
+		if (run == nullptr) return;
+		const uint32_t * source = reinterpret_cast<const uint32_t*>(run->image.data());
+		uint32_t * dest = reinterpret_cast<uint32_t*>(img.data());
+		for(auto & span : run->spans){
+			const int destY = y + span.y;
+			if (destY < 0 || destY >= img._height) continue;
+			int destX = x + span.x;
+			int start = span.x;
+			int length = span.length;
+			if (destX < 0){ start -= destX; length += destX; destX = 0; }
+			if (destX + length > img._width) length = img._width - destX;
+			if (length <= 0) continue;
+			memcpy(dest + static_cast<size_t>(destY) * static_cast<size_t>(img._width) + static_cast<size_t>(destX), source + static_cast<size_t>(span.y) * static_cast<size_t>(run->image._width) + static_cast<size_t>(start), static_cast<size_t>(length) * 4);
+		}
+	}
+	
+	//The list shares the cached run, so it stays valid until the list is done with it
+	void write(const std::string & str, DrawList & list, int x, int y){
+		std::shared_ptr<const TextRun> run = getRun(str);
+		if (run == nullptr) return;
+		list.put_mask(std::shared_ptr<const Image>(run, &run->image), x, y);
+	}
+private:
+	static const size_t MAX_CACHED_RUNS = 512;
+	
+	//A horizontal run of fully opaque pixels
+	struct Span {
+		int y;
+		int x;
+		int length;
+	};
+	
+	//Where a character lives in the atlas, and its opaque spans relative to its own corner
+	struct Glyph {
+		int x = 0;
+		int width = 0;
+		std::vector<Span> spans;
+	};
+	
+	//A whole string drawn once, transparent where there's no glyph
+	struct TextRun {
+		TextRun(int width, int height) : image(width, height, Image::Color(0, 0, 0, 0)), spans() {}
+		Image image;
+		std::vector<Span> spans;
+	};
+	
+	friend class FontSource;
+	
+	static void loadGlyphs(const std::string & filename, int characterWidth, int characterHeight, bool vflip, Image (&characters)[256]){
 		Image loader(filename);
 		int width = loader.width() / 16;
 		int height = loader.height() / 16;
@@ -20,30 +142,110 @@ public:
 				characters[i].replaceColor(Image::Color(255, 0, 255), Image::Color(0,0,0,0));
 				autoCropX(characters[i]);
 				if (vflip) characters[i] = characters[i].vflip();
-				if (scalar > 1.01f || scalar < 0.99f) characters[i] = characters[i].resize(static_cast<int>(static_cast<float>(characters[i].width()) * scalar), static_cast<int>(static_cast<float>(characters[i].height()) * scalar));
 				++i;
 			}
 		}
 	}
 	
-	inline int height() const { return characters[0].height(); }
+	//Shrinking averages areas, growing is bilinear.  Glyphs are only drawn where they're opaque, so anything at least half
+	//covered becomes opaque and the rest clear
+	static Image scaleGlyph(const Image & glyph, float scalar){
+		if (scalar <= 1.01f && scalar >= 0.99f) return glyph;
+		const int w = static_cast<int>(static_cast<float>(glyph.width()) * scalar);
+		const int h = static_cast<int>(static_cast<float>(glyph.height()) * scalar);
+		Image res = (scalar < 1.0f) ? glyph.resizeArea(w, h) : glyph.resize(w, h);
+		uint32_t * data32 = reinterpret_cast<uint32_t*>(res.data());
+		uint32_t * end = data32 + (res.pixels() / 4);
+		for(; data32 < end; ++data32) *data32 = (Image::Alpha(*data32) >= 128) ? (*data32 | 0xFF000000u) : 0;
+		return res;
+	}
 	
-	void write(const std::string & str, Image & img, int x, int y){
-		int realX = x;
+	static void findSpans(const Image & img, int x, int width, std::vector<Span> & spans){
+		for(int y = 0; y < img.height(); ++y){
+			int start = -1;
+			for(int ix = 0; ix <= width; ++ix){
+				const bool opaque = (ix < width) && (Image::Alpha(img.point_unsafe(x + ix, y)) == 255);
+				if (opaque && start < 0){
+					start = ix;
+				} else if (!opaque && start >= 0){
+					spans.push_back({y, start, ix - start});
+					start = -1;
+				}
+			}
+		}
+	}
+	
+	void buildAtlas(const Image (&characters)[256]){
+		int atlasWidth = 0;
+		int atlasHeight = 0;
+		for(auto & c : characters){
+			atlasWidth += c.width();
+			atlasHeight = std::max(atlasHeight, c.height());
+		}
+		_lineHeight = characters[0].height();
+		_atlas = Image(std::max(atlasWidth, 1), std::max(atlasHeight, 1), Image::Color(0, 0, 0, 0));
+		
+		int x = 0;
+		for(size_t i = 0; i < 256; ++i){
+			_glyphs[i].x = x;
+			_glyphs[i].width = characters[i].width();
+			if (characters[i].width() > 0 && characters[i].height() > 0) _atlas.put(characters[i], x, 0);
+			findSpans(characters[i], 0, characters[i].width(), _glyphs[i].spans);
+			x += characters[i].width();
+		}
+	}
+	
+	std::shared_ptr<const TextRun> getRun(const std::string & str){
+		std::lock_guard<std::mutex> guard(_runLock);
+		auto found = _runs.find(str);
+		if (found != _runs.end()) return found->second;
+		
+		//Measure first so the run is only allocated once
+		int runWidth = 0;
+		int realX = 0;
+		int lines = 1;
 		for(auto & c : str){
 			if (c == '\n') {
-				realX = x;
-				y += characters[0].height();
+				realX = 0;
+				++lines;
 			} else if (c == ' '){
-				realX += characters[0].height() / 4;
+				realX += _lineHeight / 4;
 			} else {
-				img.put_mask(characters[static_cast<size_t>(c)], realX, y);
-				realX += characters[static_cast<size_t>(c)].width() + 1;
+				const Glyph & glyph = _glyphs[static_cast<uint8_t>(c)];
+				runWidth = std::max(runWidth, realX + glyph.width);
+				realX += glyph.width + 1;
 			}
 		}
+		const int runHeight = (lines - 1) * _lineHeight + _atlas.height();
+		if (runWidth <= 0 || runHeight <= 0) return nullptr;
+		
+		std::shared_ptr<TextRun> run = std::make_shared<TextRun>(runWidth, runHeight);
+		const uint32_t * atlas = reinterpret_cast<const uint32_t*>(_atlas.data());
+		uint32_t * dest = reinterpret_cast<uint32_t*>(run->image.data());
+		realX = 0;
+		int y = 0;
+		for(auto & c : str){
+			if (c == '\n') {
+				realX = 0;
+				y += _lineHeight;
+			} else if (c == ' '){
+				realX += _lineHeight / 4;
+			} else {
+				const Glyph & glyph = _glyphs[static_cast<uint8_t>(c)];
+				for(auto & span : glyph.spans){
+					memcpy(dest + static_cast<size_t>(y + span.y) * static_cast<size_t>(runWidth) + static_cast<size_t>(realX + span.x), atlas + static_cast<size_t>(span.y) * static_cast<size_t>(_atlas.width()) + static_cast<size_t>(glyph.x + span.x), static_cast<size_t>(span.length) * 4);
+				}
+				realX += glyph.width + 1;
+			}
+		}
+		findSpans(run->image, 0, runWidth, run->spans);
+		
+		if (_runs.size() >= MAX_CACHED_RUNS) _runs.clear();
+		_runs.emplace(str, run);
+		return run;
 	}
-private:
-	void autoCropX(Image & img){
+	
+	static void autoCropX(Image & img){
 		int leftX = -1;
 		int rightX = -1;
 		
@@ -67,8 +269,45 @@ private:
 		
 		img = img.get_x2_and_y2(leftX, 0, rightX, img.height());
 	}
+	
+	Image _atlas;
+	Glyph _glyphs[256];
+	int _lineHeight = 0;
+	std::unordered_map<std::string, std::shared_ptr<const TextRun> > _runs;
+	std::mutex _runLock;
+};
 
-	Image characters[256];
+//The unscaled glyphs of a font.  Scaled fonts are made from them the first time each scale is asked for and then kept,
+//so every layout using the same scale shares one Font, from any thread
+class FontSource {
+public:
+	FontSource(const std::string & filename, int characterWidth = -1, int characterHeight = -1, bool vflip = false){
+		Font::loadGlyphs(filename, characterWidth, characterHeight, vflip, _glyphs);
+	}
+	
+	//The baked font has to be the unscaled one
+	FontSource(const BakedFont & baked){
+		const Font unpacked(baked);
+		for(size_t i = 0; i < 256; ++i){
+			_glyphs[i] = unpacked._atlas.get_width_and_height(unpacked._glyphs[i].x, 0, unpacked._glyphs[i].width, unpacked._atlas.height());
+		}
+	}
+	
+	std::shared_ptr<Font> at(float scalar){
+		const int key = static_cast<int>(std::lround(scalar * 1000.0f));
+		std::lock_guard<std::mutex> guard(_lock);
+		std::shared_ptr<Font> & font = _fonts[key];
+		if (font == nullptr){
+			Image characters[256];
+			for(size_t i = 0; i < 256; ++i) characters[i] = Font::scaleGlyph(_glyphs[i], scalar);
+			font = std::make_shared<Font>(characters);
+		}
+		return font;
+	}
+private:
+	Image _glyphs[256];
+	std::map<int, std::shared_ptr<Font> > _fonts;
+	std::mutex _lock;
 };
 
 #endif
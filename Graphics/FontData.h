@@ -0,0 +1,3530 @@
+//Generated by bakefont from font.png, don't edit by hand
+#ifndef FONTDATA_H
+#define FONTDATA_H
+
+#include "./Font.h"
+
+static const uint16_t FontData_Source_glyphWidths[256] = {
+	21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 21, 21, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+	0, 4, 7, 15, 14, 18, 17, 4, 7, 7, 13, 14, 4, 6, 4, 14, 15, 14, 14, 15, 15, 15, 15, 13, 15, 15, 4, 4, 13, 13, 13, 13,
+	19, 17, 14, 14, 15, 13, 13, 15, 14, 4, 9, 16, 12, 18, 14, 16, 13, 16, 14, 15, 14, 13, 15, 22, 15, 16, 13, 7, 14, 7, 13, 15,
+	8, 12, 12, 12, 12, 13, 10, 15, 12, 4, 8, 12, 4, 18, 12, 13, 12, 12, 8, 12, 10, 12, 12, 17, 13, 12, 11, 7, 4, 7, 15, 21,
+	15, 21, 4, 21, 7, 15, 14, 14, 21, 27, 15, 5, 15, 14, 13, 13, 21, 4, 4, 7, 7, 9, 30, 18, 21, 21, 12, 5, 12, 11, 12, 12,
+	0, 11, 29, 13, 16, 17, 4, 14, 7, 31, 14, 8, 13, 6, 19, 13, 9, 14, 7, 8, 8, 11, 15, 4, 8, 14, 12, 8, 12, 11, 8, 11,
+	14, 17, 17, 17, 17, 12, 14, 14, 14, 13, 14, 13, 13, 8, 11, 15, 16, 14, 14, 16, 16, 16, 16, 12, 14, 13, 13, 13, 13, 31, 13, 14,
+	10, 12, 12, 12, 12, 8, 12, 12, 12, 13, 13, 13, 13, 8, 11, 17, 14, 12, 12, 13, 13, 13, 13, 14, 11, 12, 12, 13, 12, 12, 10, 4,
+};
+static const uint32_t FontData_Source_runs[56144] = {
+	5363, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u, 17, 0u, 4, 4278190080u, 3, 0u, 5, 4278190080u,
+	1, 0u, 5, 4278190080u, 2, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u, 8, 0u, 4, 4278190080u,
+	590, 0u, 4, 4278190080u, 13, 0u, 4, 4278190080u, 9, 0u, 5, 4278190080u, 10, 0u, 4, 4278190080u,
+	1, 0u, 4, 4278190080u, 25, 0u, 4, 4278190080u, 13, 0u, 4, 4278190080u, 17, 0u, 5, 4278190080u,
+	1, 0u, 5, 4278190080u, 9, 0u, 4, 4278190080u, 29, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u,
+	5, 0u, 4, 4278190080u, 3, 0u, 5, 4278190080u, 4, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u,
+	28, 0u, 4, 4278190080u, 3, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u, 9, 0u, 4, 4278190080u,
+	10, 0u, 5, 4278190080u, 10, 0u, 8, 4278190080u, 32, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u,
+	6, 0u, 6, 4278190080u, 10, 0u, 4, 4278190080u, 6, 0u, 8, 4278190080u, 24, 0u, 4, 4278190080u,
+	106, 0u, 4, 4278190080u, 2245, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u,
+	1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 15, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u,
+	3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 6, 0u, 3, 4278190080u, 1, 4293848814u,
+	1, 4294177779u, 1, 4278190080u, 415, 0u, 4, 4278190080u, 169, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u,
+	1, 4278190080u, 11, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 8, 0u, 2, 4278190080u,
+	1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	3, 4278190080u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 9, 0u, 7, 4278190080u, 7, 0u, 3, 4278190080u,
+	1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 11, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u,
+	17, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4294177779u, 1, 4278190080u, 7, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 18, 0u,
+	7, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u,
+	26, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 7, 0u,
+	3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 9, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u,
+	1, 4292796126u, 2, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294177779u, 2, 4278190080u, 1, 4293322470u,
+	1, 4294177779u, 1, 4278190080u, 8, 0u, 7, 4278190080u, 17, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293717228u, 3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	1, 4293519849u, 2, 4294835709u, 1, 4293519849u, 1, 4278190080u, 8, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u,
+	1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294177779u, 2, 4278190080u, 1, 4293322470u, 1, 4294177779u,
+	1, 4278190080u, 4, 0u, 7, 4278190080u, 11, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u,
+	104, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 2245, 0u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 13, 0u,
+	3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 3, 0u, 2, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 4, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 415, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 167, 0u, 3, 4278190080u, 1, 4293519849u,
+	1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 9, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u,
+	1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u,
+	2, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 1, 4294046193u,
+	1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u,
+	1, 4278190080u, 5, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u,
+	9, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 17, 0u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 5, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u,
+	18, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 4, 0u, 2, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	1, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 0u,
+	2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 24, 0u,
+	3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 3, 0u, 2, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	5, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 8, 0u,
+	2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 5, 0u, 3, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 17, 0u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 6, 0u,
+	1, 4278190080u, 1, 4294835709u, 2, 4292796126u, 1, 4294835709u, 1, 4278190080u, 6, 0u, 3, 4278190080u, 1, 4293519849u,
+	1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4294309365u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 9, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u,
+	1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 102, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u,
+	1, 4294309365u, 1, 4278190080u, 314, 0u, 609, 4278190080u, 32, 0u, 4, 4278190080u, 1104, 0u, 21, 4278190080u,
+	15, 0u, 21, 4278190080u, 4, 0u, 21, 4278190080u, 50, 0u, 21, 4278190080u, 30, 0u, 2, 4278190080u,
+	1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 14, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u,
+	1, 4293717228u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u,
+	2, 0u, 21, 4278190080u, 79, 0u, 21, 4278190080u, 57, 0u, 4, 4278190080u, 231, 0u, 1, 4278190080u,
+	2, 4294572537u, 1, 4278190080u, 167, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u,
+	1, 4292467161u, 2, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u,
+	1, 4292467161u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u,
+	1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4293059298u, 5, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u,
+	9, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u,
+	18, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 6, 0u, 1, 4278190080u,
+	1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 18, 0u, 1, 4278190080u,
+	2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u,
+	1, 4293717228u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u,
+	1, 4292467161u, 4, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u,
+	25, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u,
+	4, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 6, 0u, 1, 4278190080u,
+	1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 7, 0u, 2, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294835709u, 1, 4294704123u, 1, 4293059298u, 1, 4293322470u, 1, 4294835709u,
+	1, 4294704123u, 1, 4293059298u, 2, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u,
+	1, 4278190080u, 18, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 7, 0u,
+	1, 4278190080u, 1, 4294835709u, 2, 4292796126u, 1, 4294835709u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293059298u,
+	1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293322470u,
+	1, 4294835709u, 1, 4294704123u, 1, 4293059298u, 1, 4293322470u, 1, 4294835709u, 1, 4294704123u, 1, 4293059298u, 2, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 9, 0u, 1, 4278190080u,
+	1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 102, 0u, 1, 4278190080u,
+	1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 314, 0u, 1, 4278190080u,
+	19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u,
+	19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u,
+	19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u,
+	19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u,
+	19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u,
+	19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u,
+	19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u, 19, 4294440951u, 2, 4278190080u,
+	19, 4294440951u, 1, 4278190080u, 32, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 763, 0u, 4, 4278190080u,
+	337, 0u, 1, 4278190080u, 19, 4294440951u, 1, 4278190080u, 15, 0u, 1, 4278190080u, 19, 4294440951u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 19, 4294440951u, 1, 4278190080u, 50, 0u, 1, 4278190080u, 19, 4294440951u, 1, 4278190080u,
+	31, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 15, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u,
+	1, 4292796126u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u,
+	6, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 3, 0u, 1, 4278190080u,
+	19, 4294440951u, 1, 4278190080u, 79, 0u, 1, 4278190080u, 19, 4294440951u, 1, 4278190080u, 21, 0u, 5, 4278190080u,
+	1, 0u, 5, 4278190080u, 14, 0u, 4, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294835709u,
+	1, 4278190080u, 1, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u, 8, 0u, 9, 4278190080u, 1, 0u,
+	9, 4278190080u, 1, 0u, 4, 4278190080u, 187, 0u, 4, 4278190080u, 46, 0u, 4, 4278190080u, 87, 0u,
+	8, 4278190080u, 22, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 10, 0u,
+	1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 7, 0u,
+	2, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 2, 4278190080u, 9, 0u,
+	7, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 10, 0u,
+	1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 20, 0u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u,
+	3, 4278190080u, 19, 0u, 7, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u,
+	2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 26, 0u,
+	1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u,
+	3, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4293848814u, 2, 4278190080u,
+	1, 4294309365u, 1, 4293848814u, 3, 4278190080u, 9, 0u, 7, 4278190080u, 19, 0u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4293519849u, 2, 4294835709u, 1, 4293519849u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4294177779u, 1, 4293848814u, 2, 4278190080u, 1, 4294309365u, 1, 4293848814u, 3, 4278190080u, 5, 0u,
+	7, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 51, 0u,
+	4, 4278190080u, 8, 0u, 4, 4278190080u, 4, 0u, 5, 4278190080u, 5, 0u, 4, 4278190080u, 1, 0u,
+	4, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 9, 0u,
+	4, 4278190080u, 13, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u, 8, 0u, 4, 4278190080u, 28, 0u,
+	5, 4278190080u, 1, 0u, 5, 4278190080u, 5, 0u, 4, 4278190080u, 3, 0u, 5, 4278190080u, 42, 0u,
+	4, 4278190080u, 1, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u, 7, 0u, 4, 4278190080u, 6, 0u,
+	5, 4278190080u, 8, 0u, 8, 4278190080u, 28, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u, 3, 0u,
+	6, 4278190080u, 11, 0u, 4, 4278190080u, 5, 0u, 8, 4278190080u, 20, 0u, 4, 4278190080u, 14, 0u,
+	1, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u,
+	1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u,
+	1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u,
+	1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u,
+	1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u,
+	1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u,
+	1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u,
+	1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 12, 4278190080u, 4, 0u,
+	10, 4278190080u, 4, 0u, 4, 4278190080u, 2, 4294967295u, 3, 4278190080u, 3, 0u, 7, 4278190080u, 3, 0u,
+	5, 4278190080u, 6, 0u, 8, 4278190080u, 5, 0u, 4, 4278190080u, 3, 0u, 8, 4278190080u, 7, 0u,
+	4, 4278190080u, 43, 0u, 4, 4278190080u, 3, 0u, 9, 4278190080u, 8, 0u, 4, 4278190080u, 8, 0u,
+	9, 4278190080u, 5, 0u, 9, 4278190080u, 9, 0u, 6, 4278190080u, 5, 0u, 12, 4278190080u, 4, 0u,
+	10, 4278190080u, 2, 0u, 13, 4278190080u, 3, 0u, 9, 4278190080u, 6, 0u, 9, 4278190080u, 52, 0u,
+	9, 4278190080u, 7, 0u, 10, 4278190080u, 9, 0u, 7, 4278190080u, 5, 0u, 12, 4278190080u, 5, 0u,
+	8, 4278190080u, 3, 0u, 11, 4278190080u, 4, 0u, 26, 4278190080u, 4, 0u, 9, 4278190080u, 2, 0u,
+	4, 4278190080u, 6, 0u, 8, 4278190080u, 5, 0u, 8, 4278190080u, 6, 0u, 5, 4278190080u, 1, 0u,
+	4, 4278190080u, 8, 0u, 6, 4278190080u, 6, 0u, 12, 4278190080u, 4, 0u, 4, 4278190080u, 4, 0u,
+	9, 4278190080u, 3, 0u, 11, 4278190080u, 6, 0u, 8, 4278190080u, 4, 0u, 12, 4278190080u, 5, 0u,
+	9, 4278190080u, 3, 0u, 18, 4278190080u, 5, 0u, 9, 4278190080u, 5, 0u, 10, 4278190080u, 4, 0u,
+	5, 4278190080u, 3, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u, 3, 0u, 5, 4278190080u, 1, 0u,
+	5, 4278190080u, 6, 0u, 29, 4278190080u, 10, 0u, 7, 4278190080u, 3, 0u, 7, 4278190080u, 18, 0u,
+	1, 4278190080u, 1, 4294177779u, 1, 4293848814u, 3, 4278190080u, 14, 0u, 4, 4278190080u, 28, 0u, 4, 4278190080u,
+	16, 0u, 7, 4278190080u, 15, 0u, 4, 4278190080u, 8, 0u, 4, 4278190080u, 4, 0u, 8, 4278190080u,
+	8, 0u, 4, 4278190080u, 176, 0u, 14, 4278190080u, 17, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294835709u,
+	15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 9, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u, 1, 4294967295u, 1, 4278190080u, 27, 0u, 4, 4278190080u,
+	10, 0u, 4, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u,
+	1, 4294967295u, 1, 4278190080u, 1, 0u, 7, 4278190080u, 3, 0u, 5, 4278190080u, 14, 0u, 9, 4278190080u,
+	11, 0u, 9, 4278190080u, 3, 0u, 41, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u,
+	1, 4294967295u, 23, 4278190080u, 57, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294835709u, 15, 4294440951u, 1, 4294835709u,
+	1, 4294967295u, 16, 4278190080u, 1, 0u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u,
+	1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 12, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 6, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293717228u, 3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	3, 4278190080u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 21, 0u, 4, 4278190080u, 29, 0u, 7, 4278190080u,
+	5, 0u, 4, 4278190080u, 3, 0u, 9, 4278190080u, 2, 0u, 7, 4278190080u, 5, 0u, 9, 4278190080u,
+	19, 0u, 9, 4278190080u, 35, 0u, 9, 4278190080u, 5, 0u, 13, 4278190080u, 1, 0u, 7, 4278190080u,
+	24, 0u, 4, 4278190080u, 4, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 12, 0u,
+	14, 4278190080u, 46, 0u, 4, 4278190080u, 1, 0u, 4, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293322470u,
+	1, 4294177779u, 2, 4278190080u, 1, 4293322470u, 1, 4294177779u, 9, 4278190080u, 4, 0u, 4, 4278190080u, 3, 0u,
+	12, 4278190080u, 7, 0u, 7, 4278190080u, 8, 0u, 11, 4278190080u, 8, 0u, 7, 4278190080u, 10, 0u,
+	7, 4278190080u, 5, 0u, 5, 4278190080u, 10, 0u, 8, 4278190080u, 6, 0u, 8, 4278190080u, 6, 0u,
+	8, 4278190080u, 3, 0u, 26, 4278190080u, 1, 0u, 31, 4278190080u, 3, 0u, 22, 4278190080u, 5, 0u,
+	11, 4278190080u, 4, 0u, 28, 4278190080u, 4, 0u, 9, 4278190080u, 6, 0u, 11, 4278190080u, 4, 0u,
+	11, 4278190080u, 7, 0u, 9, 4278190080u, 15, 0u, 12, 4278190080u, 2, 0u, 21, 4278190080u, 1, 0u,
+	21, 4278190080u, 5, 0u, 9, 4278190080u, 1, 0u, 10, 4278190080u, 15, 0u, 13, 4278190080u, 3, 0u,
+	8, 4278190080u, 7, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 6, 0u, 3, 4278190080u,
+	1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u,
+	2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 3, 4278190080u, 1, 4294967295u, 1, 4294835709u,
+	1, 4278190080u, 4, 0u, 7, 4278190080u, 2, 0u, 5, 4278190080u, 9, 0u, 3, 4278190080u, 1, 4293848814u,
+	1, 4294177779u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u,
+	1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 6, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u,
+	1, 4278190080u, 17, 0u, 7, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u,
+	3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4293848814u,
+	1, 4294177779u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u,
+	10, 0u, 4, 4278190080u, 1, 0u, 4, 4278190080u, 8, 0u, 4, 4278190080u, 8, 0u, 3, 4278190080u,
+	1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u,
+	3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 5, 0u, 3, 4278190080u, 1, 4293848814u,
+	1, 4294177779u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u,
+	6, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294177779u, 2, 4278190080u, 1, 4293322470u, 1, 4294177779u, 1, 4278190080u,
+	4, 0u, 7, 4278190080u, 17, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u,
+	1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293519849u, 2, 4294835709u,
+	1, 4293519849u, 1, 4278190080u, 9, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 4, 0u,
+	2, 4278190080u, 1, 4293322470u, 1, 4294177779u, 2, 4278190080u, 1, 4293322470u, 1, 4294177779u, 1, 4278190080u, 3, 0u,
+	7, 4278190080u, 8, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294177779u, 1, 4278190080u, 10, 0u, 5, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4292796126u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 3, 0u, 2, 4278190080u,
+	1, 4293059298u, 1, 4294177779u, 1, 4294835709u, 2, 4294967295u, 1, 4294835709u, 1, 4294177779u, 2, 4278190080u, 1, 0u,
+	2, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293322470u, 2, 4278190080u, 1, 0u,
+	2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293322470u,
+	1, 4294572537u, 2, 4294967295u, 1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294309365u, 2, 4278190080u, 1, 4294440951u, 1, 4294177779u,
+	2, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4278190080u, 42, 0u, 2, 4278190080u,
+	2, 4294835709u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 1, 4294835709u, 1, 4294967295u,
+	1, 4294835709u, 1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4278190080u, 6, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294572537u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u,
+	1, 4292796126u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 1, 4294835709u, 2, 4294967295u,
+	1, 4294572537u, 1, 4293519849u, 2, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4293848814u, 3, 4294967295u, 1, 4278190080u,
+	4, 0u, 2, 4278190080u, 10, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294046193u,
+	1, 4294572537u, 2, 4294967295u, 1, 4294835709u, 1, 4294309365u, 1, 4293322470u, 2, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294572537u, 10, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 3, 4294967295u,
+	1, 4294572537u, 1, 4293848814u, 2, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294572537u, 2, 4294967295u,
+	1, 4294835709u, 1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 50, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u,
+	1, 4294835709u, 2, 4294967295u, 1, 4294440951u, 1, 4293519849u, 2, 4278190080u, 4, 0u, 3, 4278190080u, 1, 4293519849u,
+	1, 4294309365u, 1, 4294835709u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 1, 4293322470u, 3, 4278190080u, 7, 0u,
+	1, 4278190080u, 1, 4292467161u, 3, 4294967295u, 1, 4292796126u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 7, 4294967295u,
+	1, 4294835709u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u,
+	2, 4294967295u, 1, 4294835709u, 1, 4294177779u, 3, 4278190080u, 1, 0u, 1, 4278190080u, 7, 4294967295u, 1, 4294440951u,
+	1, 4293717228u, 3, 4278190080u, 2, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u,
+	2, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294572537u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 1, 4292467161u,
+	2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 3, 4294967295u, 1, 4293848814u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 1, 4294046193u, 3, 4294967295u, 2, 4278190080u, 3, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 3, 4278190080u, 1, 4294046193u, 1, 4294572537u,
+	2, 4294967295u, 1, 4294704123u, 1, 4294046193u, 1, 4292467161u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 7, 4294967295u,
+	1, 4294572537u, 1, 4293519849u, 2, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4294046193u, 1, 4294572537u, 2, 4294967295u,
+	1, 4294572537u, 1, 4294046193u, 3, 4278190080u, 2, 0u, 1, 4278190080u, 8, 4294967295u, 1, 4294440951u, 1, 4293519849u,
+	2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u, 1, 4294835709u, 1, 4294177779u,
+	1, 4292796126u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 12, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u,
+	1, 4294835709u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u,
+	4, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 11, 4294967295u, 2, 4278190080u,
+	5, 4294967295u, 2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 9, 0u, 1, 4278190080u, 5, 4294967295u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 1, 4292467161u, 3, 4294967295u, 1, 4292467161u, 1, 4278190080u, 18, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 3, 4278190080u, 12, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 28, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 15, 0u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294572537u, 3, 4294967295u, 1, 4278190080u, 15, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 89, 0u, 4, 4278190080u, 82, 0u,
+	2, 4278190080u, 1, 4294309365u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4294309365u,
+	2, 4278190080u, 16, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294177779u, 1, 4294835709u, 1, 4294967295u, 1, 4294835709u,
+	1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 27, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 3, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293322470u,
+	2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u, 1, 4294835709u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u,
+	9, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u, 1, 4294835709u, 1, 4294177779u, 1, 4292796126u,
+	2, 4278190080u, 2, 0u, 1, 4278190080u, 12, 4294967295u, 2, 4278190080u, 11, 4294967295u, 2, 4278190080u, 11, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294046193u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293519849u, 1, 4294046193u, 1, 4278190080u, 1, 4293519849u,
+	1, 4294046193u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 57, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 8, 4294967295u, 1, 4278190080u,
+	3, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293717228u, 2, 4294967295u, 3, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	10, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 2, 0u,
+	5, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 4, 0u,
+	3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 3, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4294046193u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 21, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 8, 0u, 4, 4278190080u, 7, 0u, 5, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4292467161u, 3, 4294967295u, 1, 4292467161u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	1, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294572537u, 2, 4294967295u, 1, 4294835709u, 1, 4294309365u, 1, 4293059298u,
+	2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 3, 0u,
+	3, 4278190080u, 1, 4293717228u, 1, 4294440951u, 3, 4294967295u, 1, 4294440951u, 1, 4293717228u, 3, 4278190080u, 16, 0u,
+	2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u, 1, 4294835709u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u,
+	32, 0u, 3, 4278190080u, 1, 4293717228u, 1, 4294440951u, 3, 4294967295u, 1, 4294440951u, 1, 4293717228u, 3, 4278190080u,
+	3, 0u, 1, 4278190080u, 11, 4294967295u, 3, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u,
+	1, 4293322470u, 2, 4278190080u, 23, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 3, 4278190080u,
+	1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 12, 0u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294177779u, 1, 4294704123u, 9, 4294967295u, 1, 4278190080u, 46, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u,
+	1, 4294704123u, 1, 4294835709u, 1, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294835709u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	8, 4294967295u, 1, 4294440951u, 1, 4293519849u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292467161u, 3, 4294967295u,
+	1, 4292796126u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 1, 4292467161u, 3, 4294967295u, 1, 4292796126u, 1, 4278190080u,
+	10, 0u, 1, 4278190080u, 1, 4292467161u, 3, 4294967295u, 1, 4292796126u, 1, 4278190080u, 10, 0u, 1, 4278190080u,
+	1, 4292467161u, 3, 4294967295u, 1, 4292796126u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	10, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294835709u, 1, 4294177779u, 3, 4278190080u,
+	3, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294835709u, 1, 4294177779u, 3, 4278190080u,
+	3, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294835709u, 1, 4294177779u, 3, 4278190080u,
+	1, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 7, 4294967295u, 1, 4294440951u,
+	1, 4293717228u, 3, 4278190080u, 3, 0u, 1, 4278190080u, 7, 4294967295u, 1, 4294440951u, 1, 4293717228u, 3, 4278190080u,
+	2, 0u, 1, 4278190080u, 3, 4294967295u, 1, 4293059298u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 3, 4294967295u, 1, 4293059298u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 3, 4278190080u, 1, 4294046193u, 1, 4294572537u, 2, 4294967295u, 1, 4294704123u, 1, 4294046193u, 1, 4292467161u,
+	2, 4278190080u, 4, 0u, 3, 4278190080u, 1, 4294046193u, 1, 4294572537u, 2, 4294967295u, 1, 4294704123u, 1, 4294046193u,
+	1, 4292467161u, 2, 4278190080u, 4, 0u, 3, 4278190080u, 1, 4294046193u, 1, 4294572537u, 2, 4294967295u, 1, 4294704123u,
+	1, 4294046193u, 1, 4292467161u, 2, 4278190080u, 4, 0u, 3, 4278190080u, 1, 4294046193u, 1, 4294572537u, 2, 4294967295u,
+	1, 4294704123u, 1, 4294046193u, 1, 4292467161u, 2, 4278190080u, 14, 0u, 1, 4278190080u, 8, 4294967295u, 1, 4294440951u,
+	1, 4293519849u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u,
+	4, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 15, 0u, 12, 4294967295u,
+	1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294572537u, 2, 4294967295u, 1, 4294309365u, 1, 4292796126u,
+	2, 4278190080u, 4, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u,
+	4, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 2, 0u,
+	2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 8, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u,
+	13, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 4, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 17, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 4, 0u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 1, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u,
+	1, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 9, 0u, 1, 4278190080u,
+	2, 4294967295u, 3, 4278190080u, 1, 4294704123u, 1, 4294835709u, 1, 4278190080u, 5, 0u, 4, 4278190080u, 2, 4294967295u,
+	3, 4278190080u, 4, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u,
+	1, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 3, 0u,
+	3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 17, 0u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294835709u, 2, 4292796126u, 1, 4294835709u, 1, 4278190080u, 7, 0u,
+	3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 2, 0u, 3, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 6, 0u, 3, 4278190080u,
+	1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 2, 0u, 4, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294572537u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u,
+	2, 4278190080u, 1, 4294177779u, 7, 4294967295u, 1, 4294572537u, 3, 4278190080u, 1, 4293059298u, 5, 4294967295u, 1, 4292796126u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4293059298u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u,
+	1, 4292467161u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4278190080u, 10, 0u, 4, 4278190080u, 28, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u,
+	1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293848814u, 7, 4294967295u, 1, 4293519849u, 2, 4278190080u, 3, 0u,
+	3, 4278190080u, 1, 4294177779u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294572537u,
+	7, 4294967295u, 1, 4293519849u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294177779u, 7, 4294967295u, 1, 4294572537u,
+	2, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 3, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4293059298u, 9, 4294967295u, 1, 4294704123u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293322470u,
+	1, 4294835709u, 7, 4294967295u, 1, 4294177779u, 3, 4278190080u, 10, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 0u,
+	2, 4278190080u, 1, 4294309365u, 7, 4294967295u, 1, 4294572537u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294704123u, 7, 4294967295u, 1, 4294177779u, 2, 4278190080u, 49, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u,
+	6, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294835709u, 8, 4294967295u,
+	1, 4294440951u, 1, 4292796126u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4294046193u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 2, 0u,
+	2, 4278190080u, 1, 4294046193u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	9, 4294967295u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u,
+	11, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u,
+	1, 4293322470u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 3, 4294967295u, 1, 4294704123u, 2, 4278190080u, 4, 0u,
+	2, 4278190080u, 1, 4294572537u, 3, 4294967295u, 2, 4278190080u, 3, 4294967295u, 1, 4294572537u, 2, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u,
+	1, 4294835709u, 1, 4293322470u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	1, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u, 1, 4293322470u, 2, 4278190080u,
+	1, 0u, 1, 4278190080u, 10, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294572537u,
+	7, 4294967295u, 1, 4293519849u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 12, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294046193u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294046193u, 3, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 3, 4294967295u, 2, 4278190080u, 1, 0u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4292467161u, 2, 4294967295u, 1, 4292467161u, 2, 4278190080u, 11, 4294967295u, 2, 4278190080u, 5, 4294967295u, 2, 4278190080u,
+	1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 5, 4294967295u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	17, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4293059298u, 1, 4278190080u,
+	12, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 28, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	15, 0u, 1, 4278190080u, 1, 4293848814u, 2, 4294967295u, 1, 4294572537u, 1, 4294440951u, 1, 4294835709u, 1, 4278190080u,
+	10, 0u, 6, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 89, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4278190080u, 82, 0u,
+	1, 4278190080u, 1, 4294309365u, 3, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 16, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293848814u, 7, 4294967295u, 1, 4293519849u,
+	3, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 27, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4293059298u, 5, 4294967295u, 1, 4292796126u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u,
+	12, 0u, 2, 4278190080u, 1, 4294572537u, 7, 4294967295u, 1, 4293519849u, 2, 4278190080u, 7, 0u, 2, 4278190080u,
+	1, 4294572537u, 7, 4294967295u, 1, 4293519849u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 12, 4294967295u, 2, 4278190080u,
+	11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4292796126u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4294440951u, 1, 4292796126u, 1, 4278190080u, 1, 4294572537u, 1, 4292796126u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 57, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 8, 4294967295u, 1, 4278190080u, 3, 4294967295u,
+	1, 4294309365u, 3, 4278190080u, 1, 4294572537u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293717228u,
+	3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 11, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u,
+	2, 4294177779u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u,
+	1, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4293059298u, 5, 4294967295u, 1, 4293059298u, 1, 4278190080u, 21, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294440951u, 9, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4293519849u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 7, 4294967295u,
+	1, 4294177779u, 3, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 0u, 2, 4278190080u,
+	1, 4293519849u, 1, 4294835709u, 7, 4294967295u, 1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 14, 0u, 2, 4278190080u,
+	1, 4294572537u, 7, 4294967295u, 1, 4293519849u, 2, 4278190080u, 30, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u,
+	7, 4294967295u, 1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u,
+	1, 4293322470u, 5, 4294967295u, 1, 4293322470u, 1, 4278190080u, 5, 0u, 4, 4278190080u, 14, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u,
+	1, 4292467161u, 2, 4278190080u, 11, 0u, 2, 4278190080u, 1, 4294835709u, 11, 4294967295u, 1, 4278190080u, 46, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294835709u, 1, 4294704123u, 1, 4293059298u, 1, 4293322470u, 1, 4294835709u, 1, 4294704123u,
+	1, 4293059298u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 10, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4294046193u, 1, 4278190080u, 10, 0u,
+	1, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4294046193u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 1, 4293519849u,
+	3, 4294967295u, 1, 4294046193u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4294046193u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 2, 4278190080u, 1, 4294046193u,
+	6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294046193u, 6, 4294967295u,
+	1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294046193u, 6, 4294967295u, 1, 4294835709u,
+	1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	9, 4294967295u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4294704123u,
+	1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 3, 4294967295u, 1, 4294572537u, 2, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 4294967295u, 1, 4294572537u, 2, 4278190080u, 3, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u,
+	1, 4293322470u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u,
+	1, 4293322470u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u,
+	1, 4293322470u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u,
+	1, 4293322470u, 2, 4278190080u, 13, 0u, 1, 4278190080u, 10, 4294967295u, 1, 4294177779u, 3, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4292467161u,
+	1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u,
+	1, 4292467161u, 1, 4278190080u, 15, 0u, 12, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294177779u,
+	6, 4294967295u, 1, 4293322470u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u,
+	1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293059298u,
+	5, 4294967295u, 1, 4293059298u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4293059298u,
+	1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 14, 0u, 2, 4278190080u, 1, 4293717228u,
+	3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 17, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u,
+	1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 4, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 8, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 7, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u,
+	2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u,
+	2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 1, 4292467161u, 1, 4294440951u,
+	1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294835709u, 1, 4294704123u,
+	1, 4293059298u, 1, 4293322470u, 1, 4294835709u, 1, 4294704123u, 1, 4293059298u, 2, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294572537u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 18, 0u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u,
+	1, 4293717228u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294835709u, 2, 4292796126u, 1, 4294835709u, 1, 4278190080u,
+	7, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294835709u, 1, 4294704123u, 1, 4293059298u, 1, 4293322470u, 1, 4294835709u,
+	1, 4294704123u, 1, 4293059298u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u, 2, 4294572537u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u,
+	2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294572537u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u,
+	1, 4294704123u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u,
+	1, 4278190080u, 2, 4294967295u, 1, 4292467161u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 3, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294046193u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294177779u, 4, 4278190080u, 1, 4294309365u, 1, 4294704123u,
+	2, 4278190080u, 1, 0u, 5, 4278190080u, 1, 4293848814u, 1, 4294967295u, 6, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 27, 0u, 2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294835709u, 1, 4293717228u, 2, 4278190080u, 1, 4292467161u, 1, 4293848814u, 2, 4294967295u,
+	1, 4293322470u, 1, 4278190080u, 1, 0u, 3, 4278190080u, 1, 4293059298u, 1, 4294704123u, 3, 4294967295u, 1, 4278190080u,
+	5, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294309365u, 2, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293848814u, 2, 4294967295u,
+	1, 4293848814u, 1, 4292467161u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u,
+	5, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293848814u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 9, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294835709u, 1, 4294967295u, 1, 4294440951u, 1, 4293322470u, 2, 4278190080u, 1, 4292467161u, 1, 4293848814u, 2, 4294967295u,
+	1, 4293848814u, 10, 4278190080u, 1, 4293519849u, 1, 4294572537u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294440951u, 1, 4293322470u, 2, 4278190080u,
+	1, 4292467161u, 1, 4293848814u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 16, 0u, 5, 4278190080u,
+	13, 0u, 5, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294572537u, 1, 4292796126u,
+	2, 4278190080u, 1, 4293717228u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 0u, 2, 4278190080u,
+	1, 4293519849u, 2, 4294967295u, 1, 4294440951u, 1, 4293519849u, 3, 4278190080u, 1, 4292796126u, 1, 4293848814u, 1, 4294835709u,
+	1, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4294440951u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 5, 4278190080u,
+	1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294835709u, 1, 4293717228u, 2, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294572537u,
+	3, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4293322470u, 1, 4294572537u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 11, 4278190080u, 2, 4294967295u, 10, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 1, 4294967295u, 1, 4294046193u, 1, 4292796126u, 2, 4278190080u, 1, 4293322470u,
+	1, 4294440951u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u,
+	2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u,
+	1, 4294704123u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4294572537u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u,
+	1, 4294967295u, 1, 4294440951u, 1, 4292796126u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4292796126u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4293519849u, 1, 4294835709u, 1, 4294967295u,
+	1, 4293519849u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 1, 4294967295u, 1, 4294440951u,
+	1, 4292796126u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 6, 4278190080u, 1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294309365u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 6, 4278190080u, 2, 4294967295u, 7, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4292796126u, 1, 4294967295u,
+	1, 4294704123u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4293059298u, 3, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 3, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4294309365u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293848814u, 11, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 6, 4278190080u, 2, 4294835709u, 2, 4278190080u,
+	8, 0u, 4, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294704123u, 1, 4292467161u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 18, 0u, 3, 4278190080u,
+	1, 4292467161u, 1, 4293848814u, 1, 4294309365u, 1, 4278190080u, 12, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	28, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 15, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4292467161u, 4, 4278190080u, 9, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 8, 0u, 4, 4278190080u, 4, 0u, 5, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 89, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	82, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4293848814u, 3, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4293848814u,
+	2, 4294967295u, 1, 4278190080u, 16, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293717228u, 2, 4294967295u,
+	1, 4293848814u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 2, 4294967295u, 1, 4292467161u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4278190080u, 27, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u,
+	1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 3, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294046193u, 2, 4278190080u,
+	12, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294309365u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u,
+	1, 0u, 6, 4278190080u, 2, 4294967295u, 15, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294309365u, 10, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4292796126u, 1, 4294440951u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4292796126u, 1, 4294572537u, 1, 4278190080u,
+	1, 4292796126u, 1, 4294440951u, 1, 4278190080u, 57, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 5, 4278190080u, 2, 4294967295u, 4, 4278190080u, 2, 4294967295u,
+	1, 4294572537u, 1, 4294967295u, 2, 4278190080u, 1, 4292467161u, 1, 4294704123u, 2, 4294967295u, 1, 4278190080u, 2, 0u,
+	2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 12, 0u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294704123u,
+	1, 4293059298u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u,
+	6, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 3, 0u, 2, 4278190080u,
+	1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u,
+	1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 2, 4278190080u, 21, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 1, 4293519849u, 1, 4294572537u,
+	2, 4294967295u, 1, 4294572537u, 1, 4293519849u, 1, 4292796126u, 1, 4294835709u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4294440951u, 1, 4293059298u, 2, 4278190080u, 1, 4292467161u, 1, 4293848814u, 1, 4294835709u, 1, 4294967295u, 1, 4293717228u,
+	8, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4294440951u, 1, 4293322470u, 3, 4278190080u,
+	1, 4293322470u, 1, 4294440951u, 2, 4294967295u, 1, 4293519849u, 2, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 29, 0u, 2, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4294440951u, 1, 4293322470u, 3, 4278190080u,
+	1, 4293322470u, 1, 4294440951u, 2, 4294967295u, 1, 4293519849u, 2, 4278190080u, 1, 0u, 9, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 14, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u,
+	3, 4278190080u, 12, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 46, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4293848814u, 2, 4278190080u,
+	1, 4294309365u, 1, 4293848814u, 3, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 4, 0u, 4, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	6, 4278190080u, 1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 9, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 9, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 9, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294835709u, 1, 4293717228u,
+	2, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4293519849u, 1, 4294967295u, 1, 4294835709u, 1, 4293717228u, 2, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294572537u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294835709u, 1, 4293717228u,
+	2, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 2, 4294967295u, 11, 4278190080u,
+	2, 4294967295u, 10, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 11, 4278190080u, 2, 4294967295u, 10, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4293322470u, 1, 4294572537u, 1, 4294967295u, 1, 4294835709u,
+	1, 4292467161u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4293322470u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4294572537u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4294572537u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 1, 4294967295u, 1, 4294440951u, 1, 4292796126u, 2, 4278190080u,
+	1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294835709u, 1, 4294967295u, 1, 4294440951u, 1, 4292796126u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u,
+	1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 1, 4294967295u, 1, 4294440951u,
+	1, 4292796126u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 1, 4294967295u, 1, 4294440951u, 1, 4292796126u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294309365u, 2, 4294967295u, 1, 4292796126u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 2, 4294967295u, 6, 4278190080u,
+	1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294309365u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 15, 0u,
+	5, 4278190080u, 2, 4294967295u, 6, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293059298u, 2, 4294967295u, 1, 4293717228u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u,
+	3, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u,
+	1, 4294704123u, 1, 4293519849u, 2, 4278190080u, 4, 0u, 7, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 16, 0u,
+	2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 18, 0u, 7, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u,
+	3, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 7, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u, 3, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u,
+	3, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4293848814u, 2, 4278190080u,
+	1, 4294309365u, 1, 4293848814u, 3, 4278190080u, 5, 0u, 7, 4278190080u, 8, 0u, 4, 4278190080u, 7, 0u,
+	2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293519849u,
+	2, 4294835709u, 1, 4293519849u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u,
+	3, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4293848814u, 2, 4278190080u, 1, 4294309365u, 1, 4293848814u,
+	3, 4278190080u, 4, 0u, 7, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294046193u, 1, 4292467161u,
+	3, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 5, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 2, 4294572537u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294704123u, 1, 4294177779u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u,
+	1, 4294835709u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 6, 0u, 1, 4278190080u,
+	2, 4294967295u, 4, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294177779u,
+	1, 4292467161u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4293848814u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 27, 0u, 1, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u,
+	5, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294704123u, 3, 4278190080u, 1, 4293059298u, 1, 4294440951u, 1, 4294967295u,
+	1, 4294835709u, 1, 4293519849u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u,
+	1, 4294704123u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294046193u, 1, 4294704123u, 1, 4293322470u, 5, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 9, 0u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 6, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294046193u, 1, 4278190080u,
+	7, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292467161u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294309365u, 6, 4278190080u, 1, 4292796126u,
+	1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 9, 4278190080u, 6, 0u, 3, 4278190080u, 1, 4292467161u, 1, 4294177779u,
+	1, 4294835709u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294177779u, 1, 4292467161u, 3, 4278190080u,
+	6, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294704123u, 5, 4278190080u, 1, 4293519849u, 1, 4294967295u,
+	1, 4294572537u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4293717228u, 3, 4278190080u,
+	1, 0u, 4, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 4, 0u, 2, 4278190080u,
+	2, 4294967295u, 1, 4292467161u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293322470u, 5, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 3, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293717228u, 6, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294046193u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4294177779u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4294177779u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294704123u, 3, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 5, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293717228u,
+	3, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294046193u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 8, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294835709u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 11, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 19, 0u, 5, 4278190080u, 2, 0u, 9, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 7, 4278190080u, 4, 0u, 8, 4278190080u, 4, 0u, 7, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 8, 4278190080u, 2, 0u, 3, 4278190080u, 2, 4294967295u, 4, 4278190080u, 4, 0u,
+	7, 4278190080u, 1, 4293848814u, 3, 4294967295u, 2, 4278190080u, 2, 4294967295u, 8, 4278190080u, 1, 0u, 4, 4278190080u,
+	4, 0u, 5, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 6, 4278190080u, 2, 4294967295u, 18, 4278190080u,
+	1, 0u, 11, 4278190080u, 3, 0u, 9, 4278190080u, 2, 0u, 10, 4278190080u, 4, 0u, 18, 4278190080u,
+	1, 0u, 8, 4278190080u, 3, 0u, 3, 4278190080u, 2, 4294967295u, 4, 4278190080u, 1, 0u, 4, 4278190080u,
+	4, 0u, 9, 4278190080u, 2, 0u, 10, 4278190080u, 1, 0u, 5, 4278190080u, 2, 0u, 9, 4278190080u,
+	2, 0u, 5, 4278190080u, 1, 0u, 4, 4278190080u, 4, 0u, 4, 4278190080u, 1, 0u, 10, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	1, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 16, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 5, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4278190080u, 27, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4292467161u,
+	1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 5, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 5, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 12, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294835709u, 3, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294046193u, 1, 4293519849u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294046193u, 1, 4293519849u, 1, 4278190080u, 1, 4294046193u,
+	1, 4293519849u, 1, 4278190080u, 57, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4293717228u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4293519849u,
+	1, 4294046193u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 8, 4278190080u, 9, 0u, 8, 4278190080u, 3, 0u,
+	3, 4278190080u, 2, 4294967295u, 5, 4278190080u, 2, 0u, 10, 4278190080u, 2, 0u, 10, 4278190080u, 4, 0u,
+	5, 4278190080u, 4, 0u, 7, 4278190080u, 22, 0u, 1, 4278190080u, 2, 4294967295u, 4, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 10, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 4, 0u,
+	2, 4278190080u, 2, 4294967295u, 1, 4292467161u, 2, 4294967295u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 6, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4293519849u, 7, 4278190080u, 1, 4293519849u,
+	2, 4294967295u, 1, 4293519849u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u,
+	5, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 29, 0u, 1, 4278190080u, 1, 4293519849u,
+	2, 4294967295u, 1, 4293519849u, 7, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4293519849u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294835709u, 3, 4278190080u, 2, 4294967295u, 3, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 14, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 5, 4278190080u, 3, 0u, 4, 4278190080u, 3, 0u, 5, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 16, 0u, 9, 4278190080u,
+	4, 0u, 8, 4278190080u, 11, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294177779u, 2, 4278190080u,
+	3, 0u, 8, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 4294177779u, 2, 4278190080u,
+	1, 0u, 11, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294572537u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4292467161u, 2, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 8, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4292467161u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u,
+	8, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4292467161u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u, 8, 0u,
+	2, 4278190080u, 2, 4294967295u, 1, 4292467161u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293322470u, 5, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293322470u, 5, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293322470u, 5, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 3, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 3, 4278190080u, 2, 4294967295u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 4, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 4, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 4, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 7, 4278190080u,
+	2, 0u, 6, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294572537u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 20, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293848814u, 4, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 8, 4278190080u, 4, 0u, 9, 4278190080u, 2, 0u, 11, 4278190080u,
+	2, 0u, 9, 4278190080u, 3, 0u, 9, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 8, 4278190080u, 4, 0u, 8, 4278190080u, 4, 0u, 8, 4278190080u, 5, 0u, 8, 4278190080u,
+	5, 0u, 8, 4278190080u, 5, 0u, 8, 4278190080u, 5, 0u, 8, 4278190080u, 2, 0u, 5, 4278190080u,
+	3, 0u, 11, 4278190080u, 2, 0u, 7, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294177779u, 2, 4278190080u,
+	2, 0u, 7, 4278190080u, 2, 4294967295u, 14, 4278190080u, 1, 0u, 11, 4278190080u, 3, 0u, 9, 4278190080u,
+	3, 0u, 11, 4278190080u, 2, 0u, 10, 4278190080u, 4, 0u, 9, 4278190080u, 7, 0u, 1, 4278190080u,
+	2, 4294572537u, 1, 4278190080u, 6, 0u, 8, 4278190080u, 2, 0u, 36, 4278190080u, 1, 0u, 4, 4278190080u,
+	4, 0u, 19, 4278190080u, 2, 4294967295u, 4, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 2, 4294440951u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 3, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4294046193u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294046193u, 3, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 3, 4278190080u, 2, 4294967295u, 6, 4278190080u, 2, 4294967295u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	3, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u,
+	2, 4294704123u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294704123u, 3, 4278190080u, 1, 4294704123u,
+	2, 4294967295u, 1, 4294177779u, 1, 4293519849u, 1, 4294967295u, 1, 4293059298u, 1, 4294177779u, 2, 4294967295u, 1, 4294704123u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 26, 0u, 2, 4278190080u, 2, 4294835709u,
+	2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 3, 0u,
+	2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 2, 4278190080u, 2, 4294967295u, 1, 4294440951u, 1, 4292467161u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 5, 4278190080u, 3, 0u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293322470u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u,
+	7, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 4, 0u,
+	5, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4293848814u, 2, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u,
+	1, 4293717228u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 3, 4278190080u,
+	1, 4293059298u, 1, 4294177779u, 2, 4294967295u, 1, 4294835709u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294835709u,
+	2, 4294967295u, 1, 4294177779u, 1, 4293059298u, 3, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293519849u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4293519849u, 10, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4293519849u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4293848814u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294704123u, 1, 4294046193u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292796126u, 2, 4294835709u,
+	1, 4292796126u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4292796126u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293717228u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294704123u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294704123u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294704123u, 1, 4294046193u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u,
+	1, 4294046193u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294046193u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4293519849u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294704123u, 4, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 8, 0u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u, 3, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4293322470u, 1, 4278190080u, 25, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294572537u, 2, 4294967295u, 1, 4294835709u,
+	1, 4294309365u, 1, 4293059298u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293848814u, 1, 4294835709u, 1, 4294967295u,
+	1, 4294704123u, 1, 4293519849u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u,
+	1, 4294704123u, 1, 4293848814u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u,
+	1, 4294835709u, 1, 4293848814u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 3, 4278190080u, 1, 4294177779u,
+	1, 4294704123u, 1, 4294967295u, 1, 4294835709u, 1, 4294309365u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u,
+	7, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u, 1, 4294835709u,
+	1, 4294309365u, 1, 4294704123u, 1, 4293322470u, 4, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4292796126u, 1, 4294309365u,
+	2, 4294967295u, 1, 4294309365u, 1, 4292796126u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293322470u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294835709u, 1, 4293848814u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u,
+	1, 4293322470u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 2, 4294967295u, 1, 4294309365u,
+	1, 4292796126u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294835709u, 1, 4294967295u,
+	1, 4294835709u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294704123u, 1, 4293717228u, 2, 4278190080u, 2, 0u, 2, 4278190080u,
+	1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294835709u, 1, 4294046193u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 3, 4278190080u, 1, 4293059298u,
+	1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 7, 4294967295u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294835709u, 2, 4294967295u, 4, 4278190080u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294046193u, 4, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 8, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	16, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	3, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u,
+	22, 0u, 6, 4278190080u, 2, 4294967295u, 12, 4278190080u, 2, 4294967295u, 7, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 14, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294704123u, 1, 4294046193u, 1, 4278190080u,
+	7, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294704123u,
+	1, 4294046193u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 11, 0u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 23, 4278190080u, 1, 0u, 7, 4278190080u, 49, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4292467161u,
+	1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 4294309365u, 1, 4292796126u, 2, 4294967295u, 3, 4278190080u, 1, 4293059298u,
+	1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 2, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4293059298u,
+	1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 7, 4294967295u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 8, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 8, 4294967295u,
+	1, 4278190080u, 42, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4292796126u, 1, 4278190080u, 5, 0u,
+	2, 4278190080u, 1, 4292796126u, 2, 4294967295u, 1, 4294572537u, 1, 4293322470u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u,
+	2, 4294967295u, 1, 4292796126u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 3, 4278190080u, 1, 0u,
+	5, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 1, 4293059298u,
+	1, 4294572537u, 1, 4294967295u, 1, 4294835709u, 1, 4294046193u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 12, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294704123u, 1, 4294046193u, 1, 4278190080u, 28, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u,
+	2, 4278190080u, 4, 4294967295u, 1, 4294440951u, 1, 4292796126u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294704123u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 14, 0u, 1, 4278190080u, 2, 4294967295u,
+	3, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 15, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294572537u, 2, 4294967295u, 1, 4294835709u, 1, 4294309365u,
+	1, 4293059298u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u,
+	1, 4294177779u, 2, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294704123u, 1, 4293059298u,
+	1, 4278190080u, 15, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4294704123u, 1, 4293059298u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 8, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u,
+	1, 4294309365u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	1, 4293519849u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4293717228u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4294309365u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4293848814u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u,
+	3, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u,
+	4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294704123u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 2, 4278190080u,
+	1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4293322470u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 4, 0u, 2, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 4, 4278190080u,
+	1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u, 4, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 21, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 3, 4278190080u, 1, 4292467161u, 1, 4294967295u,
+	1, 4294835709u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293322470u, 1, 4294704123u,
+	1, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294572537u, 2, 4294967295u, 1, 4294835709u,
+	1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294572537u, 2, 4294967295u,
+	1, 4294835709u, 1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294572537u,
+	2, 4294967295u, 1, 4294835709u, 1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293848814u,
+	1, 4294572537u, 2, 4294967295u, 1, 4294835709u, 1, 4294309365u, 1, 4293059298u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4293848814u, 2, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4293848814u, 2, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4293848814u, 2, 4278190080u,
+	2, 0u, 3, 4278190080u, 1, 4294177779u, 1, 4294704123u, 1, 4294967295u, 1, 4294835709u, 1, 4294309365u, 1, 4292796126u,
+	2, 4278190080u, 2, 0u, 3, 4278190080u, 1, 4294177779u, 1, 4294704123u, 1, 4294967295u, 1, 4294835709u, 1, 4294309365u,
+	1, 4292796126u, 2, 4278190080u, 2, 0u, 3, 4278190080u, 1, 4294177779u, 1, 4294704123u, 1, 4294967295u, 1, 4294835709u,
+	1, 4294309365u, 1, 4292796126u, 2, 4278190080u, 2, 0u, 3, 4278190080u, 1, 4294177779u, 1, 4294704123u, 1, 4294967295u,
+	1, 4294835709u, 1, 4294309365u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u,
+	1, 4294967295u, 1, 4294835709u, 1, 4293848814u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294704123u, 1, 4293059298u,
+	1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294835709u, 1, 4293848814u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293059298u,
+	1, 4294572537u, 2, 4294967295u, 1, 4294309365u, 1, 4292796126u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293059298u,
+	1, 4294572537u, 2, 4294967295u, 1, 4294309365u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292467161u,
+	1, 4294177779u, 1, 4294835709u, 1, 4294967295u, 1, 4294835709u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u, 2, 0u,
+	2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294835709u, 1, 4294967295u, 1, 4294835709u, 1, 4294177779u, 1, 4292796126u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294835709u, 1, 4294967295u, 1, 4294835709u,
+	1, 4294177779u, 1, 4292796126u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294835709u,
+	1, 4294967295u, 1, 4294835709u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294572537u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u,
+	2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 7, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	2, 4294440951u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 12, 4294967295u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 3, 4278190080u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u,
+	1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293848814u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4292796126u, 3, 4278190080u, 1, 4293059298u, 1, 4293848814u, 1, 4294309365u, 3, 4294967295u,
+	1, 4294309365u, 1, 4293848814u, 1, 4293059298u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	26, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 1, 4294440951u, 1, 4293059298u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4294046193u, 1, 4294704123u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	7, 0u, 3, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 3, 0u, 2, 4278190080u,
+	1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 2, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4293848814u, 3, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294046193u, 9, 4278190080u, 7, 0u, 2, 4278190080u,
+	1, 4294046193u, 1, 4294835709u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u,
+	5, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 3, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u,
+	1, 4294572537u, 1, 4293519849u, 17, 4278190080u, 1, 4293519849u, 1, 4294572537u, 2, 4294967295u, 1, 4294440951u, 1, 4293519849u,
+	3, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 3, 0u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294309365u, 2, 4294967295u, 1, 4294046193u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294835709u, 1, 4294440951u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294046193u,
+	1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 5, 0u,
+	6, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4292796126u,
+	2, 4294835709u, 1, 4292796126u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 2, 0u,
+	5, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293322470u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294309365u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 7, 0u,
+	2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 10, 0u,
+	1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 23, 0u, 2, 4278190080u, 1, 4294704123u,
+	7, 4294967295u, 1, 4292796126u, 2, 4278190080u, 2, 4294967295u, 1, 4294177779u, 5, 4294967295u, 1, 4294046193u, 2, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4293519849u, 5, 4294967295u,
+	1, 4294177779u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u,
+	1, 4293322470u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 7, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u,
+	1, 4294572537u, 6, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4292796126u,
+	1, 4294835709u, 4, 4294967295u, 1, 4294835709u, 1, 4292467161u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294177779u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4293519849u, 5, 4294967295u,
+	1, 4293848814u, 1, 4293322470u, 5, 4294967295u, 1, 4293322470u, 2, 4278190080u, 2, 4294967295u, 1, 4293519849u, 5, 4294967295u,
+	1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 5, 4294967295u,
+	1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4292796126u, 5, 4294967295u,
+	1, 4294046193u, 4, 4278190080u, 1, 4293717228u, 5, 4294967295u, 1, 4294177779u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4293059298u, 3, 4294967295u, 2, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294835709u, 2, 4278190080u,
+	1, 0u, 1, 4278190080u, 7, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294046193u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293519849u, 3, 4278190080u, 3, 4294967295u, 1, 4292467161u, 2, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294177779u,
+	3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 8, 4294967295u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 8, 4278190080u, 2, 0u,
+	5, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	3, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293322470u, 11, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 22, 0u,
+	1, 4278190080u, 12, 4294967295u, 2, 4278190080u, 12, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 3, 4278190080u,
+	1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 14, 0u,
+	1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 2, 0u, 5, 4278190080u, 7, 0u,
+	1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 2, 0u, 5, 4278190080u, 6, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294046193u,
+	2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4278190080u, 22, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293322470u,
+	2, 4278190080u, 48, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292467161u, 1, 4294704123u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294835709u, 2, 4278190080u, 6, 0u, 1, 4278190080u,
+	1, 4293322470u, 6, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 7, 4294967295u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 8, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 8, 4294967295u, 1, 4278190080u,
+	42, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293322470u, 1, 4294835709u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 6, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294046193u, 2, 4294967295u, 1, 4294572537u, 1, 4293519849u, 4, 4278190080u, 10, 0u, 1, 4278190080u,
+	1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4292796126u, 5, 4294967295u, 1, 4293848814u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 12, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4293059298u, 2, 4278190080u, 2, 0u, 5, 4278190080u, 28, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4294440951u, 3, 4278190080u, 5, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293322470u, 5, 4294967295u, 1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 14, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4292796126u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 14, 0u, 2, 4278190080u, 1, 4294704123u,
+	7, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 5, 4278190080u, 15, 0u, 1, 4278190080u, 2, 4294967295u,
+	4, 4278190080u, 2, 0u, 1, 4278190080u, 8, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294835709u, 1, 4294440951u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294440951u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294440951u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4294835709u,
+	1, 4292796126u, 2, 4278190080u, 1, 4292796126u, 1, 4294835709u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 21, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4293519849u,
+	1, 4294704123u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4293059298u,
+	3, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294704123u, 7, 4294967295u, 1, 4292796126u, 3, 4278190080u,
+	1, 4294704123u, 7, 4294967295u, 1, 4292796126u, 3, 4278190080u, 1, 4294704123u, 7, 4294967295u, 1, 4292796126u, 3, 4278190080u,
+	1, 4294704123u, 7, 4294967295u, 1, 4292796126u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4293322470u, 6, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u, 1, 4293322470u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u, 1, 4293322470u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4292796126u, 1, 4294835709u, 6, 4294967295u, 1, 4293322470u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294835709u, 6, 4294967295u, 1, 4293322470u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293519849u, 5, 4294967295u,
+	1, 4294177779u, 2, 4294967295u, 5, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293519849u, 5, 4294967295u, 1, 4294177779u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4293519849u, 5, 4294967295u, 1, 4294835709u,
+	1, 4292796126u, 2, 4278190080u, 2, 4294967295u, 1, 4293519849u, 5, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 5, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 5, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 5, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 5, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u,
+	6, 0u, 4, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4293059298u, 3, 4294967295u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 7, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 2, 4294440951u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	1, 4293059298u, 11, 4294967295u, 1, 4294440951u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4294835709u, 1, 4293848814u, 1, 4292467161u, 2, 4294967295u, 3, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u,
+	1, 4293717228u, 1, 4294704123u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4293717228u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 1, 0u, 3, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 3, 4278190080u, 1, 0u, 6, 4278190080u, 2, 4294967295u, 6, 4278190080u,
+	20, 0u, 2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4292467161u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 5, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 4, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4292796126u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 4, 0u, 4, 4278190080u, 1, 4292467161u, 1, 4293519849u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294835709u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4294309365u, 6, 4294967295u, 1, 4294704123u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 1, 4293322470u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u,
+	1, 4292467161u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4293717228u, 2, 4294967295u, 1, 4294440951u, 1, 4293322470u, 1, 4278190080u, 1, 4293322470u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4292467161u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294835709u, 12, 4278190080u,
+	1, 4293717228u, 1, 4294704123u, 2, 4294967295u, 1, 4294177779u, 1, 4292796126u, 3, 4278190080u, 1, 0u, 1, 4278190080u,
+	11, 4294967295u, 1, 4278190080u, 1, 0u, 3, 4278190080u, 1, 4292796126u, 1, 4294177779u, 2, 4294967295u, 1, 4294704123u,
+	1, 4293519849u, 8, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 4, 4294967295u, 1, 4294835709u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4292467161u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	5, 4278190080u, 1, 4293322470u, 1, 4294835709u, 1, 4294572537u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 4, 0u, 6, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 2, 4294967295u, 8, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 9, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u,
+	1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 8, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294835709u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u,
+	1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4293848814u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u, 6, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294046193u, 3, 4278190080u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293059298u, 3, 4294967295u, 1, 4293059298u,
+	1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4292467161u, 1, 4294835709u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u,
+	2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294835709u,
+	2, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u,
+	2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 23, 0u,
+	1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4293322470u, 2, 4278190080u, 1, 4292796126u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 3, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4293717228u, 2, 4294967295u,
+	1, 4293059298u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293322470u, 2, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293717228u,
+	1, 4294835709u, 2, 4294967295u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294046193u, 1, 4292467161u, 2, 4278190080u,
+	1, 4293717228u, 1, 4294967295u, 1, 4294835709u, 5, 4278190080u, 2, 4294967295u, 4, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4293322470u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294177779u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4294440951u, 1, 4292796126u, 1, 4278190080u,
+	1, 4292796126u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u,
+	2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4294704123u, 1, 4293519849u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294572537u, 1, 4294967295u, 2, 4294835709u, 1, 4293848814u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294572537u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 3, 4294967295u, 1, 4294046193u, 1, 4292467161u, 1, 4278190080u,
+	1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294309365u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294309365u,
+	1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 1, 4294967295u, 1, 4294835709u, 3, 4278190080u, 2, 4294967295u,
+	1, 4294440951u, 1, 4294046193u, 2, 4278190080u, 1, 4293717228u, 2, 4294967295u, 1, 4292467161u, 2, 4278190080u, 1, 4292467161u,
+	2, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4294440951u,
+	1, 4294309365u, 1, 4292796126u, 3, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4293059298u,
+	1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 0u, 3, 4278190080u, 2, 4294967295u, 4, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293717228u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4293059298u, 3, 4294967295u,
+	1, 4293059298u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 0u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4294177779u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4292467161u, 1, 4294440951u, 1, 4294967295u, 1, 4294704123u, 1, 4294046193u, 1, 4292467161u, 4, 4278190080u, 1, 4293717228u,
+	1, 4294046193u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u,
+	22, 0u, 1, 4278190080u, 12, 4294967295u, 2, 4278190080u, 12, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4294046193u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 15, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u,
+	6, 4278190080u, 4, 0u, 4, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294835709u,
+	1, 4293519849u, 6, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294704123u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 22, 0u, 1, 4278190080u, 1, 4293322470u, 5, 4294967295u,
+	1, 4293322470u, 1, 4278190080u, 48, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 1, 4294177779u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4293059298u,
+	1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 0u, 4, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 1, 0u, 3, 4278190080u, 2, 4294967295u, 4, 4278190080u, 3, 0u, 6, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 0u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 42, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4293717228u, 2, 4294967295u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294046193u, 3, 4294967295u, 1, 4294835709u, 1, 4294177779u, 1, 4293322470u,
+	3, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293322470u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 12, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294835709u,
+	1, 4293519849u, 6, 4278190080u, 4, 0u, 7, 4278190080u, 19, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293322470u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u,
+	2, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u,
+	1, 4294704123u, 1, 4293322470u, 8, 4278190080u, 2, 4294967295u, 6, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4292796126u, 1, 4294835709u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 14, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u,
+	1, 4293322470u, 2, 4278190080u, 1, 4292796126u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294177779u, 1, 4278190080u, 1, 0u, 7, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	19, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 4, 0u, 6, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4292796126u, 1, 4278190080u, 4, 0u, 6, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u,
+	4, 0u, 6, 4278190080u, 2, 4294967295u, 8, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 8, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 8, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 8, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294572537u, 3, 4278190080u, 2, 4294967295u, 5, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294572537u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293848814u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4292796126u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u,
+	1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u,
+	1, 4294704123u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 3, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294835709u, 2, 4292796126u, 1, 4294835709u, 1, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4292467161u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 22, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 3, 4294967295u,
+	1, 4278190080u, 1, 4293848814u, 2, 4294967295u, 1, 4294704123u, 1, 4293717228u, 2, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4294440951u, 1, 4294309365u, 1, 4292796126u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294572537u, 1, 4293322470u, 2, 4278190080u, 1, 4292796126u, 1, 4294572537u, 1, 4294967295u, 1, 4294309365u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4293322470u, 2, 4278190080u, 1, 4292796126u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4293322470u, 2, 4278190080u,
+	1, 4292796126u, 1, 4294572537u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u,
+	1, 4293322470u, 2, 4278190080u, 1, 4292796126u, 1, 4294572537u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293322470u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u,
+	1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4293322470u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u,
+	2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4293322470u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4294046193u, 1, 4292467161u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294835709u, 4, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4294046193u, 1, 4292467161u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294835709u, 4, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4294046193u, 1, 4292467161u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294835709u,
+	4, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294046193u, 1, 4292467161u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4294835709u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293717228u, 1, 4294835709u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4293848814u, 2, 4278190080u,
+	1, 4293717228u, 1, 4294835709u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 3, 4294967295u, 1, 4294046193u,
+	1, 4292467161u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 3, 4294967295u,
+	1, 4294046193u, 1, 4292467161u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294309365u, 3, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4294309365u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 1, 4294967295u,
+	1, 4294835709u, 4, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294309365u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294835709u, 4, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294309365u, 1, 4292467161u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 1, 4294967295u, 1, 4294835709u, 4, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4294309365u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 1, 4294967295u, 1, 4294835709u, 16, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4294440951u, 1, 4294309365u, 1, 4292796126u, 2, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u, 4, 4278190080u, 2, 4294967295u, 4, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 2, 4294440951u, 12, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4292796126u, 3, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294177779u, 5, 4294967295u, 1, 4294704123u,
+	1, 4293848814u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 5, 4294967295u, 1, 4292796126u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294309365u, 6, 4278190080u, 2, 0u, 3, 4278190080u, 1, 4293322470u, 1, 4294572537u, 3, 4294967295u,
+	1, 4294704123u, 1, 4292796126u, 11, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 12, 4294967295u, 1, 4278190080u, 20, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 13, 0u, 2, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 5, 4294967295u, 1, 4294572537u, 1, 4293322470u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294704123u, 2, 4294967295u, 1, 4294309365u,
+	1, 4292796126u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 1, 4294967295u, 1, 4294835709u, 3, 4278190080u, 2, 4294967295u,
+	1, 4292467161u, 1, 4294177779u, 6, 4294967295u, 1, 4294835709u, 1, 4293322470u, 2, 4278190080u, 4, 0u, 2, 4278190080u,
+	1, 4294177779u, 1, 4294835709u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294046193u, 6, 4294967295u, 1, 4294046193u,
+	3, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294309365u, 6, 4278190080u, 1, 4292796126u,
+	3, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294835709u, 1, 4294967295u, 1, 4294704123u,
+	1, 4293717228u, 4, 4278190080u, 3, 0u, 1, 4278190080u, 11, 4294967295u, 1, 4278190080u, 3, 0u, 4, 4278190080u,
+	1, 4293717228u, 1, 4294704123u, 1, 4294967295u, 1, 4294835709u, 1, 4293848814u, 1, 4278190080u, 5, 0u, 3, 4278190080u,
+	1, 4293848814u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294572537u, 1, 4292467161u, 1, 4278190080u, 1, 4293059298u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u,
+	3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 8, 4294967295u,
+	1, 4294440951u, 3, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 9, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 9, 4294967295u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 10, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 0u, 9, 4278190080u, 12, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4292796126u, 2, 4294835709u, 1, 4294177779u, 1, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	6, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4293717228u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 6, 4278190080u, 1, 4293848814u, 2, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 0u,
+	2, 4278190080u, 1, 4294572537u, 3, 4294967295u, 1, 4294704123u, 1, 4294309365u, 1, 4293848814u, 1, 4292796126u, 3, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293717228u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u,
+	7, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 2, 4294309365u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u,
+	7, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u,
+	9, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 23, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294835709u, 1, 4292467161u, 4, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u,
+	2, 4294967295u, 1, 4293717228u, 4, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294309365u, 4, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294046193u,
+	1, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4293717228u, 2, 4294967295u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4293848814u, 5, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 4, 4278190080u,
+	1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4294572537u,
+	4, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u,
+	2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4293519849u, 3, 4278190080u,
+	1, 4292796126u, 2, 4294967295u, 1, 4294046193u, 3, 4278190080u, 1, 4292796126u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4294046193u, 4, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4294309365u, 5, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 2, 4294967295u, 1, 4294309365u,
+	4, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u,
+	4, 4278190080u, 1, 4293717228u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4294440951u, 3, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 4, 4278190080u, 1, 4293059298u, 1, 4294835709u, 1, 4294309365u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294704123u,
+	2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294704123u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294046193u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4293059298u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294572537u, 4, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 4, 4278190080u, 1, 4294835709u, 5, 4294967295u, 1, 4294177779u,
+	1, 4292796126u, 1, 4278190080u, 1, 4293519849u, 1, 4294835709u, 1, 4294177779u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 9, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 22, 0u, 6, 4278190080u, 2, 4294967295u, 12, 4278190080u,
+	2, 4294967295u, 7, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 2, 4278190080u, 1, 4292796126u, 5, 4294967295u, 1, 4292796126u, 1, 4293848814u, 1, 4294967295u, 1, 4294309365u,
+	6, 4278190080u, 2, 0u, 7, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294572537u, 3, 4294967295u, 1, 4294704123u,
+	1, 4294309365u, 1, 4293848814u, 1, 4292796126u, 3, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u,
+	1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294572537u, 3, 4294967295u, 1, 4294704123u, 1, 4294309365u, 1, 4293848814u,
+	1, 4292796126u, 3, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 22, 0u, 1, 4278190080u, 1, 4294704123u, 5, 4294967295u,
+	1, 4294704123u, 1, 4278190080u, 48, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4293322470u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 4, 4278190080u, 1, 4293059298u, 1, 4294835709u, 1, 4294309365u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	4, 4278190080u, 1, 4293059298u, 1, 4294835709u, 1, 4294309365u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 9, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 5, 0u,
+	2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 41, 0u, 2, 4278190080u, 3, 4294967295u,
+	1, 4294835709u, 1, 4293059298u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 4, 0u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u,
+	3, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4294835709u, 1, 4294704123u, 3, 4294967295u,
+	1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 2, 4294967295u,
+	1, 4292467161u, 7, 4278190080u, 2, 4294967295u, 1, 4278190080u, 12, 0u, 2, 4278190080u, 1, 4294572537u, 3, 4294967295u,
+	1, 4294704123u, 1, 4294309365u, 1, 4293848814u, 1, 4292796126u, 3, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294967295u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4278190080u, 19, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294835709u,
+	3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u,
+	1, 4278190080u, 4, 0u, 7, 4278190080u, 1, 0u, 1, 4278190080u, 12, 4294967295u, 1, 4278190080u, 8, 0u,
+	2, 4278190080u, 2, 4294967295u, 2, 4294835709u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293848814u, 6, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 14, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294835709u, 1, 4292467161u, 4, 4278190080u, 1, 4292467161u,
+	1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 4, 4278190080u, 1, 4293059298u,
+	1, 4294835709u, 1, 4294309365u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 19, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u,
+	3, 4278190080u, 2, 4294967295u, 6, 4278190080u, 1, 4293848814u, 2, 4294967295u, 1, 4293519849u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u,
+	3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 9, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 9, 0u,
+	1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 4294967295u,
+	1, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4292467161u,
+	1, 4294967295u, 1, 4294835709u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4292467161u,
+	1, 4294967295u, 1, 4294835709u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 6, 0u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 2, 4294835709u, 1, 4294967295u, 1, 4294835709u, 1, 4292796126u, 3, 4278190080u, 2, 4294967295u, 6, 4278190080u,
+	1, 4293848814u, 2, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	2, 4294309365u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 22, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 3, 4294967295u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293519849u, 3, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4294440951u, 3, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294835709u, 1, 4292467161u, 4, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294835709u, 1, 4292467161u, 4, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294835709u, 1, 4292467161u, 4, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294835709u, 1, 4292467161u, 4, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 4, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 4, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 4, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4293848814u, 5, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4293848814u, 5, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4293848814u, 5, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4293848814u, 5, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4293717228u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u,
+	1, 4293717228u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4294046193u, 4, 4278190080u,
+	1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 4294967295u, 1, 4294046193u, 4, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 5, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 5, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 5, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 5, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 12, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4294440951u, 3, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4293059298u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 2, 4294440951u, 1, 4278190080u, 9, 0u, 2, 4278190080u, 2, 4294967295u,
+	3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294177779u, 1, 4294704123u,
+	4, 4294967295u, 1, 4294572537u, 4, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293322470u,
+	1, 4292467161u, 2, 4294967295u, 1, 4292467161u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293322470u,
+	2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294440951u, 4, 4294967295u, 1, 4294440951u, 4, 4278190080u,
+	1, 4292467161u, 1, 4294835709u, 1, 4294309365u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294704123u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 12, 4294967295u, 1, 4278190080u, 4, 0u, 6, 4278190080u, 9, 0u, 2, 4278190080u,
+	2, 4294835709u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 12, 0u, 2, 4278190080u,
+	1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 5, 4294967295u, 1, 4294704123u,
+	1, 4293848814u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294835709u,
+	1, 4293519849u, 6, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 2, 4294967295u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u, 1, 4293322470u, 1, 4294440951u, 1, 4294967295u, 1, 4294835709u,
+	1, 4292467161u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u,
+	5, 0u, 3, 4278190080u, 1, 4294046193u, 6, 4294967295u, 1, 4294440951u, 1, 4292467161u, 3, 4278190080u, 1, 4292796126u,
+	2, 4294967295u, 1, 4294440951u, 1, 4293322470u, 2, 4278190080u, 1, 4292467161u, 1, 4293848814u, 1, 4294967295u, 1, 4294309365u,
+	2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4294177779u, 3, 4278190080u, 6, 0u,
+	13, 4278190080u, 6, 0u, 3, 4278190080u, 1, 4294177779u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u,
+	1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4294572537u, 1, 4292796126u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4292467161u, 3, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 9, 4294967295u, 1, 4294704123u, 1, 4292796126u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 9, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 10, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 6, 4294967295u, 2, 4278190080u, 12, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4292796126u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294177779u, 3, 4278190080u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 3, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 9, 4294967295u, 1, 4294177779u,
+	3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 10, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294309365u, 5, 4294967295u, 1, 4294440951u,
+	1, 4292796126u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4293322470u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4293848814u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4294046193u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294967295u, 1, 4294835709u,
+	1, 4292467161u, 1, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4294704123u, 2, 4294967295u, 1, 4294704123u, 2, 4278190080u,
+	7, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 3, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 8, 0u, 1, 4278190080u,
+	2, 4294967295u, 6, 4278190080u, 3, 0u, 5, 4278190080u, 23, 0u, 9, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u,
+	1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 2, 0u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 7, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 6, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4293322470u, 1, 4278190080u, 2, 0u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293059298u, 2, 4294967295u, 1, 4293519849u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 2, 4294967295u,
+	1, 4292796126u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 2, 4294967295u,
+	1, 4292467161u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4293322470u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293717228u,
+	7, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 2, 4294967295u, 4, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4292796126u,
+	2, 4294835709u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4293717228u, 2, 4278190080u, 1, 4294177779u, 1, 4294835709u, 1, 4293059298u, 1, 4278190080u, 1, 4292796126u, 1, 4294177779u,
+	5, 4294967295u, 1, 4294704123u, 3, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 3, 4278190080u, 2, 4294967295u, 6, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4278190080u, 27, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 3, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293322470u,
+	1, 4292467161u, 2, 4294967295u, 1, 4292467161u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293322470u,
+	4, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293322470u, 2, 4278190080u, 2, 0u,
+	2, 4278190080u, 1, 4293519849u, 1, 4294309365u, 5, 4294967295u, 1, 4294440951u, 1, 4292796126u, 4, 4278190080u, 1, 4294440951u,
+	1, 4294309365u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294309365u, 5, 4294967295u, 1, 4294440951u,
+	1, 4292796126u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 2, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4293848814u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 22, 0u, 1, 4278190080u, 7, 4294967295u, 14, 4278190080u,
+	17, 0u, 19, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294572537u, 1, 4294835709u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4293717228u, 7, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294440951u, 3, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4293717228u, 7, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	9, 0u, 1, 4278190080u, 1, 4292796126u, 2, 4294835709u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292796126u,
+	2, 4294835709u, 2, 4278190080u, 42, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4294572537u, 1, 4292467161u,
+	2, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 3, 0u, 4, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4292796126u, 1, 4294046193u, 1, 4294835709u,
+	2, 4294967295u, 1, 4293717228u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 6, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 13, 0u,
+	2, 4278190080u, 1, 4293519849u, 1, 4294309365u, 5, 4294967295u, 1, 4294440951u, 1, 4292796126u, 4, 4278190080u, 1, 4294440951u,
+	1, 4294309365u, 1, 4278190080u, 1, 4294440951u, 1, 4294309365u, 1, 4278190080u, 13, 0u, 7, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 5, 4294967295u, 1, 4293848814u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u,
+	12, 0u, 1, 4278190080u, 12, 4294967295u, 1, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4294177779u, 2, 4294967295u,
+	1, 4294046193u, 2, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	2, 4294967295u, 3, 4278190080u, 1, 4294046193u, 1, 4294835709u, 4, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	14, 0u, 9, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4293717228u, 7, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294440951u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294440951u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 19, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 1, 4292796126u, 2, 4294835709u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 10, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u,
+	1, 4294177779u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u,
+	1, 4294177779u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	9, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	9, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 8, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 3, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 3, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4294572537u, 2, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 10, 4294967295u, 1, 4294177779u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 2, 4294967295u,
+	1, 4294704123u, 2, 4278190080u, 23, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4294835709u, 1, 4293848814u, 3, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4293322470u, 1, 4278190080u, 5, 0u, 9, 4278190080u, 2, 4294967295u, 10, 4278190080u,
+	2, 4294967295u, 10, 4278190080u, 2, 4294967295u, 10, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4292467161u, 1, 4294835709u, 1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294440951u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 7, 4278190080u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	7, 4278190080u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 7, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 7, 4278190080u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 2, 0u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u, 2, 0u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u, 2, 0u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4293059298u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294440951u, 2, 4278190080u, 12, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4293322470u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 2, 4294309365u, 1, 4278190080u, 7, 0u,
+	3, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294572537u,
+	4, 4278190080u, 3, 0u, 4, 4278190080u, 2, 4294967295u, 1, 4292467161u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 1, 0u, 6, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293848814u, 1, 4293059298u, 5, 4294967295u,
+	1, 4292796126u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294704123u, 1, 4293717228u, 1, 4293059298u, 1, 4294835709u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 4290822336u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294440951u, 1, 4293322470u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294440951u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 6, 4278190080u, 2, 4294967295u,
+	6, 4278190080u, 4, 0u, 1, 4278190080u, 4, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 5, 0u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 11, 0u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 5, 0u, 5, 4278190080u, 1, 4293322470u,
+	1, 4294440951u, 1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 5, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 3, 4294967295u, 1, 4293519849u, 6, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u,
+	1, 4292796126u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294572537u, 1, 4294835709u, 1, 4294046193u,
+	1, 4292796126u, 1, 4278190080u, 1, 4293322470u, 1, 4294177779u, 2, 4294967295u, 1, 4294835709u, 1, 4292467161u, 3, 4278190080u,
+	1, 4293519849u, 1, 4294835709u, 6, 4294967295u, 1, 4294572537u, 1, 4292467161u, 2, 4294967295u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 1, 4293848814u, 1, 4294835709u, 1, 4294967295u, 1, 4294704123u, 1, 4293717228u, 4, 4278190080u, 3, 0u,
+	13, 4278190080u, 3, 0u, 4, 4278190080u, 1, 4293717228u, 1, 4294704123u, 1, 4294967295u, 1, 4294835709u, 1, 4293848814u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294835709u, 1, 4293848814u, 3, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 4, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292467161u, 4, 4278190080u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 6, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 8, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 9, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 6, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	8, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u,
+	1, 4294440951u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4292467161u, 2, 4294967295u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 6, 0u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 7, 4294967295u, 1, 4294572537u, 1, 4293519849u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 9, 4294967295u,
+	1, 4293322470u, 2, 4278190080u, 4, 0u, 4, 4278190080u, 1, 4292796126u, 1, 4293519849u, 1, 4294046193u, 1, 4294835709u,
+	1, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u,
+	1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u,
+	5, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	8, 0u, 1, 4278190080u, 1, 4293322470u, 2, 4294967295u, 1, 4293322470u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	7, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 37, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294440951u, 6, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 0u, 6, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	10, 4294967295u, 1, 4294835709u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4294572537u, 1, 4292796126u, 2, 4278190080u, 1, 4293059298u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4292796126u, 1, 4294835709u, 2, 4294967295u, 1, 4294440951u, 2, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4294440951u, 1, 4294046193u, 1, 4293322470u, 3, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u,
+	2, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4292467161u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293322470u,
+	2, 4294967295u, 1, 4294440951u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293059298u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294704123u, 1, 4292796126u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294177779u, 1, 4293717228u, 4, 4278190080u, 1, 4292467161u, 1, 4294046193u, 1, 4294704123u, 1, 4294967295u,
+	1, 4294309365u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 3, 4278190080u, 2, 4294967295u, 6, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 27, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 1, 0u, 6, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293848814u, 1, 4293059298u, 5, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 4293059298u, 5, 4294967295u,
+	1, 4292796126u, 1, 4278190080u, 3, 0u, 4, 4278190080u, 1, 4292796126u, 1, 4293519849u, 1, 4294046193u, 1, 4294835709u,
+	1, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u,
+	3, 0u, 4, 4278190080u, 1, 4292796126u, 1, 4293519849u, 1, 4294046193u, 1, 4294835709u, 1, 4294967295u, 1, 4294835709u,
+	1, 4292796126u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294572537u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 22, 0u, 1, 4278190080u, 1, 4294704123u, 5, 4294967295u,
+	1, 4294704123u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u, 17, 0u, 17, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 3, 0u,
+	4, 4278190080u, 2, 0u, 13, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4294440951u, 1, 4294046193u, 1, 4293322470u,
+	3, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 1, 4293519849u,
+	3, 4294967295u, 1, 4294440951u, 1, 4294046193u, 1, 4293322470u, 3, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 6, 0u,
+	2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 43, 0u, 1, 4293059298u, 1, 4294835709u,
+	2, 4294967295u, 3, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 3, 0u, 2, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4292467161u, 3, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u,
+	7, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294835709u,
+	1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294309365u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 14, 0u,
+	4, 4278190080u, 1, 4292796126u, 1, 4293519849u, 1, 4294177779u, 1, 4294704123u, 1, 4294967295u, 1, 4294835709u, 1, 4292796126u,
+	2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 2, 4293519849u, 1, 4294967295u, 1, 4293519849u, 15, 4278190080u, 4, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 5, 4294967295u, 1, 4292467161u, 3, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u,
+	13, 0u, 6, 4278190080u, 2, 4294967295u, 6, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294835709u, 2, 4294967295u,
+	2, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 5, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u,
+	4, 4278190080u, 9, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294440951u, 6, 4294967295u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4294440951u, 1, 4294046193u, 1, 4293322470u, 3, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 2, 4293519849u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 19, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4293322470u, 2, 4278190080u,
+	3, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292467161u, 4, 4278190080u, 1, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292467161u, 4, 4278190080u, 1, 4294967295u,
+	1, 4294835709u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292467161u, 4, 4278190080u,
+	1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292467161u,
+	4, 4278190080u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	9, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 8, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 8, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 8, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 8, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 2, 4294967295u, 5, 4278190080u, 2, 0u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4292467161u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	6, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u,
+	1, 4294572537u, 2, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 9, 4294967295u,
+	1, 4293322470u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293322470u, 2, 4294967295u,
+	1, 4293322470u, 1, 4278190080u, 24, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4293059298u, 1, 4294704123u, 2, 4294967295u, 1, 4294835709u, 1, 4293322470u, 3, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294440951u, 6, 4294967295u, 1, 4278190080u,
+	1, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294440951u, 6, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u,
+	1, 4293717228u, 1, 4294440951u, 6, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294440951u,
+	6, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 0u, 6, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u, 6, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 0u, 6, 4278190080u, 10, 4294967295u, 1, 4294835709u, 2, 4278190080u, 10, 4294967295u, 1, 4294835709u, 2, 4278190080u,
+	10, 4294967295u, 1, 4294835709u, 2, 4278190080u, 10, 4294967295u, 1, 4294835709u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	3, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u,
+	2, 4294967295u, 15, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293519849u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	2, 4293848814u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294440951u, 11, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4293848814u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4294177779u, 3, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u, 6, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 4, 4294967295u, 1, 4278190080u, 8, 0u, 2, 4278190080u,
+	2, 4294835709u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 9, 0u, 3, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u,
+	10, 0u, 3, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293848814u, 5, 4278190080u, 2, 4294967295u, 4, 4278190080u, 10, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u,
+	1, 4294835709u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294704123u, 2, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 1, 4294572537u, 6, 4278190080u, 1, 4292796126u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294177779u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294704123u, 2, 4294967295u,
+	1, 4294572537u, 1, 4293519849u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 8, 0u,
+	3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 2, 4294967295u, 1, 4294177779u, 1, 4292796126u, 3, 4278190080u, 1, 0u,
+	1, 4278190080u, 11, 4294967295u, 1, 4278190080u, 1, 0u, 3, 4278190080u, 1, 4292796126u, 1, 4294177779u, 2, 4294967295u,
+	1, 4294704123u, 1, 4293717228u, 3, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u,
+	2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4293848814u, 2, 4294967295u, 1, 4278190080u, 1, 4293059298u, 2, 4294967295u,
+	1, 4292467161u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u, 9, 4294967295u, 1, 4293322470u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u,
+	1, 4294309365u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 4, 0u, 6, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 5, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 4294967295u, 1, 4293519849u, 4, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u,
+	2, 4278190080u, 2, 4294967295u, 8, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 2, 4294967295u,
+	5, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 8, 0u, 5, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u,
+	1, 4292467161u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 8, 0u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 7, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 36, 0u, 2, 4278190080u, 1, 4294572537u, 8, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	11, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4293059298u, 7, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 5, 4294967295u,
+	1, 4294046193u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294046193u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 4294835709u, 1, 4278190080u,
+	2, 4294835709u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4292467161u, 2, 4294967295u, 1, 4294046193u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293717228u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4292796126u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294440951u, 1, 4294967295u, 5, 4278190080u, 2, 0u, 8, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 9, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 27, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293848814u,
+	1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293848814u,
+	1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 6, 0u, 5, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 6, 0u,
+	5, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 7, 0u,
+	2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 22, 0u,
+	1, 4278190080u, 1, 4293322470u, 5, 4294967295u, 1, 4293322470u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u, 17, 0u,
+	17, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4278190080u, 21, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 5, 4294967295u, 1, 4294046193u,
+	3, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 3, 4278190080u, 1, 4293322470u, 1, 4294572537u, 5, 4294967295u,
+	1, 4294046193u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 2, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293717228u, 2, 4278190080u, 43, 0u, 4, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294572537u, 6, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4292796126u, 9, 4294967295u, 1, 4292796126u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4292796126u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 7, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293322470u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 17, 0u, 5, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292467161u, 1, 4294704123u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u, 11, 4294967295u, 2, 4278190080u,
+	4, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u,
+	19, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 12, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4292796126u,
+	2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4294572537u, 8, 4294967295u,
+	1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 5, 4294967295u, 1, 4294046193u, 3, 4278190080u,
+	1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 19, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292796126u, 9, 4294967295u, 1, 4293322470u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292796126u, 9, 4294967295u, 1, 4293322470u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4292796126u, 9, 4294967295u, 1, 4293322470u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292796126u,
+	9, 4294967295u, 1, 4293322470u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 4, 0u, 6, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 4, 0u, 6, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 4, 0u, 6, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 2, 4294835709u, 1, 4294967295u, 1, 4294835709u,
+	1, 4292796126u, 3, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 24, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 4, 4278190080u, 1, 4293519849u, 1, 4294704123u,
+	2, 4294967295u, 1, 4293059298u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294572537u,
+	8, 4294967295u, 3, 4278190080u, 1, 4294572537u, 8, 4294967295u, 3, 4278190080u, 1, 4294572537u, 8, 4294967295u, 3, 4278190080u,
+	1, 4294572537u, 8, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 8, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 2, 4278190080u, 11, 4294967295u,
+	2, 4278190080u, 11, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	4, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u,
+	2, 4293848814u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 12, 4294967295u, 7, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4293519849u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 18, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 6, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 3, 0u, 5, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	13, 4294967295u, 6, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293848814u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4293059298u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4292467161u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u,
+	2, 0u, 9, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 10, 0u, 3, 4278190080u,
+	1, 4293519849u, 1, 4294440951u, 2, 4294967295u, 1, 4294572537u, 1, 4293519849u, 3, 4278190080u, 11, 4294967295u, 3, 4278190080u,
+	1, 4293519849u, 1, 4294572537u, 2, 4294967295u, 1, 4294440951u, 1, 4293519849u, 3, 4278190080u, 6, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	1, 4293059298u, 5, 4294967295u, 1, 4294704123u, 4, 4294967295u, 1, 4293848814u, 2, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4294046193u, 9, 4294967295u, 1, 4294046193u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294704123u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293519849u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u,
+	1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 2, 4294967295u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294046193u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 0u,
+	5, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u,
+	1, 4278190080u, 1, 4294967295u, 1, 4294835709u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	4, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294572537u, 2, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 2, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 7, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 36, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u,
+	4, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u, 6, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 10, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294440951u, 2, 4294967295u, 1, 4294704123u,
+	1, 4294046193u, 3, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	3, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	4, 4278190080u, 1, 4293059298u, 1, 4293848814u, 1, 4294440951u, 2, 4294967295u, 1, 4294046193u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294440951u, 3, 4294967295u,
+	1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 15, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 9, 4294967295u, 7, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 27, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	2, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 6, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4293519849u, 6, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293848814u,
+	2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 22, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u,
+	1, 4294704123u, 1, 4293322470u, 15, 4278190080u, 17, 0u, 19, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 22, 0u, 4, 4278190080u, 1, 4293059298u,
+	1, 4293848814u, 1, 4294440951u, 2, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 1, 0u, 4, 4278190080u, 1, 4293059298u, 1, 4293848814u, 1, 4294440951u, 2, 4294967295u, 1, 4294046193u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 44, 0u, 1, 4294835709u, 1, 4293322470u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 2, 4278190080u,
+	1, 4292796126u, 2, 4294967295u, 1, 4294572537u, 1, 4293322470u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 2, 4294967295u,
+	1, 4292796126u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294046193u, 9, 4294967295u, 1, 4294046193u, 1, 4278190080u,
+	7, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4294835709u, 1, 4293848814u, 4, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u,
+	2, 4278190080u, 1, 4292467161u, 5, 4294967295u, 1, 4293059298u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 12, 0u, 4, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 2, 4293519849u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 11, 4294967295u, 8, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294440951u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4293848814u, 2, 4278190080u, 19, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 12, 0u, 1, 4278190080u,
+	1, 4292796126u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u, 4, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	4, 4278190080u, 1, 4293059298u, 1, 4293848814u, 1, 4294440951u, 2, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 2, 4293519849u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 19, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294046193u, 9, 4294967295u, 1, 4294046193u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294046193u, 9, 4294967295u, 1, 4294046193u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4294046193u, 9, 4294967295u, 1, 4294046193u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294046193u,
+	9, 4294967295u, 1, 4294046193u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294704123u, 1, 4294309365u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294704123u, 1, 4294309365u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294704123u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4293059298u, 2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294046193u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294046193u, 3, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294835709u, 2, 4292796126u, 1, 4294835709u,
+	1, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	3, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 25, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 3, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u,
+	4, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u, 4, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u, 4, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u, 4, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u, 6, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 0u, 6, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u, 6, 4278190080u,
+	2, 4294967295u, 11, 4278190080u, 2, 4294967295u, 11, 4278190080u, 2, 4294967295u, 11, 4278190080u, 2, 4294967295u, 11, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	3, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294572537u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294572537u, 1, 4293322470u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 2, 4293848814u,
+	1, 4278190080u, 7, 0u, 3, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4294046193u,
+	1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294704123u, 1, 4293519849u,
+	3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 18, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 22, 0u, 2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 3, 4278190080u,
+	1, 4293848814u, 2, 4294967295u, 1, 4293717228u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294704123u,
+	1, 4292796126u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 13, 4294967295u, 2, 4278190080u,
+	1, 4294046193u, 1, 4294704123u, 1, 4293059298u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294572537u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4292467161u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4293519849u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 5, 0u, 2, 4278190080u,
+	2, 4294967295u, 6, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	12, 0u, 3, 4278190080u, 1, 4293059298u, 1, 4294177779u, 2, 4294967295u, 1, 4294835709u, 15, 4278190080u, 1, 4294835709u,
+	2, 4294967295u, 1, 4294177779u, 1, 4293059298u, 3, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 4293059298u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294835709u, 1, 4293848814u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4294704123u, 1, 4293717228u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 5, 4278190080u, 1, 4292796126u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u,
+	2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293059298u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293848814u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294046193u, 1, 4294967295u,
+	1, 4294309365u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 2, 4294967295u, 2, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294704123u,
+	2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294177779u, 1, 4294704123u, 1, 4293059298u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4292467161u, 2, 4294967295u, 2, 4278190080u, 6, 0u,
+	2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293848814u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 3, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293519849u,
+	1, 4278190080u, 8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u,
+	2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 36, 0u,
+	1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292467161u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294572537u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4292467161u, 1, 4294835709u, 1, 4294440951u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u,
+	3, 0u, 5, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4292796126u, 6, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4293519849u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293059298u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293322470u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 8, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4292467161u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4293519849u, 1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u,
+	1, 4294572537u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u,
+	1, 4294572537u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 15, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 3, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4293519849u, 6, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294309365u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4278190080u, 27, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u,
+	1, 4294440951u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294704123u, 1, 4293059298u, 1, 4278190080u, 5, 0u, 2, 4278190080u,
+	2, 4294967295u, 3, 4278190080u, 1, 4294440951u, 1, 4294309365u, 2, 4278190080u, 1, 4294177779u, 1, 4294704123u, 1, 4293059298u,
+	1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 7, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 23, 0u,
+	7, 4278190080u, 49, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 21, 0u, 8, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 1, 4294309365u, 1, 4294440951u, 10, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u,
+	1, 4294572537u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 1, 4294572537u, 2, 4278190080u,
+	45, 0u, 1, 4292796126u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294835709u, 10, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292796126u, 5, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 0u,
+	4, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294704123u, 3, 4294967295u, 1, 4294572537u, 1, 4293848814u,
+	1, 4293519849u, 1, 4294835709u, 1, 4294177779u, 2, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4293519849u, 2, 4278190080u, 1, 4293059298u, 1, 4294572537u, 1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 2, 4278190080u,
+	1, 4293519849u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 12, 0u, 1, 4294177779u, 1, 4294704123u, 1, 4293059298u,
+	1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294440951u, 1, 4294309365u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294309365u, 11, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294572537u, 1, 4294704123u, 1, 4278190080u,
+	1, 4293519849u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294572537u, 2, 4278190080u, 20, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 12, 0u, 3, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 0u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 4, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 2, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 8, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 4294309365u, 1, 4294440951u, 1, 4278190080u, 1, 4294309365u, 1, 4294440951u,
+	3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 19, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 1, 4294572537u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u,
+	2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 5, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 5, 4278190080u, 1, 4292796126u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u,
+	5, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292796126u, 5, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u,
+	2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294309365u,
+	2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294440951u, 2, 4294967295u, 2, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u,
+	2, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 4, 0u,
+	2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294704123u,
+	2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u, 1, 4292796126u, 1, 4294835709u, 1, 4294967295u, 1, 4294704123u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294704123u,
+	2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 25, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u,
+	2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292467161u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4292467161u, 2, 4294967295u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u,
+	1, 4294440951u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4292467161u, 1, 4294835709u, 1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4292796126u, 1, 4278190080u, 3, 0u, 6, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u,
+	3, 0u, 6, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 3, 0u, 6, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 3, 0u, 6, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4294572537u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294572537u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4294572537u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 5, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293059298u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4293848814u, 2, 4294967295u, 1, 4294177779u, 1, 4293059298u, 1, 4278190080u, 2, 4294967295u, 1, 4292467161u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u,
+	2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 3, 4278190080u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4293519849u, 5, 4278190080u, 1, 4293059298u, 3, 4294967295u, 1, 4293322470u, 2, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 18, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 22, 0u,
+	1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4293519849u, 5, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294440951u, 1, 4294967295u,
+	1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u,
+	3, 4278190080u, 1, 0u, 3, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294572537u, 10, 4278190080u, 2, 4294967295u,
+	5, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 1, 0u, 3, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292796126u, 6, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293059298u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293717228u, 3, 4278190080u, 1, 0u,
+	3, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 4294046193u, 1, 4294704123u, 1, 4293519849u,
+	6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 14, 0u, 3, 4278190080u, 1, 4292467161u,
+	1, 4294177779u, 1, 4294835709u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294177779u, 1, 4292467161u,
+	3, 4278190080u, 10, 0u, 4, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4293519849u,
+	11, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 3, 0u,
+	2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4293322470u, 5, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 3, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4293848814u, 6, 4278190080u, 1, 4294572537u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u,
+	1, 4292796126u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293848814u, 3, 4294967295u,
+	1, 4293519849u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 2, 4278190080u, 1, 4294704123u, 3, 4294967295u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u,
+	6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u,
+	2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u, 6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u,
+	3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294572537u, 7, 4278190080u, 1, 4293717228u,
+	1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 5, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4294440951u, 1, 4294967295u, 1, 4294309365u,
+	1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294704123u, 1, 4294967295u, 1, 4293848814u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 2, 4278190080u, 2, 4294835709u, 1, 4292467161u, 1, 4278190080u, 7, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 36, 0u, 1, 4278190080u, 2, 4294967295u, 5, 4278190080u,
+	1, 4294177779u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4293519849u, 4, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4294046193u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4294309365u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4293717228u, 2, 4294967295u,
+	2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294046193u, 5, 4278190080u, 1, 4293059298u, 1, 4294835709u, 1, 4294309365u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4293717228u, 1, 4292467161u, 8, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293848814u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u,
+	5, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293717228u, 2, 4278190080u, 2, 4294967295u, 1, 4293717228u, 4, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u,
+	1, 4294440951u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294835709u, 1, 4293059298u, 5, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 4, 4278190080u, 1, 4294309365u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u,
+	2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294572537u, 1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 3, 0u,
+	2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u,
+	2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293717228u, 2, 4294967295u, 1, 4294835709u, 2, 4278190080u, 2, 0u,
+	2, 4278190080u, 1, 4294572537u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 16, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u,
+	6, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u,
+	13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 27, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 6, 4278190080u, 2, 4294967295u, 7, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 3, 0u,
+	2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 3, 4278190080u,
+	1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 3, 4278190080u, 1, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294572537u, 7, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294572537u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4294572537u, 7, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 2, 4294835709u, 1, 4292467161u, 1, 4278190080u, 7, 0u,
+	2, 4278190080u, 2, 4294835709u, 1, 4292467161u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 79, 0u, 1, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u,
+	21, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294835709u, 1, 4293059298u, 5, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294835709u, 1, 4293059298u,
+	5, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 4, 0u,
+	2, 4278190080u, 1, 4294572537u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294572537u,
+	1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 46, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u,
+	1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 1, 4293519849u, 1, 4294572537u, 2, 4294967295u,
+	1, 4294572537u, 1, 4293717228u, 1, 4292796126u, 1, 4294835709u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u,
+	3, 4278190080u, 1, 4293519849u, 1, 4294309365u, 5, 4294967295u, 1, 4293848814u, 2, 4278190080u, 8, 0u, 1, 4278190080u,
+	1, 4293519849u, 2, 4294967295u, 1, 4293519849u, 7, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4293519849u, 1, 4278190080u,
+	13, 0u, 1, 4293848814u, 1, 4294967295u, 1, 4294572537u, 7, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294572537u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u,
+	1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4293519849u,
+	2, 4294967295u, 1, 4293519849u, 7, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 0u,
+	2, 4278190080u, 2, 4294835709u, 1, 4292467161u, 1, 4278190080u, 21, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	14, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4293322470u,
+	3, 4278190080u, 1, 4293322470u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 14, 0u, 1, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4294177779u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294835709u, 1, 4292796126u, 5, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 19, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	2, 4278190080u, 1, 4294572537u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u,
+	5, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293322470u,
+	5, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u,
+	5, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 3, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294704123u, 3, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 2, 4278190080u, 1, 4294704123u, 3, 4294967295u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u,
+	6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 4, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u,
+	6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 4, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u,
+	6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 4, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u,
+	6, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294440951u, 3, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u,
+	4, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293717228u, 5, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293717228u, 5, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293717228u, 5, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4293717228u, 5, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294309365u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 25, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4294177779u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 5, 4278190080u, 1, 4294177779u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4294177779u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4294177779u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294046193u, 5, 4278190080u, 1, 4293059298u,
+	1, 4294835709u, 1, 4294309365u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294046193u, 5, 4278190080u, 1, 4293059298u,
+	1, 4294835709u, 1, 4294309365u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294046193u, 5, 4278190080u, 1, 4293059298u,
+	1, 4294835709u, 1, 4294309365u, 2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294046193u, 5, 4278190080u, 1, 4293059298u,
+	1, 4294835709u, 1, 4294309365u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4293717228u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u,
+	1, 4293717228u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 5, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293717228u,
+	2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 5, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293717228u,
+	2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 5, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293717228u,
+	2, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294309365u, 5, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 5, 0u, 4, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 4, 4278190080u, 1, 4294309365u, 2, 4294967295u, 2, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 4, 4278190080u, 1, 4294309365u, 2, 4294967295u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4293322470u, 4, 4278190080u, 1, 4294309365u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 4, 4278190080u, 1, 4294309365u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4293717228u, 2, 4294967295u, 1, 4294835709u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	5, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294046193u, 8, 4294967295u, 1, 4294835709u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 3, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294046193u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294835709u, 1, 4293848814u, 1, 4292467161u, 2, 4278190080u, 1, 4293059298u, 1, 4294177779u, 2, 4294967295u,
+	1, 4294572537u, 1, 4292467161u, 3, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 18, 0u,
+	4, 4278190080u, 5, 0u, 4, 4278190080u, 6, 0u, 4, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294835709u,
+	2, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4293059298u, 2, 4294967295u, 1, 4293848814u, 1, 4292467161u, 2, 4278190080u,
+	1, 4293717228u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 0u, 6, 4278190080u, 2, 4294967295u,
+	7, 4278190080u, 1, 4293322470u, 1, 4294835709u, 1, 4294967295u, 1, 4294309365u, 11, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4294572537u, 1, 4293322470u, 3, 4278190080u, 1, 4292796126u, 1, 4294177779u, 2, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u,
+	1, 4294967295u, 1, 4294704123u, 1, 4293322470u, 3, 4278190080u, 1, 4293519849u, 1, 4294704123u, 1, 4294967295u, 1, 4294572537u,
+	2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294835709u, 1, 4293848814u, 1, 4292467161u,
+	2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4294572537u, 1, 4294967295u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293717228u, 2, 4294967295u, 1, 4294177779u,
+	1, 4293059298u, 3, 4278190080u, 1, 4292796126u, 1, 4294177779u, 2, 4294967295u, 1, 4293322470u, 2, 4278190080u, 1, 4293848814u,
+	2, 4294967295u, 1, 4293848814u, 1, 4292467161u, 2, 4278190080u, 1, 4293322470u, 1, 4294440951u, 1, 4294967295u, 1, 4294835709u,
+	1, 4292796126u, 1, 4278190080u, 1, 0u, 8, 4278190080u, 8, 0u, 5, 4278190080u, 13, 0u, 5, 4278190080u,
+	12, 0u, 4, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294177779u, 2, 4294967295u, 1, 4294440951u, 1, 4293519849u,
+	1, 4292467161u, 3, 4278190080u, 1, 4293059298u, 1, 4293519849u, 1, 4294309365u, 1, 4294177779u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294046193u,
+	1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 6, 4278190080u, 1, 4293519849u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294835709u, 1, 4293717228u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 1, 4294967295u, 1, 4294572537u, 3, 4278190080u,
+	2, 4294967295u, 5, 4278190080u, 1, 4293322470u, 1, 4294572537u, 1, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 11, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u,
+	1, 4293059298u, 2, 4294967295u, 1, 4294309365u, 1, 4292796126u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 3, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	5, 4278190080u, 1, 4292796126u, 1, 4294572537u, 1, 4294967295u, 1, 4294046193u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 3, 4278190080u, 2, 4294967295u, 10, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 3, 4294967295u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293519849u,
+	3, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 2, 4294967295u, 1, 4294440951u, 1, 4292796126u,
+	2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 1, 4292796126u, 2, 4294967295u, 1, 4294440951u,
+	1, 4292796126u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u,
+	4, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 1, 4292467161u, 2, 4278190080u, 1, 4292467161u,
+	1, 4293848814u, 2, 4294967295u, 1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4293848814u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u,
+	1, 4293848814u, 2, 4294967295u, 1, 4293059298u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293717228u, 3, 4294967295u,
+	1, 4293717228u, 1, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4293322470u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4293717228u, 1, 4278190080u, 3, 0u, 2, 4278190080u,
+	1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u,
+	1, 4293848814u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 10, 4278190080u, 2, 4294967295u, 1, 4278190080u, 9, 0u, 2, 4278190080u,
+	2, 4294835709u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 36, 0u, 1, 4278190080u,
+	1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 3, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 1, 4293717228u, 2, 4294967295u, 1, 4292467161u,
+	3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293717228u, 2, 4294967295u, 1, 4293059298u,
+	2, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 3, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 1, 4294967295u,
+	1, 4293848814u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4294572537u, 7, 4294967295u, 1, 4294572537u, 1, 4294309365u, 1, 4293059298u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u,
+	1, 4294704123u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294309365u, 1, 4292467161u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 1, 4294967295u, 1, 4294704123u, 3, 4278190080u, 3, 4294967295u, 1, 4293848814u,
+	2, 4278190080u, 1, 4293848814u, 2, 4294967295u, 1, 4292467161u, 2, 4278190080u, 1, 4293059298u, 2, 4294967295u, 1, 4293717228u,
+	2, 4278190080u, 1, 4294177779u, 1, 4294440951u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 1, 4292467161u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u,
+	5, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4293059298u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u,
+	3, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 1, 4294967295u,
+	1, 4294309365u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293519849u, 3, 4294967295u, 1, 4293059298u, 1, 4278190080u,
+	1, 4293059298u, 3, 4294967295u, 1, 4293322470u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4294440951u, 3, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 4, 0u, 2, 4278190080u,
+	2, 4294967295u, 1, 4294177779u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293322470u,
+	7, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 16, 0u, 1, 4278190080u, 1, 4294967295u,
+	1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 1, 4294967295u, 1, 4294835709u,
+	1, 4292467161u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 6, 4278190080u,
+	1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 12, 4278190080u, 1, 0u, 4, 4278190080u,
+	2, 0u, 4, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	12, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294177779u, 3, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4294046193u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 4294309365u, 1, 4294967295u,
+	1, 4294046193u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294309365u, 3, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4294704123u, 1, 4293519849u, 1, 4292467161u, 2, 4278190080u, 1, 4292467161u, 1, 4293848814u, 2, 4294967295u, 1, 4293322470u,
+	1, 4278190080u, 1, 0u, 6, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 1, 4292467161u,
+	2, 4278190080u, 1, 4292467161u, 1, 4293848814u, 2, 4294967295u, 1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 10, 4278190080u,
+	1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 10, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4278190080u, 79, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294440951u, 15, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4278190080u, 21, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u,
+	2, 4278190080u, 1, 4292467161u, 1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 5, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294046193u, 1, 4294967295u, 1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 1, 4292467161u, 1, 4294309365u, 1, 4294967295u,
+	1, 4294440951u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4293322470u, 7, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4293322470u, 7, 4278190080u, 42, 0u, 1, 4278190080u, 2, 4294967295u, 10, 4278190080u,
+	1, 4292796126u, 1, 4294440951u, 9, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4292796126u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	4, 4278190080u, 1, 4293322470u, 1, 4294046193u, 1, 4294704123u, 2, 4294967295u, 1, 4293717228u, 1, 4278190080u, 8, 0u,
+	2, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4294440951u, 1, 4293322470u, 3, 4278190080u, 1, 4293322470u, 1, 4294440951u,
+	2, 4294967295u, 1, 4293519849u, 2, 4278190080u, 13, 0u, 1, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294704123u,
+	1, 4293519849u, 1, 4292467161u, 2, 4278190080u, 1, 4292467161u, 1, 4293848814u, 2, 4294967295u, 1, 4293519849u, 1, 4278190080u,
+	1, 0u, 7, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 2, 4278190080u,
+	1, 4293519849u, 2, 4294967295u, 1, 4294440951u, 1, 4293322470u, 3, 4278190080u, 1, 4293322470u, 1, 4294440951u, 2, 4294967295u,
+	1, 4293519849u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4294309365u, 1, 4294967295u, 1, 4293717228u, 9, 4278190080u,
+	9, 0u, 14, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4294704123u, 1, 4293059298u, 1, 4278190080u, 1, 4293059298u, 1, 4294704123u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 14, 0u, 1, 4278190080u,
+	1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 3, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 2, 4278190080u,
+	1, 4292467161u, 1, 4294309365u, 1, 4294967295u, 1, 4294440951u, 8, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	9, 4278190080u, 11, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294177779u,
+	1, 4294967295u, 1, 4293322470u, 8, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294046193u,
+	1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4294046193u,
+	1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 9, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294835709u, 1, 4293717228u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294835709u,
+	1, 4293717228u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294835709u, 1, 4293717228u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 2, 4294967295u, 11, 4278190080u, 2, 4294967295u, 10, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 11, 4278190080u, 2, 4294967295u, 10, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	5, 4278190080u, 1, 4293322470u, 1, 4294572537u, 1, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4293322470u, 1, 4294572537u, 1, 4294967295u, 1, 4294835709u, 1, 4292796126u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293519849u,
+	3, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4293519849u, 3, 4294967295u,
+	1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 2, 4294967295u, 1, 4294440951u, 1, 4292796126u, 2, 4278190080u,
+	1, 4292796126u, 1, 4294309365u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4292796126u, 2, 4294967295u, 1, 4294440951u, 1, 4292796126u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 1, 4294967295u,
+	1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292796126u, 2, 4294967295u, 1, 4294440951u,
+	1, 4292796126u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4292796126u, 2, 4294967295u, 1, 4294440951u, 1, 4292796126u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294309365u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 5, 4278190080u, 2, 0u,
+	6, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u,
+	3, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4293848814u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4293848814u,
+	2, 4294967295u, 1, 4293059298u, 2, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4293848814u, 1, 4292467161u, 1, 4278190080u,
+	1, 4292467161u, 1, 4293848814u, 2, 4294967295u, 1, 4293059298u, 2, 4278190080u, 1, 4293519849u, 2, 4294967295u, 1, 4293848814u,
+	1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4293848814u, 2, 4294967295u, 1, 4293059298u, 2, 4278190080u, 1, 4293519849u,
+	2, 4294967295u, 1, 4293848814u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4293848814u, 2, 4294967295u, 1, 4293059298u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 25, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 3, 4294967295u, 2, 4278190080u,
+	1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 3, 4294967295u,
+	2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u,
+	3, 4294967295u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294177779u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u,
+	1, 4294309365u, 3, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293717228u, 2, 4294967295u, 1, 4293059298u, 2, 4278190080u, 1, 4292467161u,
+	2, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293717228u, 2, 4294967295u, 1, 4293059298u, 3, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 4293717228u, 2, 4294967295u, 1, 4293059298u, 3, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u,
+	3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293519849u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294177779u, 1, 4292796126u, 2, 4278190080u,
+	1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294177779u,
+	1, 4292796126u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u,
+	2, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4292467161u, 2, 4294967295u, 1, 4293717228u, 2, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294309365u,
+	1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 1, 4294967295u, 1, 4294704123u, 4, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4294309365u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 1, 4294967295u, 1, 4294704123u,
+	4, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294309365u, 1, 4292467161u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u,
+	1, 4294967295u, 1, 4294704123u, 4, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294309365u, 1, 4292467161u, 1, 4278190080u,
+	1, 4292467161u, 1, 4294309365u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 15, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4293059298u, 1, 4278190080u,
+	1, 4292467161u, 1, 4294309365u, 3, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4293059298u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 3, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u,
+	1, 4293059298u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 3, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4293059298u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 3, 4294967295u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4294177779u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294704123u,
+	15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u,
+	15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u,
+	15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u,
+	15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u,
+	15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u,
+	15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u,
+	15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u,
+	1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u,
+	1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u,
+	15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 2, 4278190080u,
+	2, 4294967295u, 3, 4278190080u, 2, 4294967295u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294046193u,
+	1, 4294440951u, 3, 4294967295u, 1, 4294835709u, 1, 4294177779u, 1, 4292467161u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u,
+	5, 4294967295u, 1, 4292796126u, 3, 4278190080u, 1, 4294177779u, 7, 4294967295u, 1, 4294704123u, 1, 4294572537u, 4, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4292796126u, 1, 4278190080u, 27, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293848814u,
+	1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4293519849u, 7, 4294967295u, 1, 4293519849u,
+	2, 4278190080u, 1, 0u, 1, 4278190080u, 12, 4294967295u, 2, 4278190080u, 12, 4294967295u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294704123u, 8, 4294967295u, 1, 4293519849u, 2, 4278190080u, 8, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 7, 4294967295u, 1, 4294440951u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293848814u, 7, 4294967295u, 1, 4294704123u, 1, 4292796126u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4293848814u, 9, 4294967295u,
+	1, 4293519849u, 4, 4278190080u, 1, 4294177779u, 7, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 43, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294835709u, 9, 4294967295u, 1, 4294309365u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 10, 4294967295u, 1, 4294309365u, 2, 4278190080u, 1, 0u,
+	2, 4278190080u, 1, 4293848814u, 6, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	9, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 10, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 6, 4294967295u, 1, 4294572537u,
+	1, 4293519849u, 1, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 5, 4294967295u, 1, 4294835709u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u, 10, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u,
+	1, 4294572537u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 6, 4294967295u,
+	1, 4294835709u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u,
+	2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 7, 4294967295u, 1, 4293519849u, 2, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u,
+	1, 0u, 2, 4278190080u, 1, 4294572537u, 8, 4294967295u, 1, 4293717228u, 2, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294177779u, 7, 4294967295u, 1, 4294046193u, 2, 4278190080u,
+	4, 0u, 1, 4278190080u, 1, 4292467161u, 3, 4294967295u, 1, 4292467161u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	1, 4292467161u, 3, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 3, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 1, 4292467161u,
+	1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 1, 4278190080u, 6, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 10, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 5, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 36, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294046193u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294440951u, 1, 4294177779u, 5, 4294967295u, 1, 4293717228u, 2, 4278190080u,
+	1, 0u, 1, 4278190080u, 1, 4293519849u, 6, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4293848814u, 5, 4294967295u,
+	1, 4294177779u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u,
+	1, 4294046193u, 1, 4294967295u, 1, 4294572537u, 8, 4294967295u, 1, 4293519849u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293519849u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u,
+	1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4294177779u, 5, 4294967295u,
+	1, 4293848814u, 4, 4278190080u, 1, 4294046193u, 5, 4294967295u, 1, 4293059298u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294572537u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4293848814u, 5, 4294967295u, 2, 4278190080u, 1, 4292467161u, 1, 4294835709u, 5, 4294967295u,
+	1, 4293519849u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293717228u, 3, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4292467161u, 3, 4294967295u, 2, 4278190080u, 1, 4292467161u, 3, 4294967295u,
+	2, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 2, 4294967295u, 1, 4292467161u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294440951u,
+	1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 16, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u,
+	1, 4294704123u, 1, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294440951u, 7, 4294967295u, 1, 4293519849u,
+	3, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 12, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u,
+	1, 4294704123u, 1, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u,
+	1, 4292467161u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 5, 4294967295u, 1, 4292796126u, 2, 4278190080u,
+	1, 4292796126u, 5, 4294967295u, 1, 4292796126u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294572537u, 8, 4294967295u,
+	1, 4293717228u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4294572537u, 8, 4294967295u, 1, 4293717228u, 2, 4278190080u,
+	5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u,
+	11, 4294967295u, 2, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 1, 4278190080u,
+	79, 0u, 1, 4278190080u, 1, 4294967295u, 1, 4294704123u, 15, 4293848814u, 1, 4294704123u, 1, 4294967295u, 1, 4278190080u,
+	21, 0u, 2, 4278190080u, 1, 4294572537u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 5, 0u,
+	2, 4278190080u, 1, 4294572537u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4293848814u, 5, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 42, 0u, 1, 4278190080u, 10, 4294967295u, 5, 4278190080u, 7, 0u,
+	7, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293322470u,
+	1, 4294967295u, 1, 4294572537u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 4, 4278190080u, 1, 4294046193u,
+	1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 9, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 7, 4294967295u,
+	1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 14, 0u, 2, 4278190080u, 1, 4294440951u, 8, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 17, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4293519849u,
+	1, 4294835709u, 7, 4294967295u, 1, 4294835709u, 1, 4293519849u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 11, 4294967295u,
+	1, 4278190080u, 9, 0u, 1, 4278190080u, 12, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4294835709u, 3, 4294967295u, 1, 4294440951u, 2, 4294967295u,
+	1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 14, 0u,
+	1, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294046193u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	1, 4292467161u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 8, 0u, 1, 4278190080u,
+	10, 4294967295u, 1, 4278190080u, 11, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	9, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293519849u, 3, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 4, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 4, 4278190080u, 1, 4294572537u, 1, 4294967295u,
+	1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 4, 4278190080u,
+	1, 4294572537u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294572537u, 3, 4278190080u, 10, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293848814u, 6, 4294967295u,
+	1, 4294835709u, 1, 4292467161u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4294440951u, 6, 4294967295u, 1, 4294572537u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293848814u, 6, 4294967295u, 1, 4294835709u, 1, 4292467161u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4294835709u,
+	1, 4292796126u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u,
+	1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294572537u, 2, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294572537u, 2, 4294967295u, 1, 4278190080u,
+	1, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294835709u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 2, 4278190080u,
+	13, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293519849u, 3, 4278190080u, 1, 4294177779u, 7, 4294967295u, 1, 4294046193u, 4, 4278190080u, 1, 4294177779u, 7, 4294967295u,
+	1, 4294046193u, 4, 4278190080u, 1, 4294177779u, 7, 4294967295u, 1, 4294046193u, 4, 4278190080u, 1, 4294177779u, 7, 4294967295u,
+	1, 4294046193u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 25, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 5, 4278190080u, 1, 4293322470u, 1, 4294835709u,
+	1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4293322470u,
+	6, 4294967295u, 1, 4294046193u, 2, 4294967295u, 2, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294046193u, 2, 4294967295u,
+	2, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294046193u, 2, 4294967295u, 2, 4278190080u, 1, 4293322470u, 6, 4294967295u,
+	1, 4294046193u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293519849u,
+	6, 4294967295u, 1, 4294177779u, 4, 4278190080u, 1, 4294046193u, 6, 4294967295u, 1, 4294046193u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4293519849u, 6, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294835709u, 6, 4294967295u, 1, 4294177779u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u,
+	6, 4294967295u, 1, 4293519849u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u,
+	1, 4294177779u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294835709u, 6, 4294967295u, 1, 4294177779u,
+	3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	2, 4278190080u, 1, 4293848814u, 5, 4294967295u, 1, 4294177779u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u,
+	1, 4293848814u, 5, 4294967295u, 1, 4294177779u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294835709u,
+	1, 4292796126u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u,
+	1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u,
+	2, 0u, 1, 4278190080u, 1, 4293322470u, 6, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 16, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 5, 4294967295u,
+	1, 4293519849u, 2, 4294967295u, 2, 4278190080u, 1, 4292467161u, 1, 4294835709u, 5, 4294967295u, 1, 4293519849u, 2, 4294967295u,
+	2, 4278190080u, 1, 4292467161u, 1, 4294835709u, 5, 4294967295u, 1, 4293519849u, 2, 4294967295u, 1, 4278190080u, 1, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294835709u, 5, 4294967295u, 1, 4293519849u, 2, 4294967295u, 1, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293848814u,
+	5, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u,
+	19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u,
+	19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u,
+	19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u,
+	19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u,
+	19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u,
+	19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u,
+	19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	8, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 4292796126u, 1, 4294967295u,
+	1, 4294572537u, 1, 4278190080u, 6, 0u, 5, 4278190080u, 2, 4294967295u, 4, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u,
+	1, 4294967295u, 1, 4294704123u, 1, 4293322470u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u,
+	1, 4294835709u, 2, 4294967295u, 1, 4294440951u, 1, 4293717228u, 2, 4278190080u, 1, 4294046193u, 3, 4294967295u, 1, 4278190080u,
+	4, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294835709u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 2, 4294704123u,
+	2, 4278190080u, 27, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 1, 0u, 2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 9, 0u, 2, 4278190080u, 1, 4292796126u,
+	1, 4294309365u, 1, 4294835709u, 1, 4294967295u, 1, 4294835709u, 1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 2, 0u,
+	1, 4278190080u, 12, 4294967295u, 2, 4278190080u, 12, 4294967295u, 1, 4278190080u, 1, 0u, 3, 4278190080u, 1, 4293717228u,
+	1, 4294440951u, 3, 4294967295u, 1, 4294572537u, 1, 4294046193u, 1, 4292467161u, 2, 4278190080u, 9, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 3, 4278190080u, 1, 4293717228u, 1, 4294572537u, 2, 4294967295u, 1, 4294835709u,
+	1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294177779u, 1, 4294835709u,
+	2, 4294967295u, 1, 4294572537u, 1, 4293848814u, 3, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	7, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294046193u, 1, 4294572537u, 3, 4294967295u, 1, 4294572537u, 1, 4294046193u,
+	1, 4292467161u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294309365u, 3, 4294967295u, 1, 4294440951u,
+	1, 4293848814u, 3, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	43, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 8, 0u, 3, 4278190080u, 1, 4293717228u, 1, 4294440951u,
+	1, 4294835709u, 2, 4294967295u, 1, 4294835709u, 1, 4294440951u, 1, 4293848814u, 1, 4292467161u, 2, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294835709u,
+	1, 4294967295u, 1, 4292467161u, 2, 4278190080u, 8, 4294967295u, 1, 4294440951u, 1, 4293519849u, 2, 4278190080u, 3, 0u,
+	2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294046193u, 3, 4278190080u, 1, 0u,
+	1, 4278190080u, 7, 4294967295u, 1, 4294704123u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 2, 0u, 1, 4278190080u,
+	11, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 11, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u,
+	1, 4294704123u, 2, 4294967295u, 1, 4294572537u, 1, 4293848814u, 2, 4278190080u, 1, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 3, 4294967295u,
+	1, 4294704123u, 1, 4294177779u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u,
+	1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u, 10, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4293717228u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293059298u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294704123u, 2, 4294967295u,
+	1, 4294572537u, 1, 4294046193u, 3, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 11, 0u,
+	2, 4278190080u, 1, 4292467161u, 1, 4294046193u, 1, 4294704123u, 3, 4294967295u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u,
+	2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u,
+	1, 4294572537u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294309365u, 1, 4294835709u, 2, 4294967295u,
+	1, 4294704123u, 1, 4294177779u, 1, 4293059298u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u, 1, 4294835709u, 1, 4294309365u, 1, 4293059298u,
+	2, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294572537u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 8, 0u,
+	2, 4278190080u, 1, 4294704123u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 3, 4294967295u,
+	2, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 4, 0u,
+	1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 6, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u,
+	2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 36, 0u,
+	2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 2, 4294967295u, 1, 4294572537u, 1, 4293519849u, 1, 4278190080u, 2, 4294967295u,
+	2, 4278190080u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 1, 4293848814u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u,
+	1, 4293322470u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294572537u,
+	1, 4293519849u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u,
+	1, 4293848814u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u,
+	1, 4294704123u, 2, 4294967295u, 1, 4294309365u, 1, 4293322470u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 4, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294967295u, 1, 4293519849u, 6, 4278190080u, 1, 4292467161u,
+	1, 4293848814u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294967295u, 1, 4294440951u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u,
+	1, 4294177779u, 3, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 4293848814u, 1, 4294704123u,
+	1, 4294967295u, 1, 4294704123u, 1, 4293519849u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294704123u,
+	1, 4294967295u, 1, 4294704123u, 1, 4293322470u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294572537u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 1, 4292467161u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294572537u, 3, 4294967295u, 3, 4278190080u, 1, 4292796126u,
+	1, 4294309365u, 2, 4294967295u, 1, 4294572537u, 1, 4293322470u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 3, 0u,
+	1, 4278190080u, 1, 4292467161u, 3, 4294967295u, 1, 4293059298u, 1, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4294704123u,
+	1, 4294967295u, 1, 4294835709u, 3, 4278190080u, 2, 4294967295u, 1, 4294572537u, 1, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4294440951u, 1, 4294967295u, 1, 4293848814u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4294046193u, 1, 4294967295u,
+	1, 4294309365u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 3, 0u,
+	1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 16, 0u,
+	1, 4278190080u, 19, 4294967295u, 1, 4278190080u, 3, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u,
+	1, 4294835709u, 1, 4294309365u, 1, 4292796126u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 19, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 19, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 6, 4278190080u,
+	2, 4294967295u, 7, 4278190080u, 19, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 1, 4294440951u, 1, 4294967295u,
+	1, 4293848814u, 2, 4278190080u, 1, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u,
+	1, 4293322470u, 4, 4278190080u, 1, 4293322470u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293322470u, 2, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294309365u, 1, 4294835709u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u,
+	1, 4293059298u, 2, 4278190080u, 8, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294309365u, 1, 4294835709u, 2, 4294967295u,
+	1, 4294704123u, 1, 4294177779u, 1, 4293059298u, 2, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 2, 4278190080u, 19, 4294967295u, 1, 4278190080u,
+	79, 0u, 1, 4278190080u, 19, 4294967295u, 1, 4278190080u, 22, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294572537u,
+	2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4293848814u,
+	1, 4294572537u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 2, 0u, 2, 4278190080u,
+	1, 4293717228u, 1, 4294572537u, 3, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4278190080u,
+	1, 0u, 1, 4278190080u, 9, 4294967295u, 1, 4278190080u, 42, 0u, 1, 4278190080u, 10, 4294967295u, 1, 4278190080u,
+	16, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 5, 0u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u, 2, 4294967295u, 6, 4278190080u, 4, 0u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 10, 0u, 3, 4278190080u, 1, 4293717228u, 1, 4294440951u, 3, 4294967295u, 1, 4294440951u,
+	1, 4293717228u, 3, 4278190080u, 16, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294309365u, 1, 4294835709u, 2, 4294967295u,
+	1, 4294835709u, 1, 4294309365u, 1, 4293322470u, 2, 4278190080u, 18, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	9, 0u, 3, 4278190080u, 1, 4293717228u, 1, 4294440951u, 3, 4294967295u, 1, 4294440951u, 1, 4293717228u, 3, 4278190080u,
+	3, 0u, 1, 4278190080u, 11, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 12, 4294967295u, 6, 4278190080u,
+	4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4292796126u,
+	1, 4294704123u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u, 4, 4278190080u, 3, 0u, 2, 4278190080u,
+	1, 4293322470u, 1, 4294572537u, 2, 4294967295u, 1, 4294572537u, 1, 4293519849u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294835709u, 2, 4294967295u, 1, 4294704123u, 1, 4294046193u,
+	1, 4292467161u, 2, 4278190080u, 8, 0u, 1, 4278190080u, 10, 4294967295u, 1, 4278190080u, 11, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 9, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	5, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u,
+	1, 4294835709u, 2, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u,
+	1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4292467161u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 5, 0u, 2, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u,
+	5, 0u, 2, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u, 10, 4294967295u, 1, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294046193u, 3, 4278190080u,
+	3, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294704123u, 2, 4294967295u, 1, 4294572537u, 1, 4293848814u, 2, 4278190080u,
+	4, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294046193u, 3, 4278190080u,
+	1, 0u, 1, 4278190080u, 11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u,
+	11, 4294967295u, 2, 4278190080u, 11, 4294967295u, 1, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 7, 4294967295u, 1, 4294704123u,
+	1, 4294177779u, 1, 4292467161u, 2, 4278190080u, 3, 0u, 1, 4278190080u, 7, 4294967295u, 1, 4294704123u, 1, 4294046193u,
+	1, 4292467161u, 2, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u,
+	1, 4293059298u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293059298u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294704123u, 2, 4294967295u,
+	1, 4294572537u, 1, 4294046193u, 3, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294704123u,
+	2, 4294967295u, 1, 4294572537u, 1, 4294046193u, 3, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u,
+	1, 4294704123u, 2, 4294967295u, 1, 4294572537u, 1, 4294046193u, 3, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4292467161u,
+	1, 4294177779u, 1, 4294704123u, 2, 4294967295u, 1, 4294572537u, 1, 4294046193u, 3, 4278190080u, 14, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u,
+	1, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u, 1, 4294835709u, 1, 4294309365u, 1, 4293059298u,
+	2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u, 1, 4294835709u, 1, 4294309365u,
+	1, 4293059298u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u, 1, 4294835709u,
+	1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293519849u, 1, 4294440951u, 2, 4294967295u,
+	1, 4294835709u, 1, 4294309365u, 1, 4293059298u, 2, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	25, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	1, 4294177779u, 4, 4294967295u, 1, 4294572537u, 3, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u,
+	1, 4293322470u, 1, 4294572537u, 2, 4294967295u, 1, 4294572537u, 1, 4293519849u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u,
+	1, 4293322470u, 1, 4294572537u, 2, 4294967295u, 1, 4294572537u, 1, 4293519849u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u,
+	1, 4293322470u, 1, 4294572537u, 2, 4294967295u, 1, 4294572537u, 1, 4293519849u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u,
+	1, 4293322470u, 1, 4294572537u, 2, 4294967295u, 1, 4294572537u, 1, 4293519849u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294572537u,
+	1, 4293519849u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294704123u, 2, 4294967295u, 1, 4294572537u,
+	1, 4293322470u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293059298u, 1, 4294309365u, 2, 4294967295u, 1, 4294572537u,
+	1, 4293519849u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294704123u, 2, 4294967295u,
+	1, 4294309365u, 1, 4293322470u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u, 1, 4294704123u,
+	2, 4294967295u, 1, 4294835709u, 1, 4293322470u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292467161u, 1, 4294177779u,
+	1, 4294704123u, 2, 4294967295u, 1, 4294309365u, 1, 4293322470u, 2, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4292467161u,
+	1, 4294177779u, 1, 4294704123u, 2, 4294967295u, 1, 4294309365u, 1, 4293322470u, 2, 4278190080u, 1, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 7, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 5, 0u, 2, 4278190080u,
+	1, 4293717228u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293848814u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 2, 4278190080u, 1, 4293717228u, 1, 4294704123u, 1, 4294967295u, 1, 4294704123u, 1, 4293848814u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 2, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	1, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 3, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 3, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 3, 4278190080u,
+	2, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 3, 4278190080u,
+	16, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294309365u,
+	2, 4294967295u, 1, 4294572537u, 1, 4293322470u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4292796126u, 1, 4294309365u,
+	2, 4294967295u, 1, 4294572537u, 1, 4293322470u, 1, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4292796126u, 1, 4294309365u,
+	2, 4294967295u, 1, 4294572537u, 1, 4293322470u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u,
+	1, 4292796126u, 1, 4294309365u, 2, 4294967295u, 1, 4294572537u, 1, 4293322470u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	3, 0u, 2, 4278190080u, 1, 4294967295u, 1, 4294835709u, 2, 4278190080u, 5, 0u, 2, 4278190080u, 1, 4293717228u,
+	1, 4294572537u, 3, 4294967295u, 1, 4278190080u, 4, 0u, 613, 4278190080u, 8, 0u, 10, 4278190080u, 10, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 6, 0u, 5, 4278190080u, 3, 0u, 7, 4278190080u, 3, 0u,
+	15, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294967295u, 1, 4293322470u, 1, 4278190080u, 2, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 28, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294572537u, 1, 4278190080u, 6, 0u, 4, 4278190080u, 1, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4293848814u, 1, 4278190080u, 11, 0u, 9, 4278190080u, 3, 0u, 28, 4278190080u, 3, 0u, 10, 4278190080u,
+	10, 0u, 4, 4278190080u, 6, 0u, 9, 4278190080u, 6, 0u, 9, 4278190080u, 6, 0u, 4, 4278190080u,
+	8, 0u, 11, 4278190080u, 4, 0u, 9, 4278190080u, 4, 0u, 5, 4278190080u, 1, 4292796126u, 1, 4294572537u,
+	1, 4278190080u, 43, 0u, 4, 4278190080u, 10, 0u, 11, 4278190080u, 3, 0u, 5, 4278190080u, 7, 0u,
+	17, 4278190080u, 5, 0u, 8, 4278190080u, 3, 0u, 12, 4278190080u, 3, 0u, 17, 4278190080u, 12, 0u,
+	16, 4278190080u, 6, 0u, 15, 4278190080u, 2, 0u, 4, 4278190080u, 7, 0u, 21, 4278190080u, 3, 0u,
+	5, 4278190080u, 2, 0u, 8, 4278190080u, 5, 0u, 5, 4278190080u, 3, 0u, 9, 4278190080u, 4, 0u,
+	4, 4278190080u, 12, 0u, 5, 4278190080u, 2, 4294967295u, 3, 4278190080u, 3, 0u, 4, 4278190080u, 5, 0u,
+	5, 4278190080u, 3, 0u, 10, 4278190080u, 7, 0u, 4, 4278190080u, 7, 0u, 9, 4278190080u, 7, 0u,
+	5, 4278190080u, 10, 0u, 5, 4278190080u, 3, 0u, 5, 4278190080u, 4, 0u, 5, 4278190080u, 5, 0u,
+	5, 4278190080u, 6, 0u, 4, 4278190080u, 6, 0u, 14, 4278190080u, 2, 4294967295u, 1, 4278190080u, 11, 0u,
+	1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u, 1, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 37, 0u, 21, 4278190080u, 4, 0u, 8, 4278190080u, 4, 0u, 10, 4278190080u, 2, 0u,
+	9, 4278190080u, 4, 0u, 4, 4278190080u, 4, 0u, 1, 4278190080u, 2, 4294967295u, 4, 4278190080u, 1, 0u,
+	4, 4278190080u, 2, 4294967295u, 5, 4278190080u, 4, 0u, 8, 4278190080u, 3, 0u, 2, 4278190080u, 2, 4294967295u,
+	5, 4278190080u, 3, 0u, 13, 4278190080u, 3, 0u, 4, 4278190080u, 3, 0u, 8, 4278190080u, 4, 0u,
+	4, 4278190080u, 2, 0u, 8, 4278190080u, 3, 0u, 1, 4278190080u, 2, 4294967295u, 7, 4278190080u, 4, 0u,
+	7, 4278190080u, 2, 4294967295u, 5, 4278190080u, 6, 0u, 9, 4278190080u, 4, 0u, 7, 4278190080u, 1, 0u,
+	11, 4278190080u, 3, 0u, 7, 4278190080u, 5, 0u, 5, 4278190080u, 1, 0u, 5, 4278190080u, 3, 0u,
+	5, 4278190080u, 3, 0u, 5, 4278190080u, 2, 0u, 2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u,
+	1, 4278190080u, 4, 0u, 11, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 16, 0u,
+	21, 4278190080u, 4, 0u, 9, 4278190080u, 2, 0u, 22, 4278190080u, 1, 4292796126u, 1, 4294440951u, 23, 4278190080u,
+	1, 4292796126u, 1, 4294572537u, 1, 4278190080u, 1, 4292796126u, 1, 4294440951u, 5, 4278190080u, 1, 0u, 4, 4278190080u,
+	2, 0u, 4, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 5, 0u, 21, 4278190080u, 2, 0u, 5, 4278190080u, 3, 0u, 7, 4278190080u,
+	2, 0u, 7, 4278190080u, 4, 0u, 10, 4278190080u, 10, 0u, 10, 4278190080u, 7, 0u, 4, 4278190080u,
+	5, 0u, 47, 4278190080u, 79, 0u, 21, 4278190080u, 23, 0u, 9, 4278190080u, 8, 0u, 9, 4278190080u,
+	4, 0u, 7, 4278190080u, 1, 0u, 11, 4278190080u, 1, 0u, 11, 4278190080u, 42, 0u, 12, 4278190080u,
+	16, 0u, 5, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4292467161u, 1, 4294309365u, 1, 4294177779u, 3, 4278190080u,
+	2, 4294967295u, 2, 4278190080u, 1, 4294177779u, 1, 4294835709u, 1, 4293519849u, 6, 4278190080u, 1, 4293059298u, 1, 4294967295u,
+	1, 4294704123u, 1, 4278190080u, 12, 0u, 9, 4278190080u, 19, 0u, 3, 4278190080u, 1, 4292796126u, 1, 4294704123u,
+	5, 4278190080u, 19, 0u, 4, 4278190080u, 11, 0u, 9, 4278190080u, 5, 0u, 13, 4278190080u, 9, 0u,
+	15, 4278190080u, 1, 4292796126u, 1, 4294704123u, 1, 4294177779u, 1, 4278190080u, 4, 0u, 4, 4278190080u, 10, 0u,
+	1, 4278190080u, 2, 4294967295u, 8, 4278190080u, 5, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 7, 0u, 1, 4278190080u, 1, 4292796126u, 1, 4294572537u, 4, 4278190080u, 1, 0u, 7, 4278190080u,
+	1, 4292796126u, 1, 4294440951u, 1, 4294177779u, 1, 4278190080u, 3, 0u, 4, 4278190080u, 1, 4294835709u, 5, 4278190080u,
+	9, 0u, 12, 4278190080u, 11, 0u, 4, 4278190080u, 4, 0u, 15, 4278190080u, 5, 0u, 10, 4278190080u,
+	7, 0u, 10, 4278190080u, 7, 0u, 10, 4278190080u, 7, 0u, 10, 4278190080u, 7, 0u, 17, 4278190080u,
+	3, 0u, 8, 4278190080u, 6, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u, 4, 4278190080u, 6, 0u,
+	8, 4278190080u, 3, 0u, 22, 4278190080u, 1, 4292796126u, 1, 4294440951u, 1, 4294046193u, 1, 4278190080u, 1, 0u,
+	26, 4278190080u, 1, 0u, 4, 4278190080u, 6, 0u, 4, 4278190080u, 4, 0u, 12, 4278190080u, 4, 0u,
+	12, 4278190080u, 3, 0u, 4, 4278190080u, 5, 0u, 9, 4278190080u, 5, 0u, 5, 4278190080u, 3, 0u,
+	9, 4278190080u, 7, 0u, 9, 4278190080u, 7, 0u, 9, 4278190080u, 7, 0u, 9, 4278190080u, 16, 0u,
+	4, 4278190080u, 5, 0u, 5, 4278190080u, 2, 0u, 9, 4278190080u, 4, 0u, 9, 4278190080u, 4, 0u,
+	9, 4278190080u, 4, 0u, 9, 4278190080u, 8, 0u, 4, 4278190080u, 25, 0u, 4, 4278190080u, 6, 0u,
+	1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4294704123u, 2, 4294967295u, 1, 4294704123u, 1, 4293848814u, 2, 4278190080u,
+	1, 0u, 4, 4278190080u, 7, 0u, 11, 4278190080u, 1, 0u, 11, 4278190080u, 1, 0u, 11, 4278190080u,
+	1, 0u, 15, 4278190080u, 6, 0u, 8, 4278190080u, 4, 0u, 2, 4278190080u, 1, 4292796126u, 1, 4294704123u,
+	4, 4278190080u, 4, 0u, 8, 4278190080u, 4, 0u, 9, 4278190080u, 4, 0u, 4, 4278190080u, 1, 4293322470u,
+	1, 4294572537u, 1, 4292796126u, 2, 4278190080u, 4, 0u, 9, 4278190080u, 4, 0u, 9, 4278190080u, 2, 0u,
+	4, 4278190080u, 7, 0u, 4, 4278190080u, 6, 0u, 10, 4278190080u, 7, 0u, 10, 4278190080u, 2, 0u,
+	4, 4278190080u, 4, 0u, 8, 4278190080u, 4, 0u, 4, 4278190080u, 2, 0u, 8, 4278190080u, 5, 0u,
+	8, 4278190080u, 5, 0u, 8, 4278190080u, 5, 0u, 8, 4278190080u, 18, 0u, 4, 4278190080u, 7, 0u,
+	11, 4278190080u, 1, 0u, 11, 4278190080u, 1, 0u, 11, 4278190080u, 2, 0u, 11, 4278190080u, 2, 0u,
+	2, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294177779u, 1, 4278190080u, 7, 0u, 7, 4278190080u, 645, 0u,
+	4, 4278190080u, 44, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294309365u, 4, 4278190080u, 1, 4294177779u, 1, 4294704123u,
+	2, 4278190080u, 28, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4293717228u, 1, 4278190080u, 10, 0u, 2, 4278190080u,
+	2, 4294835709u, 2, 4278190080u, 158, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4293717228u, 1, 4278190080u, 295, 0u,
+	1, 4278190080u, 1, 4294440951u, 1, 4294967295u, 1, 4294177779u, 4, 4278190080u, 138, 0u, 1, 4278190080u, 2, 4294967295u,
+	4, 4278190080u, 8, 0u, 2, 4278190080u, 2, 4294835709u, 6, 4278190080u, 2, 4294967295u, 1, 4278190080u, 13, 0u,
+	15, 4278190080u, 79, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4294572537u, 1, 4293519849u, 1, 4292467161u,
+	3, 4278190080u, 1, 4292796126u, 1, 4293519849u, 1, 4294572537u, 1, 4294967295u, 1, 4294440951u, 1, 4278190080u, 16, 0u,
+	4, 4278190080u, 1, 4294177779u, 1, 4294967295u, 1, 4294572537u, 1, 4278190080u, 59, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 16, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 84, 0u, 3, 4278190080u, 1, 4293059298u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 1, 4278190080u, 16, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u,
+	1, 4293848814u, 3, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u,
+	73, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4293519849u, 1, 4278190080u, 21, 0u, 1, 4278190080u, 1, 4294046193u,
+	1, 4293519849u, 1, 4278190080u, 1, 4294046193u, 1, 4293519849u, 1, 4278190080u, 20, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 414, 0u, 1, 4278190080u, 1, 4294572537u,
+	1, 4294967295u, 2, 4278190080u, 1, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 1, 4293322470u, 2, 4294967295u,
+	1, 4294177779u, 1, 4292796126u, 2, 4278190080u, 1, 4292467161u, 1, 4293848814u, 1, 4294835709u, 1, 4294967295u, 1, 4293717228u,
+	1, 4278190080u, 42, 0u, 1, 4278190080u, 1, 4294177779u, 2, 4294967295u, 1, 4294572537u, 1, 4292796126u, 1, 4278190080u,
+	85, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 18, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 12, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 7, 0u,
+	1, 4278190080u, 1, 4294177779u, 2, 4294967295u, 1, 4294309365u, 1, 4292796126u, 1, 4278190080u, 7, 0u, 1, 4278190080u,
+	1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 5, 0u, 1, 4278190080u, 1, 4292796126u, 2, 4294967295u, 1, 4294572537u,
+	1, 4292796126u, 1, 4278190080u, 164, 0u, 1, 4278190080u, 1, 4294177779u, 2, 4294967295u, 1, 4294440951u, 1, 4292796126u,
+	1, 4278190080u, 38, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4294967295u, 2, 4278190080u, 281, 0u, 2, 4278190080u,
+	1, 4294704123u, 1, 4294835709u, 1, 4278190080u, 6, 0u, 1, 4278190080u, 2, 4294967295u, 8, 4278190080u, 83, 0u,
+	1, 4278190080u, 1, 4294046193u, 2, 4294967295u, 1, 4294572537u, 1, 4292796126u, 1, 4278190080u, 32, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4293059298u, 3, 4278190080u, 227, 0u, 3, 4278190080u, 1, 4293059298u, 1, 4294835709u, 1, 4294967295u,
+	1, 4293059298u, 1, 4278190080u, 7, 0u, 2, 4278190080u, 1, 4294704123u, 1, 4294835709u, 1, 4278190080u, 696, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294967295u, 1, 4292467161u, 2, 4278190080u, 1, 4292467161u, 1, 4294967295u, 1, 4293322470u,
+	1, 4278190080u, 29, 0u, 4, 4278190080u, 10, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u, 1, 4293848814u,
+	1, 4278190080u, 159, 0u, 4, 4278190080u, 295, 0u, 1, 4278190080u, 1, 4293322470u, 5, 4294967295u, 1, 4278190080u,
+	138, 0u, 1, 4278190080u, 5, 4294967295u, 1, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4293848814u, 1, 4294967295u,
+	1, 4293848814u, 2, 4278190080u, 5, 4294967295u, 1, 4278190080u, 13, 0u, 1, 4278190080u, 13, 4294967295u, 1, 4278190080u,
+	79, 0u, 1, 4278190080u, 1, 4293519849u, 10, 4294967295u, 1, 4294835709u, 1, 4292796126u, 1, 4278190080u, 16, 0u,
+	1, 4278190080u, 5, 4294967295u, 1, 4293717228u, 1, 4278190080u, 59, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	16, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 84, 0u, 1, 4278190080u, 4, 4294967295u, 1, 4294177779u,
+	2, 4278190080u, 16, 0u, 1, 4278190080u, 1, 4294177779u, 3, 4294967295u, 2, 4278190080u, 2, 4294967295u, 2, 4278190080u,
+	3, 4294967295u, 1, 4294177779u, 1, 4278190080u, 73, 0u, 4, 4278190080u, 21, 0u, 7, 4278190080u, 20, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 414, 0u,
+	1, 4278190080u, 2, 4294967295u, 1, 4292796126u, 3, 4278190080u, 2, 4294967295u, 3, 4278190080u, 1, 4293717228u, 8, 4294967295u,
+	1, 4294046193u, 2, 4278190080u, 42, 0u, 3, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u,
+	85, 0u, 1, 4278190080u, 1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 3, 4278190080u, 16, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 12, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	7, 0u, 3, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 7, 0u, 1, 4278190080u,
+	1, 4294835709u, 1, 4294967295u, 1, 4293059298u, 3, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4292796126u, 1, 4294967295u,
+	1, 4294835709u, 1, 4278190080u, 164, 0u, 3, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294835709u, 1, 4278190080u,
+	38, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4292796126u, 2, 4278190080u, 280, 0u, 1, 4278190080u, 1, 4292796126u,
+	1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 6, 0u, 4, 4278190080u, 90, 0u, 3, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294835709u, 1, 4278190080u, 32, 0u, 1, 4278190080u, 1, 4293717228u, 1, 4294704123u, 2, 4294967295u,
+	1, 4294704123u, 1, 4278190080u, 227, 0u, 1, 4278190080u, 4, 4294967295u, 1, 4294177779u, 2, 4278190080u, 7, 0u,
+	1, 4278190080u, 1, 4292796126u, 1, 4294967295u, 1, 4293519849u, 1, 4278190080u, 696, 0u, 2, 4278190080u, 1, 4294309365u,
+	1, 4294440951u, 2, 4278190080u, 1, 4294309365u, 1, 4294177779u, 2, 4278190080u, 43, 0u, 1, 4278190080u, 2, 4294835709u,
+	2, 4278190080u, 458, 0u, 2, 4278190080u, 1, 4293322470u, 1, 4294572537u, 3, 4294967295u, 1, 4278190080u, 138, 0u,
+	1, 4278190080u, 5, 4294967295u, 1, 4278190080u, 9, 0u, 2, 4278190080u, 2, 4294835709u, 2, 4278190080u, 5, 4294967295u,
+	1, 4278190080u, 13, 0u, 1, 4278190080u, 13, 4294967295u, 1, 4278190080u, 79, 0u, 2, 4278190080u, 1, 4292467161u,
+	1, 4294046193u, 1, 4294440951u, 4, 4294967295u, 1, 4294704123u, 1, 4294309365u, 1, 4293717228u, 3, 4278190080u, 16, 0u,
+	1, 4278190080u, 3, 4294967295u, 1, 4294572537u, 1, 4293322470u, 2, 4278190080u, 59, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4278190080u, 16, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 84, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4294835709u, 1, 4294046193u, 2, 4278190080u, 17, 0u, 2, 4278190080u, 1, 4294177779u, 1, 4294835709u, 1, 4294967295u,
+	2, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4294177779u, 2, 4278190080u, 125, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 10, 0u, 1, 4278190080u, 2, 4294967295u, 1, 4278190080u, 414, 0u, 1, 4278190080u,
+	1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4294704123u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u, 1, 0u,
+	2, 4278190080u, 1, 4293059298u, 1, 4294177779u, 1, 4294704123u, 2, 4294967295u, 1, 4294704123u, 1, 4294177779u, 1, 4293059298u,
+	2, 4278190080u, 42, 0u, 4, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 85, 0u,
+	1, 4278190080u, 1, 4293322470u, 1, 4294572537u, 2, 4294967295u, 1, 4294309365u, 1, 4278190080u, 16, 0u, 1, 4278190080u,
+	2, 4294967295u, 1, 4278190080u, 12, 0u, 1, 4278190080u, 2, 4294967295u, 2, 4278190080u, 2, 4294967295u, 1, 4278190080u,
+	6, 0u, 4, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 7, 0u, 1, 4278190080u,
+	1, 4293322470u, 1, 4294704123u, 2, 4294967295u, 1, 4294704123u, 1, 4278190080u, 3, 0u, 3, 4278190080u, 1, 4292796126u,
+	1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 163, 0u, 4, 4278190080u, 1, 4293059298u, 1, 4294967295u, 1, 4294704123u,
+	1, 4278190080u, 38, 0u, 1, 4278190080u, 1, 4293519849u, 1, 4294835709u, 1, 4294967295u, 1, 4294704123u, 1, 4278190080u,
+	280, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294704123u, 2, 4278190080u, 99, 0u, 4, 4278190080u, 1, 4293059298u,
+	1, 4294967295u, 1, 4294704123u, 1, 4278190080u, 32, 0u, 7, 4278190080u, 227, 0u, 1, 4278190080u, 2, 4294967295u,
+	1, 4294835709u, 1, 4294046193u, 2, 4278190080u, 8, 0u, 1, 4278190080u, 1, 4294046193u, 1, 4294704123u, 2, 4278190080u,
+	697, 0u, 8, 4278190080u, 44, 0u, 4, 4278190080u, 460, 0u, 7, 4278190080u, 138, 0u, 7, 4278190080u,
+	10, 0u, 11, 4278190080u, 13, 0u, 15, 4278190080u, 80, 0u, 12, 4278190080u, 18, 0u, 7, 4278190080u,
+	60, 0u, 4, 4278190080u, 16, 0u, 4, 4278190080u, 84, 0u, 6, 4278190080u, 19, 0u, 14, 4278190080u,
+	126, 0u, 4, 4278190080u, 10, 0u, 4, 4278190080u, 414, 0u, 10, 4278190080u, 2, 0u, 10, 4278190080u,
+	43, 0u, 1, 4278190080u, 1, 4294704123u, 3, 4294967295u, 1, 4294309365u, 1, 4292796126u, 1, 4278190080u, 85, 0u,
+	7, 4278190080u, 16, 0u, 4, 4278190080u, 12, 0u, 8, 4278190080u, 6, 0u, 1, 4278190080u, 1, 4294440951u,
+	3, 4294967295u, 1, 4294440951u, 1, 4292796126u, 1, 4278190080u, 7, 0u, 7, 4278190080u, 3, 0u, 1, 4278190080u,
+	1, 4294704123u, 2, 4294967295u, 1, 4294704123u, 1, 4292796126u, 1, 4278190080u, 163, 0u, 1, 4278190080u, 1, 4294704123u,
+	3, 4294967295u, 1, 4294309365u, 1, 4292796126u, 1, 4278190080u, 38, 0u, 6, 4278190080u, 280, 0u, 1, 4278190080u,
+	1, 4294704123u, 1, 4293059298u, 1, 4278190080u, 100, 0u, 1, 4278190080u, 1, 4294572537u, 3, 4294967295u, 1, 4294440951u,
+	1, 4292796126u, 1, 4278190080u, 266, 0u, 6, 4278190080u, 9, 0u, 1, 4278190080u, 1, 4294704123u, 1, 4293059298u,
+	1, 4278190080u, 2362, 0u, 8, 4278190080u, 138, 0u, 8, 4278190080u, 17, 0u, 7, 4278190080u, 163, 0u,
+	8, 4278190080u, 324, 0u, 4, 4278190080u, 100, 0u, 8, 4278190080u, 281, 0u, 4, 4278190080u, 3439, 0u,
+};
+static const BakedFont FontData_Source = { 31, 3432, 31, FontData_Source_glyphWidths, FontData_Source_runs, 56144 };
+
+#endif
@@ -6,7 +6,9 @@
 #include <iostream>
 #include <cassert>
 #include <algorithm>
-#include <queue>
+#include <thread>
+#include <fstream>
+#include <cstdio>
 
 //#define DEBUG_CTORS
 #ifdef DEBUG_CTORS
@@ -21,17 +23,40 @@
 	#define IMAGE_NO_EXCEPT
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define IMAGE_SSE2
+	#include <emmintrin.h>
+#endif
 
 
-class Image {
+
+//Buffers the PNG decoder and encoder keep from one file to the next, pass the same one to every load or save when
+//going through a lot of images.  One per thread, they can't be shared by loads or saves running at the same time
+class PngCodecContext {
 public:
-	static int qsort_compare_channel(const void* a, const void* b) {
-		return (*static_cast<const uint8_t*>(a)) - (*static_cast<const uint8_t*>(b)); // Ascending order
-	}
-	static int qsort_compare_greyscale(const void* a, const void* b) {
-		return GreyScale(*static_cast<const uint32_t*>(a)) - GreyScale(*static_cast<const uint32_t*>(b)); // Ascending order
+	PngCodecContext(){ lodepng_scratch_init(&_scratch); }
+	~PngCodecContext(){ lodepng_scratch_cleanup(&_scratch); }
+	PngCodecContext(const PngCodecContext &) = delete;
+	PngCodecContext & operator=(const PngCodecContext &) = delete;
+	
+	//Gives all the memory back, the next file starts from nothing again
+	void clear(){
+		lodepng_scratch_cleanup(&_scratch);
+		std::vector<unsigned char>().swap(_file);
 	}
+	
+	//Most bytes the last load had in use at once, file and pixels included
+	inline size_t peakBytes() const { return _peakBytes; }
+	
+private:
+	friend class Image;
+	LodePNGScratch _scratch;
+	std::vector<unsigned char> _file;  //The PNG being written, files being read are mapped instead
+	size_t _peakBytes = 0;
+};
 
+class Image {
+public:
 	static uint32_t Color(uint32_t r, uint32_t g, uint32_t b){ return r | (g << 8) | (b << 16) | 4278190080UL; }
 	static uint32_t Color(uint32_t r, uint32_t g, uint32_t b, uint32_t a){ return r | (g << 8) | (b << 16) | (a << 24); }
 	
@@ -53,6 +78,10 @@ public:
 	inline static float toFloat(uint8_t part){ return static_cast<float>(part) / 255.0f; }
 	inline static uint8_t fromFloat(float part){ return static_cast<uint8_t>(255.0f * part); }
 	inline static uint8_t fromFloat(double part) { return static_cast<uint8_t>(255.0 * part); }
+	inline static int64_t FloorDiv(int64_t n, int64_t d){
+		const int64_t q = n / d;
+		return ((n % d != 0) && ((n < 0) != (d < 0))) ? q - 1 : q;
+	}
 	inline static uint8_t GreyScale(uint32_t color){
 		uint32_t other = Red(color);
 		other += Green(color);
@@ -61,11 +90,96 @@ public:
 		return static_cast<uint8_t>(other);
 	}
 	
+	//Blend weights are 8.8 fixed point, 0 is all of the first color and 256 is all of the second
+	inline static uint32_t BlendWeight(float a){
+		if (!(a > 0.0f)) return 0;
+		if (a >= 1.0f) return 256;
+		return static_cast<uint32_t>(a * 256.0f + 0.5f);
+	}
+	
+	//Scales a weight by a pixel's alpha, 255 maps to the full weight
+	inline static uint32_t BlendWeight(uint32_t weight, uint8_t alpha){
+		return (weight * (static_cast<uint32_t>(alpha) + (alpha >> 7))) >> 8;
+	}
+	
+	//Lerps the colors, red/blue and green/alpha are done as pairs of 16 bit lanes.  Alpha goes toward 255 by the same
+	//weight, two over one, since two's own alpha is already in the weight.  Opaque stays opaque
+	inline static uint32_t ColorBetween_fixed(uint32_t one, uint32_t two, uint32_t weight){
+		const uint32_t inverse = 256 - weight;
+		const uint32_t rb = ((((one & 0x00FF00FFu) * inverse) + ((two & 0x00FF00FFu) * weight) + 0x00800080u) >> 8) & 0x00FF00FFu;
+		const uint32_t ga = ((((one >> 8) & 0x00FF00FFu) * inverse) + ((((two >> 8) & 0x000000FFu) | 0x00FF0000u) * weight) + 0x00800080u) & 0xFF00FF00u;
+		return rb | ga;
+	}
+	
 	inline static uint32_t ColorBetween(uint32_t one, uint32_t two, float a){
-		const float r = (Red_f(two) * a) + (Red_f(one) * (1.0f - a));
-		const float g = (Green_f(two) * a) + (Green_f(one) * (1.0f - a));
-		const float b = (Blue_f(two) * a) + (Blue_f(one) * (1.0f - a));
-		return Color_f(r, g, b);
+		return ColorBetween_fixed(one, two, BlendWeight(a));
+	}
+	
+	//Blends source over dest, each source pixel's alpha scales the weight.  Same results as ColorBetween_fixed per pixel
+	static void BlendRow(uint32_t * dest, const uint32_t * source, int count, uint32_t weight){
+		int i = 0;
+#ifdef IMAGE_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i weights = _mm_set1_epi32(static_cast<int>(weight));
+		const __m128i full = _mm_set1_epi16(256);
+		const __m128i round = _mm_set1_epi16(128);
+		const __m128i opaque = _mm_slli_epi32(_mm_set1_epi32(255), 24);
+		for(; i + 4 <= count; i += 4){
+			const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+			const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dest + i));
+			
+			//Per pixel weight, (weight * (alpha + (alpha >> 7))) >> 8, copied into both 16 bit halves
+			__m128i alpha = _mm_srli_epi32(s, 24);
+			alpha = _mm_add_epi32(alpha, _mm_srli_epi32(alpha, 7));
+			__m128i w = _mm_srli_epi32(_mm_madd_epi16(alpha, weights), 8);
+			w = _mm_or_si128(w, _mm_slli_epi32(w, 16));
+			const __m128i wLo = _mm_unpacklo_epi32(w, w);
+			const __m128i wHi = _mm_unpackhi_epi32(w, w);
+			
+			//Alpha goes toward 255, as in ColorBetween_fixed
+			const __m128i over = _mm_or_si128(s, opaque);
+			__m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_sub_epi16(full, wLo)), _mm_mullo_epi16(_mm_unpacklo_epi8(over, zero), wLo));
+			__m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_sub_epi16(full, wHi)), _mm_mullo_epi16(_mm_unpackhi_epi8(over, zero), wHi));
+			lo = _mm_srli_epi16(_mm_add_epi16(lo, round), 8);
+			hi = _mm_srli_epi16(_mm_add_epi16(hi, round), 8);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_packus_epi16(lo, hi));
+		}
+#endif
+		for(; i < count; ++i){
+			dest[i] = ColorBetween_fixed(dest[i], source[i], BlendWeight(weight, Alpha(source[i])));
+		}
+	}
+
+	//Spans at least this big skip the cache when filled, they'd only push everything else out of it
+	static const size_t STREAM_FILL_BYTES = 1 << 20;
+	
+	//Fills count pixels with color using 16 byte stores
+	static void FillSpan(uint32_t * dest, size_t count, uint32_t color){
+#ifdef IMAGE_SSE2
+		const uint32_t * end = dest + count;
+		for(; dest < end && (reinterpret_cast<uintptr_t>(dest) & 15) != 0; ++dest) *dest = color;
+		const __m128i fill = _mm_set1_epi32(static_cast<int>(color));
+		const uint32_t * wideEnd = dest + ((end - dest) & ~static_cast<ptrdiff_t>(15));
+		if (count * 4 >= STREAM_FILL_BYTES){
+			for(; dest < wideEnd; dest += 16){
+				_mm_stream_si128(reinterpret_cast<__m128i*>(dest), fill);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(dest + 4), fill);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(dest + 8), fill);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(dest + 12), fill);
+			}
+			_mm_sfence();
+		} else {
+			for(; dest < wideEnd; dest += 16){
+				_mm_store_si128(reinterpret_cast<__m128i*>(dest), fill);
+				_mm_store_si128(reinterpret_cast<__m128i*>(dest + 4), fill);
+				_mm_store_si128(reinterpret_cast<__m128i*>(dest + 8), fill);
+				_mm_store_si128(reinterpret_cast<__m128i*>(dest + 12), fill);
+			}
+		}
+		for(; dest < end; ++dest) *dest = color;
+#else
+		std::fill_n(dest, count, color);
+#endif
 	}
 
 	inline ~Image(){ 
@@ -79,19 +193,11 @@ public:
 	}
 	inline Image(size_t width, size_t height, uint32_t fillcolor = 255) : _width(static_cast<int>(width)), _widthTimes4(static_cast<int>(width << 2)), _height(static_cast<int>(height)), _image(width * height * 4){
 		CTOR_OUT("Creating fill " << static_cast<void*>(this));
-		for(int x = 0; x < _width; ++x){
-			for(int y = 0; y < _height; ++y){
-				*(reinterpret_cast<uint32_t*>(&_image[pixelIndex(x, y)])) = fillcolor;
-			}
-		}
+		if (!_image.empty()) FillSpan(reinterpret_cast<uint32_t*>(_image.data()), _image.size() / 4, fillcolor);
 	}
 	inline Image(int width, int height, uint32_t fillcolor = 255) : _width(width), _widthTimes4(width * 4), _height(height), _image(static_cast<size_t>(width * height) * 4){
 		CTOR_OUT("Creating fill " << static_cast<void*>(this));
-		for(int x = 0; x < _width; ++x){
-			for(int y = 0; y < _height; ++y){
-				*(reinterpret_cast<uint32_t*>(&_image[pixelIndex(x, y)])) = fillcolor;
-			}
-		}
+		if (!_image.empty()) FillSpan(reinterpret_cast<uint32_t*>(_image.data()), _image.size() / 4, fillcolor);
 	}
 	inline Image(const char * filename) : _width(0), _widthTimes4(0), _height(0), _image(){ 
 		CTOR_OUT("Creating cname " << static_cast<void*>(this));
@@ -120,20 +226,20 @@ public:
 	void pset_blend(int x, int y, uint32_t color, float a = 1.0f){
 		if (x < 0 || x >= _width) return;
 		if (y < 0 || y >= _height) return;
-		a *= Alpha_f(color);
-		if (a <= 0.0f) return;
+		const uint32_t weight = BlendWeight(BlendWeight(a), Alpha(color));
+		if (weight == 0) return;
 		const std::vector<unsigned char>::size_type ppp = pixelIndex(x, y);
 		assert(ppp < _image.size());
 		const uint32_t current = *(reinterpret_cast<uint32_t*>(&_image[ppp]));
-		*(reinterpret_cast<uint32_t*>(&_image[ppp])) = ColorBetween(current, color, a);
+		*(reinterpret_cast<uint32_t*>(&_image[ppp])) = ColorBetween_fixed(current, color, weight);
 	}
 
 	void pset_blend_unsafe(int x, int y, uint32_t color, float a = 1.0f) {
-		a *= Alpha_f(color);
-		if (a <= 0.0f) return;
+		const uint32_t weight = BlendWeight(BlendWeight(a), Alpha(color));
+		if (weight == 0) return;
 		const std::vector<unsigned char>::size_type ppp = pixelIndex(x, y);
 		const uint32_t current = *(reinterpret_cast<uint32_t*>(&_image[ppp]));
-		*(reinterpret_cast<uint32_t*>(&_image[ppp])) = ColorBetween(current, color, a);
+		*(reinterpret_cast<uint32_t*>(&_image[ppp])) = ColorBetween_fixed(current, color, weight);
 	}
 	
 	inline uint32_t point(int x, int y) const {
@@ -230,13 +336,12 @@ public:
 	void put_blend(const Image & img, int x, int y, float a = 1.0f){
 		PUT_BOUNDARY_CHECK()
 		
-		int iyThis = startYThis;
-		for(int iy = startYImg; iy <= endYImg; ++iy, ++iyThis){
-			int ixThis = startXThis;
-			for(int ix = startXImg; ix <= endXImg; ++ix, ++ixThis){
-				pset_blend_unsafe(ixThis, iyThis, img.point_unsafe(ix, iy), a);
-			}
-		}
+		const uint32_t weight = BlendWeight(a);
+		if (weight == 0) return;
+		const int count = endXImg - startXImg + 1;
+		const uint32_t* source = reinterpret_cast<const uint32_t*>(&img._image[img.pixelIndex(startXImg, startYImg)]);
+		uint32_t* dest = reinterpret_cast<uint32_t*>(&_image[pixelIndex(startXThis, startYThis)]);
+		for (int iy = startYImg; iy <= endYImg; ++iy, source += img._width, dest += _width) BlendRow(dest, source, count, weight);
 	}
 	
 	void circle(int x, int y, int radius, uint32_t color){
@@ -293,6 +398,7 @@ public:
 		if (x < 0 || x >= _width) return;
 		if (y < 0) y = 0;
 		if (y2 >= _height) y2 = _height - 1;
+		if (y > y2) return;
 		uint32_t* iterato = reinterpret_cast<uint32_t*>(&_image[pixelIndex(x, y)]);
 		const uint32_t* en = iterato + (y2 - y + 1) * _width;
 		for (; iterato < en; iterato += _width) *(iterato) = color;
@@ -301,35 +407,121 @@ public:
 		if (y < 0 || y >= _height) return;
 		if (x < 0) x = 0;
 		if (x2 >= _width) x2 = _width - 1;
-		uint32_t * iterato = reinterpret_cast<uint32_t*>(&_image[pixelIndex(x, y)]);
-		const uint32_t* en = iterato + (x2 - x + 1);
-		for (; iterato < en; ++iterato) *(iterato) = color;
+		if (x > x2) return;
+		FillSpan(reinterpret_cast<uint32_t*>(&_image[pixelIndex(x, y)]), static_cast<size_t>(x2 - x + 1), color);
+	}
+	
+	//Clips a Bresenham walk from (x, y) to (x2, y2) against columns left to right and rows top to bottom.  Moves (x, y) and
+	//error to the first pixel inside and sets steps to how many pixels are inside, so the walk hits exactly the pixels the
+	//full one would
+	static bool clip_line(int & x, int & y, int x2, int y2, int & error, int & steps, int left, int top, int right, int bottom){
+		if (left > right || top > bottom) return false;
+		//Cohen-Sutherland style trivial reject, both ends off the same side
+		if ((x < left && x2 < left) || (x > right && x2 > right)) return false;
+		if ((y < top && y2 < top) || (y > bottom && y2 > bottom)) return false;
+		
+		const int64_t a = abs(x2 - x);
+		const int64_t b = abs(y2 - y);
+		const bool xMajor = a >= b;
+		const int64_t major = xMajor ? a : b;
+		const int64_t minor = xMajor ? b : a;
+		const int64_t majorStart = xMajor ? x : y;
+		const int64_t minorStart = xMajor ? y : x;
+		const int64_t majorMin = xMajor ? left : top;
+		const int64_t majorMax = xMajor ? right : bottom;
+		const int64_t minorMin = xMajor ? top : left;
+		const int64_t minorMax = xMajor ? bottom : right;
+		const int64_t majorDir = xMajor ? (x < x2 ? 1 : -1) : (y < y2 ? 1 : -1);
+		const int64_t minorDir = xMajor ? (y < y2 ? 1 : -1) : (x < x2 ? 1 : -1);
+		
+		//Step k along the major axis lands at minor offset floor((2 * minor * k + major) / (2 * major))
+		int64_t kLo = 0;
+		int64_t kHi = major;
+		if (majorDir > 0){
+			kLo = std::max(kLo, majorMin - majorStart);
+			kHi = std::min(kHi, majorMax - majorStart);
+		} else {
+			kLo = std::max(kLo, majorStart - majorMax);
+			kHi = std::min(kHi, majorStart - majorMin);
+		}
+		const int64_t mLo = (minorDir > 0) ? minorMin - minorStart : minorStart - minorMax;
+		const int64_t mHi = (minorDir > 0) ? minorMax - minorStart : minorStart - minorMin;
+		if (minor == 0){
+			if (mLo > 0 || mHi < 0) return false;
+		} else {
+			kLo = std::max(kLo, -FloorDiv(-(2 * major * mLo - major), 2 * minor));
+			kHi = std::min(kHi, -FloorDiv(-(2 * major * mHi + major), 2 * minor) - 1);
+		}
+		if (kLo > kHi) return false;
+		
+		const int64_t m = (major == 0) ? 0 : FloorDiv(2 * minor * kLo + major, 2 * major);
+		if (xMajor){
+			error = static_cast<int>(a - b - kLo * b + m * a);
+			x = static_cast<int>(majorStart + majorDir * kLo);
+			y = static_cast<int>(minorStart + minorDir * m);
+		} else {
+			error = static_cast<int>(a - b + kLo * a - m * b);
+			y = static_cast<int>(majorStart + majorDir * kLo);
+			x = static_cast<int>(minorStart + minorDir * m);
+		}
+		steps = static_cast<int>(kHi - kLo + 1);
+		return true;
+	}
+	
+	inline bool clip_line(int & x, int & y, int x2, int y2, int & error, int & steps) const {
+		return clip_line(x, y, x2, y2, error, steps, 0, 0, _width - 1, _height - 1);
+	}
+	
+	inline void line(int x, int y, int x2, int y2, uint32_t color){
+		line_in_rows(x, y, x2, y2, color, 0, _height - 1);
 	}
 	
-	void line(int x, int y, int x2, int y2, uint32_t color){
+	//Only draws the part of the line that falls in rows top to bottom, the pixels are the same ones line would draw there
+	void line_in_rows(int x, int y, int x2, int y2, uint32_t color, int top, int bottom){
+		if (top < 0) top = 0;
+		if (bottom >= _height) bottom = _height - 1;
+		if (y == y2){
+			if (y >= top && y <= bottom) hline(y, std::min(x, x2), std::max(x, x2), color);
+			return;
+		}
+		if (x == x2){
+			const int yStart = std::max(std::min(y, y2), top);
+			const int yEnd = std::min(std::max(y, y2), bottom);
+			if (yStart <= yEnd) vline(x, yStart, yEnd, color);
+			return;
+		}
 		const int dx = abs(x2 - x);
 		const int sx = x < x2 ? 1 : -1;
 		const int dy = -abs(y2 - y);
-		const int sy = y < y2 ? 1 : -1;
-		int error = dx + dy;
+		const int rowStep = y < y2 ? _width : -_width;
+		int error, steps;
+		if (!clip_line(x, y, x2, y2, error, steps, 0, top, _width - 1, bottom)) return;
+		
+		//Everything left is on the image, so step a pointer instead of going through pset
+		uint32_t * iterato = reinterpret_cast<uint32_t*>(&_image[pixelIndex(x, y)]);
 		int e2;
 		while(true){
-			pset(x, y, color);
-			if ((x == x2) && (y == y2)) return;
+			*iterato = color;
+			if (--steps == 0) return;
 			e2 = error << 1;
 			if (e2 >= dy){
-				if (x == x2) return;
 				error += dy;
-				x += sx;
+				iterato += sx;
 			}
 			if (e2 <= dx){
-				if (y == y2) return;
 				error += dx;
-				y += sy;
+				iterato += rowStep;
 			}
 		}
 	}
 	
+	//Draws a line from each point to the next
+	void polyline(const std::vector<std::pair<int, int> > & points, uint32_t color){
+		for(size_t i = 1; i < points.size(); ++i){
+			line(points[i - 1].first, points[i - 1].second, points[i].first, points[i].second, color);
+		}
+	}
+	
 	void line_gradient(int x, int y, int x2, int y2, uint32_t color1, uint32_t color2){
 		const int dx = abs(x2 - x);
 		const int sx = x < x2 ? 1 : -1;
@@ -364,19 +556,18 @@ public:
 		const int sx = x < x2 ? 1 : -1;
 		const int dy = -abs(y2 - y);
 		const int sy = y < y2 ? 1 : -1;
-		int error = dx + dy;
+		int error, steps;
+		if (!clip_line(x, y, x2, y2, error, steps)) return;
 		int e2;
 		while(true){
 			pset_blend_unsafe(x, y, color, a);
-			if ((x == x2) && (y == y2)) return;
+			if (--steps == 0) return;
 			e2 = error << 1;
 			if (e2 >= dy){
-				if (x == x2) return;
 				error += dy;
 				x += sx;
 			}
 			if (e2 <= dx){
-				if (y == y2) return;
 				error += dx;
 				y += sy;
 			}
@@ -407,18 +598,46 @@ public:
 		hline(y2, xPlus1, x2Minus1, color);
 	}
 	
-	inline void rect_fill_x2_and_y2(int x, int y, int x2, int y2, uint32_t color){
+	void rect_fill_x2_and_y2(int x, int y, int x2, int y2, uint32_t color){
 		if (x2 < x){ int tmp = x; x = x2; x2 = tmp; }
 		if (y2 < y){ int tmp = y; y = y2; y2 = tmp; }
-		for(;y <= y2; ++y) hline(y, x, x2, color);
+		//Clip once for the whole rectangle instead of every row
+		if (x < 0) x = 0;
+		if (y < 0) y = 0;
+		if (x2 >= _width) x2 = _width - 1;
+		if (y2 >= _height) y2 = _height - 1;
+		if (x > x2 || y > y2) return;
+		
+		uint32_t * iterato = reinterpret_cast<uint32_t*>(&_image[pixelIndex(x, y)]);
+		const size_t rowPixels = static_cast<size_t>(x2 - x + 1);
+		const size_t rows = static_cast<size_t>(y2 - y + 1);
+		if (rowPixels == static_cast<size_t>(_width)){  //Full rows are one contiguous span
+			FillSpan(iterato, rowPixels * rows, color);
+			return;
+		}
+		if (rowPixels * rows * 4 >= STREAM_FILL_BYTES && rowPixels >= 64){
+			//Big enough to go around the cache, but each row on its own might not be
+#ifdef IMAGE_SSE2
+			const __m128i fill = _mm_set1_epi32(static_cast<int>(color));
+			for(size_t row = 0; row < rows; ++row, iterato += _width){
+				uint32_t * dest = iterato;
+				const uint32_t * end = dest + rowPixels;
+				for(; (reinterpret_cast<uintptr_t>(dest) & 15) != 0; ++dest) *dest = color;
+				const uint32_t * wideEnd = dest + ((end - dest) & ~static_cast<ptrdiff_t>(3));
+				for(; dest < wideEnd; dest += 4) _mm_stream_si128(reinterpret_cast<__m128i*>(dest), fill);
+				for(; dest < end; ++dest) *dest = color;
+			}
+			_mm_sfence();
+			return;
+#endif
+		}
+		for(size_t row = 0; row < rows; ++row, iterato += _width) FillSpan(iterato, rowPixels, color);
 	}
 	
-	void rect_fill_width_and_height(int x, int y, int w, int h, uint32_t color){
+	inline void rect_fill_width_and_height(int x, int y, int w, int h, uint32_t color){
 		if (w < 1) return;
 		if (h < 1) return;
-		const int x2 = x + w;
-		const int y2 = y + h;
-		for (; y <= y2; ++y) hline(y, x, x2, color);
+		rect_fill_x2_and_y2(x, y, x + w, y + h, color);
 	}
 	
 	inline void rect_fill_w_outline_x2_and_y2(int x, int y, int x2, int y2, uint32_t fillcolor, uint32_t outlinecolor){
@@ -432,13 +651,76 @@ public:
 	}
 	
 	
-	inline bool save(const std::string & filename) const { return save(filename.c_str()); }
-	bool save(const char * filename) const {
+	//Encoder speed against file size.  Default leaves everything to lodepng (2048 window, lazy matching, every filter tried per row)
+	enum class PngPreset { Default, Fastest, Balanced, Smallest };
+	//What the caller already knows about the pixels, anything but Detect skips lodepng's scan for the smallest color type
+	enum class PngColor { Detect, RGB, RGBA };
+	
+	static bool ParsePngPreset(const std::string & name, PngPreset & preset){
+		if (name == "default") preset = PngPreset::Default;
+		else if (name == "fastest") preset = PngPreset::Fastest;
+		else if (name == "balanced") preset = PngPreset::Balanced;
+		else if (name == "smallest") preset = PngPreset::Smallest;
+		else {
+			std::cerr << "Unknown PNG preset " << name << ", expected default, fastest, balanced or smallest" << std::endl;
+			return false;
+		}
+		return true;
+	}
+	
+	static void ApplyPngPreset(lodepng::State & state, PngPreset preset){
+		LodePNGCompressSettings & zlib = state.encoder.zlibsettings;
+		switch(preset){
+			case PngPreset::Fastest:  //Up filter on every row and a short greedy search
+				zlib.windowsize = 512;
+				zlib.nicematch = 32;
+				zlib.lazymatching = 0;
+				state.encoder.filter_strategy = LFS_TWO;
+				break;
+			case PngPreset::Balanced:  //Paeth on every row instead of trying all five, half the window
+				zlib.windowsize = 1024;
+				zlib.nicematch = 64;
+				zlib.lazymatching = 1;
+				state.encoder.filter_strategy = LFS_FOUR;
+				break;
+			case PngPreset::Smallest:
+				zlib.windowsize = 32768;
+				zlib.nicematch = 258;
+				zlib.lazymatching = 1;
+				state.encoder.filter_strategy = LFS_ENTROPY;
+				break;
+			case PngPreset::Default:
+				break;
+		}
+	}
+	
+	//threads of 0 picks for itself, above 1 filtering and deflate are split up (the file comes out a little bigger)
+	inline bool save(const std::string & filename, PngPreset preset = PngPreset::Default, PngColor color = PngColor::Detect, unsigned int threads = 0, PngCodecContext * context = nullptr) const { return save(filename.c_str(), preset, color, threads, context); }
+	bool save(const char * filename, PngPreset preset = PngPreset::Default, PngColor color = PngColor::Detect, unsigned int threads = 0, PngCodecContext * context = nullptr) const {
 		if (_width <= 0 || _height <= 0){
 			std::cerr << "Trying to save with dimentions of " << _width << " x " << _height << std::endl;
 			return false;
 		}
-		unsigned int error = lodepng::encode(filename, _image, static_cast<unsigned int>(_width), static_cast<unsigned int>(_height));
+		lodepng::State state;
+		ApplyPngPreset(state, preset);
+		if (color != PngColor::Detect){
+			state.encoder.auto_convert = 0;
+			state.info_png.color.colortype = (color == PngColor::RGB) ? LCT_RGB : LCT_RGBA;
+			state.info_png.color.bitdepth = 8;
+		}
+		threads = WorkerThreads(static_cast<size_t>(_width) * static_cast<size_t>(_height), threads);
+		if (threads > 1){
+			state.encoder.zlibsettings.parallel_run = RunPngJobs;
+			state.encoder.zlibsettings.parallel_context = &threads;
+		}
+		std::vector<unsigned char> ownPng;
+		std::vector<unsigned char> & png = context ? context->_file : ownPng;
+		if (context){
+			state.encoder.zlibsettings.scratch = &context->_scratch;
+			png.clear();
+		}
+		unsigned int error = lodepng::encode(png, _image, static_cast<unsigned int>(_width), static_cast<unsigned int>(_height), state);
+		if (!error) error = lodepng::save_file(png, filename);
 		if (error){
 			std::cerr << "encoder error " << error << ": "<< lodepng_error_text(error) << std::endl;
 			std::cerr << filename << std::endl;
@@ -447,10 +729,34 @@ public:
 		return true;
 	}
 	
-	inline bool load(const std::string & filename) { return load(filename.c_str()); }
-	bool load(const char * filename){
-		unsigned int w, h;
-		unsigned int error = lodepng::decode(_image, w, h, filename);
+	//Checksums can be skipped for trusted local files, a damaged file then decodes to wrong pixels instead of failing.
+	//A file that fails while decoding leaves the image empty, one that can't be read or has a bad header leaves it as it was
+	inline bool load(const std::string & filename, bool verifyChecksums = true, PngCodecContext * context = nullptr) { return load(filename.c_str(), verifyChecksums, context); }
+	bool load(const char * filename, bool verifyChecksums = true, PngCodecContext * context = nullptr){
+		unsigned int w = 0, h = 0;
+		//Decoded from the file's pages where they can be mapped, instead of a copy of them
+		LodePNGMappedFile png;
+		unsigned int error = lodepng_map_file(&png, filename);
+		lodepng::State state;
+		if (!error) error = lodepng_inspect(&w, &h, &state, png.data, png.size);
+		//Deflate can't expand more than 1032 times, a header promising more pixels than that is broken and shouldn't
+		//get the memory for them
+		if (!error && lodepng_get_raw_size(w, h, &state.info_png.color) / 1032 > png.size) error = 91;
+		if (!error){
+			state.decoder.ignore_crc = verifyChecksums ? 0 : 1;
+			state.decoder.zlibsettings.ignore_adler32 = verifyChecksums ? 0 : 1;
+			if (context) state.decoder.zlibsettings.scratch = &context->_scratch;
+			//Decoded straight into the pixels, an RGBA file needs no other full size buffer
+			_image.resize(static_cast<size_t>(w) * static_cast<size_t>(h) * 4);
+			error = lodepng_decode_into(_image.data(), _image.size(), &w, &h, &state, png.data, png.size);
+			if (context) context->_peakBytes = png.size + state.peak_bytes;
+			if (error){
+				//The old pixels are gone by now, stay a consistent empty image
+				_image.clear();
+				_width = _widthTimes4 = _height = 0;
+			}
+		}
+		lodepng_unmap_file(&png);
 		if (error){
 			std::cerr << "decoder error " << error << ": " << lodepng_error_text(error) << std::endl;
 			std::cerr << filename << std::endl;
@@ -462,6 +768,82 @@ public:
 		return true;
 	}
 	
+	//Goes through a PNG a row at a time without ever holding all its pixels, for files too big to load.  func(y, row, width)
+	//gets the rows from the top as RGBA pixels that are only valid during the call, returning false stops there.  The
+	//file itself is mapped like load does, and interlaced files aren't supported
+	template<typename Func>
+	static bool ReadRows(const std::string & filename, Func func, bool verifyChecksums = true){
+		unsigned int w = 0, h = 0;
+		LodePNGMappedFile png;
+		unsigned int error = lodepng_map_file(&png, filename.c_str());
+		lodepng::State state;
+		if (!error) error = lodepng_inspect(&w, &h, &state, png.data, png.size);
+		if (!error){
+			state.decoder.ignore_crc = verifyChecksums ? 0 : 1;
+			state.decoder.zlibsettings.ignore_adler32 = verifyChecksums ? 0 : 1;
+			std::pair<Func *, int> reader(&func, static_cast<int>(w));
+			error = lodepng_decode_rows(&w, &h, &state, png.data, png.size, ForwardPngRow<Func>, &reader);
+			if (error == 118) error = 0;  //func stopped it
+		}
+		lodepng_unmap_file(&png);
+		if (error){
+			std::cerr << "decoder error " << error << ": " << lodepng_error_text(error) << std::endl;
+			std::cerr << filename << std::endl;
+			return false;
+		}
+		return true;
+	}
+	
+	//The other way around, writes a PNG a row at a time without ever holding all its pixels or the whole file.  func(y, row,
+	//width) fills row with the RGBA pixels of row y, from the top, returning false gives up and removes the file.  The
+	//compressed rows go to the file as they're made, in IDAT chunks of chunkBytes (0 for 64KB).  Detect has no pixels
+	//to look at up front, it means RGBA here.  threads as for save, above 1 deflate is split up and holds 4MB of rows
+	template<typename Func>
+	static bool SaveRows(const std::string & filename, int width, int height, Func func, PngPreset preset = PngPreset::Default, PngColor color = PngColor::Detect, unsigned int threads = 0, size_t chunkBytes = 0){
+		if (width <= 0 || height <= 0){
+			std::cerr << "Trying to save with dimentions of " << width << " x " << height << std::endl;
+			return false;
+		}
+		std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary);
+		lodepng::State state;
+		ApplyPngPreset(state, preset);
+		state.encoder.auto_convert = 0;
+		state.info_png.color.colortype = (color == PngColor::RGB) ? LCT_RGB : LCT_RGBA;
+		state.info_png.color.bitdepth = 8;
+		threads = WorkerThreads(static_cast<size_t>(width) * static_cast<size_t>(height), threads);
+		if (threads > 1){
+			state.encoder.zlibsettings.parallel_run = RunPngJobs;
+			state.encoder.zlibsettings.parallel_context = &threads;
+		}
+		LodePNGRowEncoder * encoder = nullptr;
+		unsigned int error = file ? 0 : 79;
+		if (!error) error = lodepng_row_encoder_new(&encoder, static_cast<unsigned int>(width), static_cast<unsigned int>(height), &state, chunkBytes, WritePngBytes, &file);
+		std::vector<uint32_t> row(static_cast<size_t>(width));
+		bool stopped = false;
+		for(int y = 0; y < height && !error; ++y){
+			if (!func(y, row.data(), width)){
+				stopped = true;
+				break;
+			}
+			error = lodepng_row_encoder_push(encoder, reinterpret_cast<const unsigned char*>(row.data()));
+		}
+		if (!error && !stopped) error = lodepng_row_encoder_finish(encoder);
+		lodepng_row_encoder_delete(encoder);
+		if (file.is_open()){
+			file.close();
+			if (!error && !file) error = 120;  //The last of it didn't make it out of the buffer
+		}
+		if (error || stopped){
+			if (error){
+				std::cerr << "encoder error " << error << ": "<< lodepng_error_text(error) << std::endl;
+				std::cerr << filename << std::endl;
+			}
+			if (error != 79) std::remove(filename.c_str());  //Half a PNG is no use to anyone
+			return false;
+		}
+		return true;
+	}
+	
 	Image vflip() const {
 		Image res(_width, _height, true);
 
@@ -565,48 +947,337 @@ public:
 		return resize(w2, h2);
 	}
 	
-	Image resize(int w2, int h2) const {
-		Image temp(w2, h2, true);
-		int x, y;
-		float x_ratio = (static_cast<float>(_width - 1))/static_cast<float>(w2);
-		float y_ratio = (static_cast<float>(_height - 1))/static_cast<float>(h2);
-		float x_diff, y_diff, one_minus_xdiff, one_minus_ydiff, x_diff_time_y_diff, x_diff_times_one_minus_ydiff, y_diff_times_one_minus_xdiff, one_minus_ydiff_time_one_minus_xdiff;
-		float blue, red, green, alpha;
-		for (int i=0;i<h2;i++) {
-			for (int j=0;j<w2;j++) {
-				x = static_cast<int>(x_ratio * static_cast<float>(j)) ;
-				y = static_cast<int>(y_ratio * static_cast<float>(i)) ;
-				x_diff = (x_ratio * static_cast<float>(j)) - static_cast<float>(x);
-				y_diff = (y_ratio * static_cast<float>(i)) - static_cast<float>(y);
-				x_diff_time_y_diff = x_diff * y_diff;
-				one_minus_xdiff = 1.0f - x_diff;
-				one_minus_ydiff = 1.0f - y_diff;
-				one_minus_ydiff_time_one_minus_xdiff = one_minus_xdiff * one_minus_ydiff;
-				x_diff_times_one_minus_ydiff = x_diff * one_minus_ydiff;
-				y_diff_times_one_minus_xdiff = y_diff * one_minus_xdiff;
-				uint32_t a = point_unsafe(x, y);
-				uint32_t b = point_unsafe(x + 1, y);
-				uint32_t c = point_unsafe(x, y + 1);
-				uint32_t d = point_unsafe(x + 1, y + 1);
-
-				// Yr = Ab(1-w)(1-h) + Bb(w)(1-h) + Cb(h)(1-w) + Db(wh)
-				red = static_cast<float>(a&0xff)       *one_minus_ydiff_time_one_minus_xdiff + static_cast<float>(b&0xff)      * x_diff_times_one_minus_ydiff + static_cast<float>(c&0xff)      * y_diff_times_one_minus_xdiff + static_cast<float>(d&0xff)       * x_diff_time_y_diff;
-
-				// Yg = Ag(1-w)(1-h) + Bg(w)(1-h) + Cg(h)(1-w) + Dg(wh)
-				green = static_cast<float>((a>>8)&0xff)*one_minus_ydiff_time_one_minus_xdiff + static_cast<float>((b>>8)&0xff) * x_diff_times_one_minus_ydiff + static_cast<float>((c>>8)&0xff) * y_diff_times_one_minus_xdiff + static_cast<float>((d>>8)&0xff)  * x_diff_time_y_diff;
-
-				// Yb = Ar(1-w)(1-h) + Br(w)(1-h) + Cr(h)(1-w) + Dr(wh)
-				blue = static_cast<float>((a>>16)&0xff)*one_minus_ydiff_time_one_minus_xdiff + static_cast<float>((b>>16)&0xff)* x_diff_times_one_minus_ydiff + static_cast<float>((c>>16)&0xff)* y_diff_times_one_minus_xdiff + static_cast<float>((d>>16)&0xff) * x_diff_time_y_diff;
-
-				// Yb = Ar(1-w)(1-h) + Br(w)(1-h) + Cr(h)(1-w) + Dr(wh)
-				alpha = static_cast<float>((a >> 24) & 0xff) * one_minus_ydiff_time_one_minus_xdiff + static_cast<float>((b >> 24) & 0xff) * x_diff_times_one_minus_ydiff + static_cast<float>((c >> 24) & 0xff) * y_diff_times_one_minus_xdiff + static_cast<float>((d >> 24) & 0xff) * x_diff_time_y_diff;
-
-				temp.pset_unsafe(j, i, Color(static_cast<uint32_t>(red), static_cast<uint32_t>(green), static_cast<uint32_t>(blue), static_cast<uint32_t>(alpha)));
+	enum class ResizeFilter { Bilinear, Area, Lanczos3 };
+	
+	//Which source pixels make up each destination pixel.  Weights are RESIZE_SHIFT bit fixed point and add up to one
+	struct ResizeTaps {
+		std::vector<int> first;
+		std::vector<int> count;
+		std::vector<int> offset;
+		std::vector<int16_t> weights;
+	};
+	static const int RESIZE_SHIFT = 14;
+	
+	static ResizeTaps MakeResizeTaps(int sourceSize, int destSize, ResizeFilter filter){
+		ResizeTaps taps;
+		std::vector<int> areaStarts, areaSources;
+		std::vector<float> areaWeights;
+		if (filter == ResizeFilter::Area) AreaWeights(sourceSize, destSize, areaStarts, areaSources, areaWeights);
+		const float ratio = static_cast<float>(sourceSize - 1) / static_cast<float>(destSize);
+		const double scale = static_cast<double>(sourceSize) / static_cast<double>(destSize);
+		const double stretch = std::max(scale, 1.0);
+		std::vector<double> w;
+		for(int i = 0; i < destSize; ++i){
+			int first = 0;
+			w.clear();
+			switch(filter){
+				case ResizeFilter::Bilinear: {
+					first = static_cast<int>(ratio * static_cast<float>(i));
+					const float diff = (ratio * static_cast<float>(i)) - static_cast<float>(first);
+					w.push_back(1.0 - diff);
+					if (first + 1 < sourceSize) w.push_back(diff);
+					break;
+				}
+				case ResizeFilter::Area: {
+					first = areaSources[static_cast<size_t>(areaStarts[static_cast<size_t>(i)])];
+					for(int j = areaStarts[static_cast<size_t>(i)]; j < areaStarts[static_cast<size_t>(i) + 1]; ++j) w.push_back(areaWeights[static_cast<size_t>(j)]);
+					break;
+				}
+				case ResizeFilter::Lanczos3: {
+					const double center = (static_cast<double>(i) + 0.5) * scale;
+					const double support = 3.0 * stretch;
+					first = std::max(0, static_cast<int>(floor(center - support)));
+					const int last = std::min(sourceSize - 1, static_cast<int>(ceil(center + support)));
+					for(int j = first; j <= last; ++j) w.push_back(Lanczos3((static_cast<double>(j) + 0.5 - center) / stretch));
+					break;
+				}
+			}
+			
+			AddTaps(taps, first, w);
+		}
+		return taps;
+	}
+	
+	//Normalizes and quantizes one position's weights, whatever rounding is left over goes to the biggest so the total is exact
+	static void AddTaps(ResizeTaps & taps, int first, std::vector<double> & w){
+		double total = 0.0;
+		for(double v : w) total += v;
+		if (total == 0.0){ w.assign(1, 1.0); total = 1.0; }
+		taps.first.push_back(first);
+		taps.count.push_back(static_cast<int>(w.size()));
+		taps.offset.push_back(static_cast<int>(taps.weights.size()));
+		int sum = 0;
+		size_t biggest = taps.weights.size();
+		for(double v : w){
+			const int16_t q = static_cast<int16_t>(std::lround(v / total * static_cast<double>(1 << RESIZE_SHIFT)));
+			if (biggest == taps.weights.size() || q > taps.weights[biggest]) biggest = taps.weights.size();
+			taps.weights.push_back(q);
+			sum += q;
+		}
+		taps.weights[biggest] = static_cast<int16_t>(taps.weights[biggest] + ((1 << RESIZE_SHIFT) - sum));
+	}
+	
+	//A gaussian cut off at 3 sigma, renormalized where it runs off the edge
+	static ResizeTaps GaussianTaps(int size, float sigma){
+		const int reach = std::max(1, static_cast<int>(ceil(3.0f * sigma)));
+		std::vector<double> kernel(static_cast<size_t>(reach) + 1);
+		for(int i = 0; i <= reach; ++i) kernel[static_cast<size_t>(i)] = exp(-static_cast<double>(i * i) / (2.0 * static_cast<double>(sigma) * static_cast<double>(sigma)));
+		ResizeTaps taps;
+		std::vector<double> w;
+		for(int i = 0; i < size; ++i){
+			const int first = std::max(0, i - reach);
+			const int last = std::min(size - 1, i + reach);
+			w.clear();
+			for(int j = first; j <= last; ++j) w.push_back(kernel[static_cast<size_t>(abs(j - i))]);
+			AddTaps(taps, first, w);
+		}
+		return taps;
+	}
+	
+	inline static double Lanczos3(double x){
+		if (x == 0.0) return 1.0;
+		if (x <= -3.0 || x >= 3.0) return 0.0;
+		const double px = 3.14159265358979323846 * x;
+		return 3.0 * sin(px) * sin(px / 3.0) / (px * px);
+	}
+	
+	//threads of 0 picks for itself, big images use every core
+	static unsigned int WorkerThreads(size_t pixels, unsigned int threads){
+		if (threads != 0) return threads;
+		if (pixels < (1 << 18)) return 1;
+		return std::max(1u, std::thread::hardware_concurrency());
+	}
+	
+	//Splits rows into one band per thread and runs func(begin, end) on each
+	template <typename Func>
+	static void ParallelRows(int rows, unsigned int threads, Func func){
+		if (threads <= 1 || rows < 2){
+			func(0, rows);
+			return;
+		}
+		threads = std::min(threads, static_cast<unsigned int>(rows));
+		std::vector<std::thread> workers;
+		for(unsigned int t = 0; t < threads; ++t){
+			const int begin = static_cast<int>(static_cast<int64_t>(rows) * t / threads);
+			const int end = static_cast<int>(static_cast<int64_t>(rows) * (t + 1) / threads);
+			workers.emplace_back(func, begin, end);
+		}
+		for(auto & worker : workers) worker.join();
+	}
+	
+	//lodepng's parallel_run, context points at the thread count
+	static void RunPngJobs(void (*job)(void * data, size_t index), void * data, size_t count, const void * context){
+		const unsigned int threads = *static_cast<const unsigned int*>(context);
+		ParallelRows(static_cast<int>(count), threads, [&](int begin, int end){
+			for(int i = begin; i < end; ++i) job(data, static_cast<size_t>(i));
+		});
+	}
+	
+	//lodepng_decode_rows' callback for ReadRows, user is the function and the width
+	template<typename Func>
+	static unsigned ForwardPngRow(void * user, unsigned y, const unsigned char * pixels){
+		std::pair<Func *, int> & reader = *static_cast<std::pair<Func *, int>*>(user);
+		return (*reader.first)(static_cast<int>(y), reinterpret_cast<const uint32_t*>(pixels), reader.second) ? 0 : 1;
+	}
+	
+	//The row encoder's write function for SaveRows, user is the file
+	static unsigned WritePngBytes(void * user, const unsigned char * data, size_t size){
+		std::ofstream & file = *static_cast<std::ofstream*>(user);
+		file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+		return file ? 0 : 1;
+	}
+	
+	//One destination row from one source row
+	static void ResizeRowHorizontal(const uint32_t * source, uint32_t * dest, const ResizeTaps & taps){
+		const int destWidth = static_cast<int>(taps.first.size());
+		for(int x = 0; x < destWidth; ++x){
+			const uint32_t * in = source + taps.first[static_cast<size_t>(x)];
+			const int16_t * weights = &taps.weights[static_cast<size_t>(taps.offset[static_cast<size_t>(x)])];
+			const int count = taps.count[static_cast<size_t>(x)];
+			int k = 0;
+#ifdef IMAGE_SSE2
+			const __m128i zero = _mm_setzero_si128();
+			__m128i acc = _mm_set1_epi32(1 << (RESIZE_SHIFT - 1));
+			for(; k + 2 <= count; k += 2){
+				//Two pixels, channels interleaved as r0 r1 g0 g1 b0 b1 a0 a1, against w0 w1 pairs
+				const __m128i p = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + k)), zero);
+				const __m128i pairs = _mm_unpacklo_epi16(p, _mm_srli_si128(p, 8));
+				const __m128i w = _mm_set1_epi32(static_cast<int>((static_cast<uint32_t>(static_cast<uint16_t>(weights[k + 1])) << 16) | static_cast<uint16_t>(weights[k])));
+				acc = _mm_add_epi32(acc, _mm_madd_epi16(pairs, w));
+			}
+			if (k < count){
+				const __m128i p = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(in[k])), zero), zero);
+				acc = _mm_add_epi32(acc, _mm_madd_epi16(p, _mm_set1_epi32(static_cast<uint16_t>(weights[k]))));
 			}
+			acc = _mm_srai_epi32(acc, RESIZE_SHIFT);
+			acc = _mm_packs_epi32(acc, acc);
+			dest[x] = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(acc, acc)));
+#else
+			int32_t r = 1 << (RESIZE_SHIFT - 1), g = r, b = r, a = r;
+			for(; k < count; ++k){
+				const uint32_t c = in[k];
+				r += Red(c) * weights[k];
+				g += Green(c) * weights[k];
+				b += Blue(c) * weights[k];
+				a += Alpha(c) * weights[k];
+			}
+			dest[x] = Color(ClampChannel(r >> RESIZE_SHIFT), ClampChannel(g >> RESIZE_SHIFT), ClampChannel(b >> RESIZE_SHIFT), ClampChannel(a >> RESIZE_SHIFT));
+#endif
 		}
-		return temp;
+	}
+	
+	//One destination row from several rows of the horizontal pass
+	static void ResizeRowVertical(const uint8_t * const * rows, const int16_t * weights, int count, uint8_t * dest, int bytes){
+		int i = 0;
+#ifdef IMAGE_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		for(; i + 16 <= bytes; i += 16){
+			__m128i acc0 = _mm_set1_epi32(1 << (RESIZE_SHIFT - 1));
+			__m128i acc1 = acc0, acc2 = acc0, acc3 = acc0;
+			for(int k = 0; k < count; k += 2){
+				const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[k] + i));
+				const __m128i b = (k + 1 < count) ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[k + 1] + i)) : zero;
+				const int16_t w1 = (k + 1 < count) ? weights[k + 1] : 0;
+				const __m128i w = _mm_set1_epi32(static_cast<int>((static_cast<uint32_t>(static_cast<uint16_t>(w1)) << 16) | static_cast<uint16_t>(weights[k])));
+				const __m128i aLo = _mm_unpacklo_epi8(a, zero);
+				const __m128i bLo = _mm_unpacklo_epi8(b, zero);
+				const __m128i aHi = _mm_unpackhi_epi8(a, zero);
+				const __m128i bHi = _mm_unpackhi_epi8(b, zero);
+				acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(aLo, bLo), w));
+				acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(aLo, bLo), w));
+				acc2 = _mm_add_epi32(acc2, _mm_madd_epi16(_mm_unpacklo_epi16(aHi, bHi), w));
+				acc3 = _mm_add_epi32(acc3, _mm_madd_epi16(_mm_unpackhi_epi16(aHi, bHi), w));
+			}
+			const __m128i lo = _mm_packs_epi32(_mm_srai_epi32(acc0, RESIZE_SHIFT), _mm_srai_epi32(acc1, RESIZE_SHIFT));
+			const __m128i hi = _mm_packs_epi32(_mm_srai_epi32(acc2, RESIZE_SHIFT), _mm_srai_epi32(acc3, RESIZE_SHIFT));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_packus_epi16(lo, hi));
+		}
+#endif
+		for(; i < bytes; ++i){
+			int32_t sum = 1 << (RESIZE_SHIFT - 1);
+			for(int k = 0; k < count; ++k) sum += rows[k][i] * weights[k];
+			dest[i] = ClampChannel(sum >> RESIZE_SHIFT);
+		}
+	}
+	
+	inline static uint8_t ClampChannel(int32_t v){ return static_cast<uint8_t>(v < 0 ? 0 : (v > 255 ? 255 : v)); }
+	
+	//Separable, horizontal pass then vertical, with the weights for every column and row worked out once up front
+	Image resize(int w2, int h2, ResizeFilter filter = ResizeFilter::Bilinear, unsigned int threads = 0) const {
+		if (w2 <= 0 || h2 <= 0 || _width <= 0 || _height <= 0) return Image(std::max(w2, 0), std::max(h2, 0), true);
+		return resample(MakeResizeTaps(_width, w2, filter), MakeResizeTaps(_height, h2, filter), threads);
+	}
+	
+	//Runs a horizontal pass then a vertical one, the size of the result comes from how many positions the taps have
+	Image resample(const ResizeTaps & xTaps, const ResizeTaps & yTaps, unsigned int threads = 0) const {
+		const int w2 = static_cast<int>(xTaps.first.size());
+		const int h2 = static_cast<int>(yTaps.first.size());
+		threads = WorkerThreads(static_cast<size_t>(w2) * static_cast<size_t>(h2), threads);
+		
+		//Only the source rows the vertical pass reads need a horizontal pass
+		std::vector<int> needed;
+		std::vector<bool> used(static_cast<size_t>(_height), false);
+		for(int y = 0; y < h2; ++y){
+			for(int k = 0; k < yTaps.count[static_cast<size_t>(y)]; ++k) used[static_cast<size_t>(yTaps.first[static_cast<size_t>(y)] + k)] = true;
+		}
+		for(int y = 0; y < _height; ++y) if (used[static_cast<size_t>(y)]) needed.push_back(y);
+		
+		const size_t rowBytes = static_cast<size_t>(w2) * 4;
+		std::vector<uint8_t> temp(rowBytes * static_cast<size_t>(_height));
+		ParallelRows(static_cast<int>(needed.size()), threads, [&](int begin, int end){
+			for(int i = begin; i < end; ++i){
+				const int y = needed[static_cast<size_t>(i)];
+				ResizeRowHorizontal(reinterpret_cast<const uint32_t*>(&_image[pixelIndex(0, y)]), reinterpret_cast<uint32_t*>(&temp[rowBytes * static_cast<size_t>(y)]), xTaps);
+			}
+		});
+		
+		Image res(w2, h2, true);
+		ParallelRows(h2, threads, [&](int begin, int end){
+			std::vector<const uint8_t*> rows;
+			for(int y = begin; y < end; ++y){
+				const int count = yTaps.count[static_cast<size_t>(y)];
+				rows.resize(static_cast<size_t>(count));
+				for(int k = 0; k < count; ++k) rows[static_cast<size_t>(k)] = &temp[rowBytes * static_cast<size_t>(yTaps.first[static_cast<size_t>(y)] + k)];
+				ResizeRowVertical(rows.data(), &yTaps.weights[static_cast<size_t>(yTaps.offset[static_cast<size_t>(y)])], count, &res._image[res.pixelIndex(0, y)], static_cast<int>(rowBytes));
+			}
+		});
+		return res;
 	}
   
+	//For each destination pixel, the source pixels under it and how much of each.  Destination i uses entries starts[i]
+	//up to starts[i + 1]
+	static void AreaWeights(int sourceSize, int destSize, std::vector<int> & starts, std::vector<int> & sources, std::vector<float> & weights){
+		const double scale = static_cast<double>(sourceSize) / static_cast<double>(destSize);
+		starts.assign(1, 0);
+		sources.clear();
+		weights.clear();
+		for(int i = 0; i < destSize; ++i){
+			const double left = static_cast<double>(i) * scale;
+			const double right = std::min(static_cast<double>(i + 1) * scale, static_cast<double>(sourceSize));
+			for(int j = static_cast<int>(left); j < sourceSize && static_cast<double>(j) < right; ++j){
+				const double covered = std::min(right, static_cast<double>(j + 1)) - std::max(left, static_cast<double>(j));
+				if (covered <= 0.0) continue;
+				sources.push_back(j);
+				weights.push_back(static_cast<float>(covered / scale));
+			}
+			starts.push_back(static_cast<int>(sources.size()));
+		}
+	}
+	
+	//Area averaging for shrinking, each source pixel counts by how much of it falls under the destination pixel.  Colors
+	//are weighted by alpha so clear pixels don't darken the edges next to them
+	Image resizeArea(int w2, int h2) const {
+		if (w2 <= 0 || h2 <= 0 || _width <= 0 || _height <= 0) return Image(0, 0);
+		if (w2 > _width || h2 > _height) return resize(w2, h2);
+		
+		std::vector<int> xStarts, xSources, yStarts, ySources;
+		std::vector<float> xWeights, yWeights;
+		AreaWeights(_width, w2, xStarts, xSources, xWeights);
+		AreaWeights(_height, h2, yStarts, ySources, yWeights);
+		
+		//Horizontal pass into premultiplied floats
+		std::vector<float> temp(static_cast<size_t>(w2) * static_cast<size_t>(_height) * 4);
+		for(int y = 0; y < _height; ++y){
+			const uint32_t * row = reinterpret_cast<const uint32_t*>(&_image[pixelIndex(0, y)]);
+			float * out = &temp[static_cast<size_t>(y) * static_cast<size_t>(w2) * 4];
+			for(int x = 0; x < w2; ++x, out += 4){
+				const int first = xStarts[static_cast<size_t>(x)];
+				const int last = xStarts[static_cast<size_t>(x) + 1];
+				for(int i = first; i < last; ++i){
+					const uint32_t c = row[xSources[static_cast<size_t>(i)]];
+					const float a = static_cast<float>(Alpha(c)) * xWeights[static_cast<size_t>(i)];
+					out[0] += static_cast<float>(Red(c)) * a;
+					out[1] += static_cast<float>(Green(c)) * a;
+					out[2] += static_cast<float>(Blue(c)) * a;
+					out[3] += a;
+				}
+			}
+		}
+		
+		Image res(w2, h2, true);
+		std::vector<float> sum(static_cast<size_t>(w2) * 4);
+		for(int y = 0; y < h2; ++y){
+			std::fill(sum.begin(), sum.end(), 0.0f);
+			const int first = yStarts[static_cast<size_t>(y)];
+			const int last = yStarts[static_cast<size_t>(y) + 1];
+			for(int i = first; i < last; ++i){
+				const float weight = yWeights[static_cast<size_t>(i)];
+				const float * in = &temp[static_cast<size_t>(ySources[static_cast<size_t>(i)]) * static_cast<size_t>(w2) * 4];
+				for(size_t j = 0; j < sum.size(); ++j) sum[j] += in[j] * weight;
+			}
+			uint32_t * dest = reinterpret_cast<uint32_t*>(&res._image[res.pixelIndex(0, y)]);
+			for(int x = 0; x < w2; ++x){
+				const float * p = &sum[static_cast<size_t>(x) * 4];
+				if (p[3] <= 0.0f){
+					dest[x] = 0;
+					continue;
+				}
+				dest[x] = Color(static_cast<uint32_t>(p[0] / p[3] + 0.5f), static_cast<uint32_t>(p[1] / p[3] + 0.5f), static_cast<uint32_t>(p[2] / p[3] + 0.5f), std::min(static_cast<uint32_t>(p[3] + 0.5f), 255u));
+			}
+		}
+		return res;
+	}
+	
 	void replaceColor(uint32_t find, uint32_t replace){
 		uint32_t * data32 = reinterpret_cast<uint32_t*>(data());
 		uint32_t * end = data32 + (pixels() / 4);
@@ -615,71 +1286,141 @@ public:
 		}
 	}
 	
-	Image noiseRemove_Median_PerChannel(int radius = 1){
-		assert(radius > 0);
-		const size_t p1 = static_cast<size_t>(radius) * 2 + 1;
-		uint8_t * window = static_cast<uint8_t*>(malloc(p1 * p1 * sizeof(uint8_t)));
+	//Histogram counts are 16 bit, so the window can't hold more than 65535 pixels
+	static const int MEDIAN_MAX_RADIUS = 127;
+	
+	//Median of each channel over a (radius * 2 + 1) square, edges are extended outward so every window is full
+	Image noiseRemove_Median_PerChannel(int radius = 1, unsigned int threads = 0){
+		if (!checkMedianRadius(radius)) return *this;
+		const size_t count = static_cast<size_t>(_width) * static_cast<size_t>(_height);
+		threads = WorkerThreads(count, threads);
+		std::vector<uint8_t> planes[3], medians[3];
+		for(int channel = 0; channel < 3; ++channel){
+			planes[channel].resize(count);
+			medians[channel].resize(count);
+			for(size_t i = 0; i < count; ++i) planes[channel][i] = _image[i * 4 + static_cast<size_t>(channel)];
+			ParallelRows(_height, threads, [&](int begin, int end){
+				MedianPlaneRows(planes[channel].data(), _width, _height, radius, medians[channel].data(), begin, end);
+			});
+		}
 		Image secondImage(width(), height(), true);
-		for(int row = radius; row < width() - radius; ++row){
-			for(int col = radius; col < height() - radius; ++col){
-				size_t index = 0;
-				for(int offsetX = -radius; offsetX <= radius; ++offsetX){
-					for(int offsetY = -radius; offsetY <= radius; ++offsetY){
-						window[index++] = Red(point_unsafe(row + offsetX, col + offsetY));
-					}
-				}
-				assert(index > 0);
-				std::qsort(window, index, sizeof(uint8_t), qsort_compare_channel); 
-				uint8_t red = window[index / 2];
-				
-				index = 0;
-				for(int offsetX = -1; offsetX <= 1; ++offsetX){
-					for(int offsetY = -1; offsetY <= 1; ++offsetY){
-						window[index++] = Green(point_unsafe(row + offsetX, col + offsetY));
+		uint32_t * dest = reinterpret_cast<uint32_t*>(secondImage._image.data());
+		for(size_t i = 0; i < count; ++i) dest[i] = Color(medians[0][i], medians[1][i], medians[2][i]);
+		return secondImage;
+	}
+	
+	//Picks the pixel with the median grey in each window, so colors come through unmixed
+	Image noiseRemove_Median_Greyscale(int radius = 1, unsigned int threads = 0){
+		if (!checkMedianRadius(radius)) return *this;
+		const size_t count = static_cast<size_t>(_width) * static_cast<size_t>(_height);
+		threads = WorkerThreads(count, threads);
+		std::vector<uint8_t> greys(count), medians(count);
+		const uint32_t * source = reinterpret_cast<const uint32_t*>(_image.data());
+		for(size_t i = 0; i < count; ++i) greys[i] = GreyScale(source[i]);
+		Image secondImage(width(), height(), true);
+		uint32_t * dest = reinterpret_cast<uint32_t*>(secondImage._image.data());
+		ParallelRows(_height, threads, [&](int begin, int end){
+			MedianPlaneRows(greys.data(), _width, _height, radius, medians.data(), begin, end);
+			
+			//Usually the middle pixel already has the median grey, otherwise look through the window for one that does
+			for(int y = begin; y < end; ++y){
+				for(int x = 0; x < _width; ++x){
+					const size_t i = static_cast<size_t>(y) * static_cast<size_t>(_width) + static_cast<size_t>(x);
+					if (greys[i] == medians[i]){
+						dest[i] = source[i];
+						continue;
 					}
-				}
-				assert(index > 0);
-				std::qsort(window, index, sizeof(uint8_t), qsort_compare_channel); 
-				uint8_t green = window[index / 2];
-				
-				index = 0;
-				for(int offsetX = -1; offsetX <= 1; ++offsetX){
-					for(int offsetY = -1; offsetY <= 1; ++offsetY){
-						window[index++] = Blue(point_unsafe(row + offsetX, col + offsetY));
+					bool found = false;
+					for(int offsetY = -radius; offsetY <= radius && !found; ++offsetY){
+						const size_t row = static_cast<size_t>(ClampIndex(y + offsetY, _height)) * static_cast<size_t>(_width);
+						for(int offsetX = -radius; offsetX <= radius; ++offsetX){
+							const size_t j = row + static_cast<size_t>(ClampIndex(x + offsetX, _width));
+							if (greys[j] == medians[i]){
+								dest[i] = source[j];
+								found = true;
+								break;
+							}
+						}
 					}
 				}
-				assert(index > 0);
-				std::qsort(window, index, sizeof(uint8_t), qsort_compare_channel); 
-				uint8_t blue = window[index / 2];
-				
-				secondImage.pset_unsafe(row, col, Color(red, green, blue));
 			}
-		}
-		free(window);
+		});
 		return secondImage;
 	}
 	
-	Image noiseRemove_Median_Greyscale(int radius = 1){
-		assert(radius > 0);
-		const size_t p1 = static_cast<size_t>(radius) * 2 + 1;
-		uint32_t * window = static_cast<uint32_t*>(malloc(p1 * p1 * sizeof(uint32_t)));
-		Image secondImage(width(), height(), true);
-		for(int row = radius; row < width() - radius; ++row){
-			for(int col = radius; col < height() - radius; ++col){
-				size_t index = 0;
-				for(int offsetX = -radius; offsetX <= radius; ++offsetX){
-					for(int offsetY = -radius; offsetY <= radius; ++offsetY){
-						window[index++] = point_unsafe(row + offsetX, col + offsetY);
+	inline static int ClampIndex(int i, int size){ return i < 0 ? 0 : (i >= size ? size - 1 : i); }
+	
+	bool checkMedianRadius(int & radius) const {
+		if (radius <= 0){
+			std::cerr << "Median radius has to be at least 1, got " << radius << std::endl;
+			return false;
+		}
+		if (radius > MEDIAN_MAX_RADIUS){
+			std::cerr << "Median radius " << radius << " is too big, using " << MEDIAN_MAX_RADIUS << std::endl;
+			radius = MEDIAN_MAX_RADIUS;
+		}
+		return _width > 0 && _height > 0;
+	}
+	
+	//Perreault and Hebert's constant time median. Every column keeps a histogram of its part of the window that slides down a row
+	//at a time, and the window's histogram slides along the row by adding one column and taking one away.  Each histogram has 16
+	//coarse bins over 256 fine ones, the coarse bins find where the median is and only those 16 fine bins get brought up to date
+	static void MedianPlaneRows(const uint8_t * plane, int width, int height, int radius, uint8_t * out, int rowBegin, int rowEnd){
+		const int diameter = radius * 2 + 1;
+		const int half = (diameter * diameter) / 2;
+		std::vector<uint16_t> columnFine(static_cast<size_t>(width) * 256, 0);
+		std::vector<uint16_t> columnCoarse(static_cast<size_t>(width) * 16, 0);
+		auto addRow = [&](int y, uint16_t delta){
+			const uint8_t * row = plane + static_cast<size_t>(ClampIndex(y, height)) * static_cast<size_t>(width);
+			for(size_t x = 0; x < static_cast<size_t>(width); ++x){
+				columnFine[x * 256 + row[x]] = static_cast<uint16_t>(columnFine[x * 256 + row[x]] + delta);
+				columnCoarse[x * 16 + (row[x] >> 4)] = static_cast<uint16_t>(columnCoarse[x * 16 + (row[x] >> 4)] + delta);
+			}
+		};
+		//Counts are unsigned, taking one away wraps around and comes back when the matching one is added
+		auto addBins = [](uint16_t * to, const uint16_t * from, int bins){ for(int i = 0; i < bins; ++i) to[i] = static_cast<uint16_t>(to[i] + from[i]); };
+		auto subBins = [](uint16_t * to, const uint16_t * from, int bins){ for(int i = 0; i < bins; ++i) to[i] = static_cast<uint16_t>(to[i] - from[i]); };
+		auto columnOf = [&](const std::vector<uint16_t> & bins, int x, int size) { return &bins[static_cast<size_t>(ClampIndex(x, width)) * static_cast<size_t>(size)]; };
+		
+		for(int offsetY = -radius; offsetY <= radius; ++offsetY) addRow(rowBegin + offsetY, 1);
+		uint16_t coarse[16];
+		uint16_t fine[256];
+		int synced[16];
+		for(int y = rowBegin; y < rowEnd; ++y){
+			if (y > rowBegin){
+				addRow(y - radius - 1, static_cast<uint16_t>(-1));
+				addRow(y + radius, 1);
+			}
+			std::fill(coarse, coarse + 16, 0);
+			for(int offsetX = -radius; offsetX <= radius; ++offsetX) addBins(coarse, columnOf(columnCoarse, offsetX, 16), 16);
+			std::fill(synced, synced + 16, -diameter - 1);
+			uint8_t * dest = out + static_cast<size_t>(y) * static_cast<size_t>(width);
+			for(int x = 0; x < width; ++x){
+				if (x > 0){
+					subBins(coarse, columnOf(columnCoarse, x - radius - 1, 16), 16);
+					addBins(coarse, columnOf(columnCoarse, x + radius, 16), 16);
+				}
+				int sum = 0;
+				int bin = 0;
+				while (sum + coarse[bin] <= half) sum += coarse[bin++];
+				
+				uint16_t * segment = fine + bin * 16;
+				if (x - synced[bin] > radius){
+					std::fill(segment, segment + 16, 0);
+					for(int offsetX = -radius; offsetX <= radius; ++offsetX) addBins(segment, columnOf(columnFine, x + offsetX, 256) + bin * 16, 16);
+				}else{
+					for(int step = synced[bin] + 1; step <= x; ++step){
+						subBins(segment, columnOf(columnFine, step - radius - 1, 256) + bin * 16, 16);
+						addBins(segment, columnOf(columnFine, step + radius, 256) + bin * 16, 16);
 					}
 				}
-				assert(index > 0);
-				std::qsort(window, index, sizeof(uint32_t), qsort_compare_greyscale); 
-				uint32_t color = window[index / 2];				
-				secondImage.pset_unsafe(row, col, color);
+				synced[bin] = x;
+				
+				int value = 0;
+				while (sum + segment[value] <= half) sum += segment[value++];
+				dest[x] = static_cast<uint8_t>(bin * 16 + value);
 			}
 		}
-		free(window);
-		return secondImage;
 	}
 	
 	Image toGreyscale(){
@@ -723,7 +1464,7 @@ public:
 		Image secondImage(width(), height(), true);
 		for(int row = 0; row < width(); ++row){
 			for(int col = 0; col < height(); ++col){
-				uint8_t gray = Red(point_unsafe(row, col));
+				uint8_t gray = Green(point_unsafe(row, col));
 				secondImage.pset_unsafe(row, col, Color(gray, gray, gray));
 			}
 		}
@@ -734,7 +1475,7 @@ public:
 		Image secondImage(width(), height(), true);
 		for(int row = 0; row < width(); ++row){
 			for(int col = 0; col < height(); ++col){
-				uint8_t gray = Red(point_unsafe(row, col));
+				uint8_t gray = Blue(point_unsafe(row, col));
 				secondImage.pset_unsafe(row, col, Color(gray, gray, gray));
 			}
 		}
@@ -744,145 +1485,153 @@ public:
 
 
 
-	Image edgeDetect_CannyFilter_Channels(double lowerThreshold, double higherThreshold) {
-		Image edgeRed = redChannelToGreyscale().edgeDetect_CannyFilter_Greyscale(lowerThreshold, higherThreshold);
-		Image edgeGreen = greenChannelToGreyscale().edgeDetect_CannyFilter_Greyscale(lowerThreshold, higherThreshold);
-		Image edgeBlue = blueChannelToGreyscale().edgeDetect_CannyFilter_Greyscale(lowerThreshold, higherThreshold);
-		Image secondImage(width(), height(), true);
-		for(int row = 0; row < width(); ++row){
-			for(int col = 0; col < height(); ++col){
-				uint8_t red = Red(edgeRed.point_unsafe(row, col));
-				uint8_t green = Red(edgeGreen.point_unsafe(row, col));
-				uint8_t blue = Red(edgeBlue.point_unsafe(row, col));
-				secondImage.pset_unsafe(row, col, Color(red, green, blue));
+	//Each channel on its own thread
+	Image edgeDetect_CannyFilter_Channels(double lowerThreshold, double higherThreshold, unsigned int threads = 0) {
+		const size_t count = static_cast<size_t>(_width) * static_cast<size_t>(_height);
+		std::vector<uint8_t> edges[3];
+		ParallelRows(3, WorkerThreads(count, threads), [&](int begin, int end){
+			for(int channel = begin; channel < end; ++channel){
+				std::vector<uint8_t> plane(count);
+				for(size_t i = 0; i < count; ++i) plane[i] = _image[i * 4 + static_cast<size_t>(channel)];
+				edges[channel] = CannyPlane(plane.data(), _width, _height, lowerThreshold, higherThreshold);
 			}
-		}
+		});
+		Image secondImage(width(), height(), true);
+		uint32_t * dest = reinterpret_cast<uint32_t*>(secondImage._image.data());
+		for(size_t i = 0; i < count; ++i) dest[i] = Color(edges[0][i], edges[1][i], edges[2][i]);
 		return secondImage;
 	}
 
 
 	Image edgeDetect_CannyFilter_Greyscale(double lowerThreshold, double higherThreshold) {
+		const size_t count = static_cast<size_t>(_width) * static_cast<size_t>(_height);
+		const uint32_t * source = reinterpret_cast<const uint32_t*>(_image.data());
+		std::vector<uint8_t> greys(count);
+		for(size_t i = 0; i < count; ++i) greys[i] = GreyScale(source[i]);
+		const std::vector<uint8_t> edges = CannyPlane(greys.data(), _width, _height, lowerThreshold, higherThreshold);
 		Image pixelsCanny(width(), height(), true);
-		int gx[3][3] = {{-1, 0, 1}, {-2, 0, 2}, {-1, 0, 1}};
-		int gy[3][3] = {{-1, -2, -1}, {0, 0, 0}, {1, 2, 1}};
-		double * G = static_cast<double*>(malloc(static_cast<size_t>(pixels() * sizeof(double))));
-		std::vector<int> theta(pixels());
-		double largestG = 0;
-		// perform canny edge detection on everything but the edges
-		for (int i = 1; i < height() - 1; i++) {
-			for (int j = 1; j < width() - 1; j++) {
-				// find gx and gy for each pixel
-				double gxValue = 0;
-				double gyValue = 0;
-				for (int x = -1; x <= 1; x++) {
-					for (int y = -1; y <= 1; y++) {
-						gxValue = gxValue + (gx[1 - x][1 - y] * static_cast<double>(GreyScale(point_unsafe(j + x, i + y))));
-						gyValue = gyValue + (gy[1 - x][1 - y] * static_cast<double>(GreyScale(point_unsafe(j + x, i + y))));
-					}
-				}
-
-				// calculate G and theta
-				G[i * width() + j] = std::sqrt(std::pow(gxValue, 2) + std::pow(gyValue, 2));
-				double atanResult = atan2(gyValue, gxValue) * 180.0 / 3.14159265;
-				theta[static_cast<size_t>(i * width() + j)] = static_cast<int>(180.0 + atanResult);
-
-				if (G[static_cast<size_t>(i * width() + j)] > largestG) { largestG = G[i * width() + j]; }
-
-				// setting the edges
-				if (i == 1) {
-					G[static_cast<size_t>(i * width() + j - 1)] = G[static_cast<size_t>(i * width() + j)];
-					theta[static_cast<size_t>(i * width() + j - 1)] = theta[static_cast<size_t>(i * width() + j)];
-				} else if (j == 1) {
-					G[static_cast<size_t>((i - 1) * width() + j)] = G[static_cast<size_t>(i * width() + j)];
-					theta[static_cast<size_t>((i - 1) * width() + j)] = theta[static_cast<size_t>(i * width() + j)];
-				} else if (i == height() - 1) {
-					G[static_cast<size_t>(i * width() + j + 1)] = G[static_cast<size_t>(i * width() + j)];
-					theta[static_cast<size_t>(i * width() + j + 1)] = theta[static_cast<size_t>(i * width() + j)];
-				} else if (j == width() - 1) {
-					G[static_cast<size_t>((i + 1) * width() + j)] = G[static_cast<size_t>(i * width() + j)];
-					theta[static_cast<size_t>((i + 1) * width() + j)] = theta[static_cast<size_t>(i * width() + j)];
-				}
-
-				// setting the corners
-				if (i == 1 && j == 1) {
-					G[static_cast<size_t>((i - 1) * width() + j - 1)] = G[static_cast<size_t>(i * width() + j)];
-					theta[static_cast<size_t>((i - 1) * width() + j - 1)] = theta[static_cast<size_t>(i * width() + j)];
-				} else if (i == 1 && j == width() - 1) {
-					G[static_cast<size_t>((i - 1) * width() + j + 1)] = G[static_cast<size_t>(i * width() + j)];
-					theta[static_cast<size_t>((i - 1) * width() + j + 1)] = theta[static_cast<size_t>(i * width() + j)];
-				} else if (i == height() - 1 && j == 1) {
-					G[static_cast<size_t>((i + 1) * width() + j - 1)] = G[static_cast<size_t>(i * width() + j)];
-					theta[static_cast<size_t>((i + 1) * width() + j - 1)] = theta[static_cast<size_t>(i * width() + j)];
-				} else if (i == height() - 1 && j == width() - 1) {
-					G[static_cast<size_t>((i + 1) * width() + j + 1)] = G[static_cast<size_t>(i * width() + j)];
-					theta[static_cast<size_t>((i + 1) * width() + j + 1)] = theta[static_cast<size_t>(i * width() + j)];
-				}
-
-				// round to the nearest 45 degrees
-				theta[static_cast<size_t>(i * width() + j)] = static_cast<int>(round(theta[static_cast<size_t>(i * width() + j)] / 45) * 45);
+		uint32_t * dest = reinterpret_cast<uint32_t*>(pixelsCanny._image.data());
+		for(size_t i = 0; i < count; ++i) dest[i] = Color(edges[i], edges[i], edges[i]);
+		return pixelsCanny;
+	}
+	
+	//Canny on one 8 bit plane, the thresholds are fractions of the strongest gradient.  Edges come back scaled by that
+	//strongest gradient, weak edges joined to strong ones come back as higherThreshold, the one pixel border stays 0
+	static std::vector<uint8_t> CannyPlane(const uint8_t * plane, int width, int height, double lowerThreshold, double higherThreshold){
+		const size_t count = static_cast<size_t>(width) * static_cast<size_t>(height);
+		std::vector<uint8_t> result(count, 0);
+		if (width < 3 || height < 3) return result;
+		const size_t w = static_cast<size_t>(width);
+		
+		//Gradient size and which way it points, rounded to one of four directions
+		std::vector<uint16_t> magnitude(count, 0);
+		std::vector<uint8_t> direction(count, 0);
+		std::vector<int16_t> smooth(w), diff(w), gx(w), gy(w);
+		uint16_t largest = 0;
+		for(size_t y = 1; y < static_cast<size_t>(height) - 1; ++y){
+			SobelVertical(plane + (y - 1) * w, plane + y * w, plane + (y + 1) * w, smooth.data(), diff.data(), width);
+			SobelHorizontal(smooth.data(), diff.data(), gx.data(), gy.data(), &magnitude[y * w], width);
+			for(size_t x = 1; x < w - 1; ++x){
+				largest = std::max(largest, magnitude[y * w + x]);
+				direction[y * w + x] = CannyDirection(gx[x], gy[x]);
 			}
 		}
+		if (largest == 0) return result;
 		
-		// non-maximum suppression
-		for (int i = 1; i < height() - 1; i++) {
-			for (int j = 1; j < width() - 1; j++) {
-				if (theta[static_cast<size_t>(i * width() + j)] == 0 || theta[static_cast<size_t>(i * width() + j)] == 180) {
-					if (G[static_cast<size_t>(i * width() + j)] < G[static_cast<size_t>(i * width() + j - 1)] || G[static_cast<size_t>(i * width() + j)] < G[static_cast<size_t>(i * width() + j + 1)]) {
-						G[static_cast<size_t>(i * width() + j)] = 0;
-					}
-				} else if (theta[static_cast<size_t>(i * width() + j)] == 45 || theta[static_cast<size_t>(i * width() + j)] == 225) {
-					if (G[static_cast<size_t>(i * width() + j)] < G[static_cast<size_t>((i + 1) * width() + j + 1)] || G[static_cast<size_t>(i * width() + j)] < G[static_cast<size_t>((i - 1) * width() + j - 1)]) {
-						G[static_cast<size_t>(i * width() + j)] = 0;
-					}
-				} else if (theta[static_cast<size_t>(i * width() + j)] == 90 || theta[static_cast<size_t>(i * width() + j)] == 270) {
-					if (G[static_cast<size_t>(i * width() + j)] < G[static_cast<size_t>((i + 1) * width() + j)] || G[static_cast<size_t>(i * width() + j)] < G[static_cast<size_t>((i - 1) * width() + j)]) {
-						G[static_cast<size_t>(i * width() + j)] = 0;
-					}
-				} else {
-					if (G[static_cast<size_t>(i * width() + j)] < G[static_cast<size_t>((i + 1) * width() + j - 1)] || G[static_cast<size_t>(i * width() + j)] < G[static_cast<size_t>((i - 1) * width() + j + 1)]) {
-						G[static_cast<size_t>(i * width() + j)] = 0;
-					}
+		//Only keep pixels that are the peak across the edge. 0 nothing, 1 weak, 2 strong
+		const double lower = lowerThreshold * largest;
+		const double higher = higherThreshold * largest;
+		const size_t across[4] = {1, w + 1, w, w - 1};
+		std::vector<uint8_t> state(count, 0);
+		std::vector<size_t> stack;
+		for(size_t y = 1; y < static_cast<size_t>(height) - 1; ++y){
+			for(size_t i = y * w + 1; i < y * w + w - 1; ++i){
+				const uint16_t m = magnitude[i];
+				if (m == 0 || static_cast<double>(m) < lower) continue;
+				const size_t step = across[direction[i]];
+				if (m < magnitude[i - step] || m < magnitude[i + step]) continue;
+				if (static_cast<double>(m) >= higher){
+					state[i] = 2;
+					result[i] = static_cast<uint8_t>(m * 255 / largest);
+					stack.push_back(i);
+				}else{
+					state[i] = 1;
 				}
-
-				uint8_t c = static_cast<uint8_t>(G[static_cast<size_t>(i * width() + j)] * (255.0 / largestG));
-				pixelsCanny.pset_unsafe(j, i, Color(c, c, c));
 			}
 		}
-
-		// double threshold
-		bool changes;
-		do {
-			changes = false;
-			for (int i = 1; i < height() - 1; i++) {
-				for (int j = 1; j < width() - 1; j++) {
-					if (G[i * width() + j] < (lowerThreshold * largestG)) {
-						G[i * width() + j] = 0;
-					} else if (G[i * width() + j] >= (higherThreshold * largestG)) {
-						continue;
-					} else if (G[i * width() + j] < (higherThreshold * largestG)) {
-						G[i * width() + j] = 0;
-						for (int x = -1; x <= 1; x++) {
-							bool breakNestedLoop = false;
-							for (int y = -1; y <= 1; y++) {
-								if (x == 0 && y == 0) { continue; }
-								if (G[(i + x) * width() + (j + y)] >= (higherThreshold * largestG)) {
-									G[i * width() + j] = (higherThreshold * largestG);
-									changes = true;
-									breakNestedLoop = true;
-									break;
-								}
-							}
-							if (breakNestedLoop) { break; }
-						}
-					}
-					uint8_t c = static_cast<uint8_t>(G[static_cast<size_t>(i * width() + j)] * (255.0 / largestG));
-					pixelsCanny.pset_unsafe(j, i, Color(c, c, c));
-				}
-			}
-		} while (changes);
 		
-		free(G);
-		return pixelsCanny;
+		//Hysteresis, spread out from the strong pixels through weak neighbours, each pixel goes on the stack once
+		const uint8_t joined = static_cast<uint8_t>(higherThreshold * 255.0);
+		const size_t neighbours[8] = {w + 1, w, w - 1, 1, static_cast<size_t>(-1), static_cast<size_t>(-static_cast<ptrdiff_t>(w - 1)), static_cast<size_t>(-static_cast<ptrdiff_t>(w)), static_cast<size_t>(-static_cast<ptrdiff_t>(w + 1))};
+		while (!stack.empty()){
+			const size_t i = stack.back();
+			stack.pop_back();
+			for(size_t n : neighbours){
+				const size_t j = i + n;
+				if (state[j] != 1) continue;
+				state[j] = 2;
+				result[j] = joined;
+				stack.push_back(j);
+			}
+		}
+		return result;
+	}
+	
+	//0 is left and right, 1 is down right, 2 is up and down, 3 is down left.  29 / 70 is about tan(22.5)
+	inline static uint8_t CannyDirection(int gx, int gy){
+		const int ax = abs(gx);
+		const int ay = abs(gy);
+		if (ay * 70 <= ax * 29) return 0;
+		if (ay * 29 >= ax * 70) return 2;
+		return ((gx ^ gy) >= 0) ? 1 : 3;
+	}
+	
+	//Sobel splits into [1 2 1] across [-1 0 1], so this is the down half of both kernels for a whole row
+	static void SobelVertical(const uint8_t * above, const uint8_t * row, const uint8_t * below, int16_t * smooth, int16_t * diff, int width){
+		int x = 0;
+#ifdef IMAGE_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		for(; x + 16 <= width; x += 16){
+			const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(above + x));
+			const __m128i r = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + x));
+			const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(below + x));
+			const __m128i aLo = _mm_unpacklo_epi8(a, zero), aHi = _mm_unpackhi_epi8(a, zero);
+			const __m128i rLo = _mm_unpacklo_epi8(r, zero), rHi = _mm_unpackhi_epi8(r, zero);
+			const __m128i bLo = _mm_unpacklo_epi8(b, zero), bHi = _mm_unpackhi_epi8(b, zero);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(smooth + x), _mm_add_epi16(_mm_add_epi16(aLo, bLo), _mm_slli_epi16(rLo, 1)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(smooth + x + 8), _mm_add_epi16(_mm_add_epi16(aHi, bHi), _mm_slli_epi16(rHi, 1)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(diff + x), _mm_sub_epi16(bLo, aLo));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(diff + x + 8), _mm_sub_epi16(bHi, aHi));
+		}
+#endif
+		for(; x < width; ++x){
+			smooth[x] = static_cast<int16_t>(above[x] + 2 * row[x] + below[x]);
+			diff[x] = static_cast<int16_t>(below[x] - above[x]);
+		}
+	}
+	
+	//The across half, then the length of the gradient.  Leaves the first and last pixel alone
+	static void SobelHorizontal(const int16_t * smooth, const int16_t * diff, int16_t * gx, int16_t * gy, uint16_t * magnitude, int width){
+		int x = 1;
+#ifdef IMAGE_SSE2
+		for(; x + 8 <= width - 1; x += 8){
+			const __m128i h = _mm_sub_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(smooth + x + 1)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(smooth + x - 1)));
+			const __m128i v = _mm_add_epi16(_mm_add_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(diff + x - 1)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(diff + x + 1))), _mm_slli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(diff + x)), 1));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(gx + x), h);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(gy + x), v);
+			const __m128i lo = _mm_unpacklo_epi16(h, v);
+			const __m128i hi = _mm_unpackhi_epi16(h, v);
+			const __m128i lengthLo = _mm_cvtps_epi32(_mm_sqrt_ps(_mm_cvtepi32_ps(_mm_madd_epi16(lo, lo))));
+			const __m128i lengthHi = _mm_cvtps_epi32(_mm_sqrt_ps(_mm_cvtepi32_ps(_mm_madd_epi16(hi, hi))));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(magnitude + x), _mm_packs_epi32(lengthLo, lengthHi));
+		}
+#endif
+		for(; x < width - 1; ++x){
+			gx[x] = static_cast<int16_t>(smooth[x + 1] - smooth[x - 1]);
+			gy[x] = static_cast<int16_t>(diff[x - 1] + 2 * diff[x] + diff[x + 1]);
+			//Float square root and halves to even, the same as sqrtps and cvtps above
+			magnitude[x] = static_cast<uint16_t>(std::nearbyint(sqrtf(static_cast<float>(gx[x] * gx[x] + gy[x] * gy[x]))));
+		}
 	}
 
 
@@ -1054,104 +1803,169 @@ public:
 
 
 
-	Image gaussianBlur(float radius){	//nombre d'octets par pixel	
-		Image secondImage(width(), height(), true);
-		unsigned char* temp=new unsigned char[_widthTimes4 *_height];
-		float sigma2=radius*radius;	
-		int size=5;
-		//good approximation of filter	
-		float pixel[4];	
-		float sum;		
-		//blurs x components	
-		for(int y=0;y<_height;y++)	{
-			for(int x=0;x<_width;x++)		{
-				//process a pixel
-				sum=0;			
-				pixel[0]=0;			
-				pixel[1]=0;			
-				pixel[2]=0;			
-				pixel[3]=0;			
-				//accumulate colors			
-				for(int i=std::max(0,x-size);i<=std::min(_width-1,x+size);i++)			{
-					float factor= static_cast<float>(exp(static_cast<double>(-(i - x) * (i - x)) / (2.0 * sigma2)));
-					sum+=factor;				
-					for(int c=0;c<4;c++)				{					
-						pixel[c]+=factor*static_cast<float>(_image[static_cast<size_t>((i+y*_width)*4+c)]);
-					};			
-				};			
-				//copy a pixel			
-				for(int c=0;c<4;c++)			{				
-					temp[(x+y*_width)*4+c]=static_cast<unsigned char>(pixel[c]/sum);
-				};		
-			};	
-		};	
-		//blurs x components	
-		for(int y=0;y<_height;y++)	{		
-			for(int x=0;x<_width;x++)		{			
-				//process a pixel			
-				sum=0;			
-				pixel[0]=0;			
-				pixel[1]=0;			
-				pixel[2]=0;			
-				pixel[3]=0;			
-				//accumulate colors			
-				for(int i=std::max(0,y-size);i<=std::min(_height-1,y+size);i++)			{
-					float factor = static_cast<float>(exp(static_cast<double>(-(i - y) * (i - y)) / (2.0 * sigma2)));
-					sum+=factor;				
-					for(int c=0;c<4;c++)				{					
-						pixel[c]+=factor*static_cast<float>(temp[static_cast<size_t>((x+i*_width)*4+c)]);
-					};			
-				};			
-				//copy a pixel			
-				for(int c=0;c<4;c++)			{				
-					secondImage._image[static_cast<size_t>((x+y*_width)*4+c)]=static_cast<unsigned char>(pixel[c]/sum);
-				};		
-			};	
-		};	
-		delete[] temp;
+	//Exact uses the real kernel, out to 3 sigma.  Approximate is three box blurs in a row, which comes out close and costs the
+	//same whatever sigma is, worth it once sigma gets big
+	Image gaussianBlur(float sigma, bool approximate = false, unsigned int threads = 0){
+		if (sigma <= 0.0f || _width <= 0 || _height <= 0) return *this;
+		if (!approximate) return resample(GaussianTaps(_width, sigma), GaussianTaps(_height, sigma), threads);
+		
+		threads = WorkerThreads(pixels() / 4, threads);
+		int radii[3];
+		BoxRadii(sigma, radii);
+		Image secondImage(*this);
+		std::vector<uint8_t> temp(_image.size());
+		for(int radius : radii){
+			ParallelRows(_height, threads, [&](int begin, int end){
+				for(int y = begin; y < end; ++y) BoxBlurRow(&secondImage._image[pixelIndex(0, y)], &temp[pixelIndex(0, y)], _width, radius);
+			});
+			ParallelRows(_height, threads, [&](int begin, int end){
+				BoxBlurColumns(temp.data(), secondImage._image.data(), _width, _height, radius, begin, end);
+			});
+		}
 		return secondImage;
-	};
+	}
+	
+	//Box sizes for three passes whose combined spread matches sigma (Kutskir's version of Wells' method)
+	static void BoxRadii(float sigma, int (&radii)[3]){
+		const double variance = static_cast<double>(sigma) * static_cast<double>(sigma);
+		int lower = static_cast<int>(floor(sqrt(12.0 * variance / 3.0 + 1.0)));
+		if (lower % 2 == 0) --lower;
+		const int lowerPasses = static_cast<int>(std::lround((12.0 * variance - 3.0 * lower * lower - 12.0 * lower - 9.0) / (-4.0 * lower - 4.0)));
+		for(int i = 0; i < 3; ++i) radii[i] = ((i < lowerPasses ? lower : lower + 2) - 1) / 2;
+	}
+	
+	//Running sums along one row, averaging only the pixels that are on the image at the ends
+	static void BoxBlurRow(const uint8_t * source, uint8_t * dest, int width, int radius){
+		uint32_t sum[4] = {0, 0, 0, 0};
+		for(int x = 0; x < std::min(radius, width); ++x){
+			for(int c = 0; c < 4; ++c) sum[c] += source[x * 4 + c];
+		}
+		for(int x = 0; x < width; ++x){
+			if (x + radius < width){
+				for(int c = 0; c < 4; ++c) sum[c] += source[(x + radius) * 4 + c];
+			}
+			if (x - radius - 1 >= 0){
+				for(int c = 0; c < 4; ++c) sum[c] -= source[(x - radius - 1) * 4 + c];
+			}
+			const float scale = 1.0f / static_cast<float>(std::min(x + radius, width - 1) - std::max(x - radius, 0) + 1);
+			for(int c = 0; c < 4; ++c) dest[x * 4 + c] = static_cast<uint8_t>(static_cast<float>(sum[c]) * scale + 0.5f);
+		}
+	}
+	
+	//Same going down, a running sum per column so each row is read straight through
+	static void BoxBlurColumns(const uint8_t * source, uint8_t * dest, int width, int height, int radius, int rowBegin, int rowEnd){
+		const size_t rowBytes = static_cast<size_t>(width) * 4;
+		std::vector<uint32_t> sum(rowBytes, 0);
+		auto addRow = [&](int y, uint32_t sign){
+			const uint8_t * row = source + static_cast<size_t>(y) * rowBytes;
+			for(size_t i = 0; i < rowBytes; ++i) sum[i] += sign * row[i];
+		};
+		//Start with the window of the row above, the first step takes its top row back off
+		for(int y = std::max(rowBegin - radius - 1, 0); y < std::min(rowBegin + radius, height); ++y) addRow(y, 1);
+		for(int y = rowBegin; y < rowEnd; ++y){
+			if (y + radius < height) addRow(y + radius, 1);
+			if (y - radius - 1 >= 0) addRow(y - radius - 1, static_cast<uint32_t>(-1));
+			const float scale = 1.0f / static_cast<float>(std::min(y + radius, height - 1) - std::max(y - radius, 0) + 1);
+			uint8_t * row = dest + static_cast<size_t>(y) * rowBytes;
+			for(size_t i = 0; i < rowBytes; ++i) row[i] = static_cast<uint8_t>(static_cast<float>(sum[i]) * scale + 0.5f);
+		}
+	}
 
+	//Kept for old callers.  It used to recurse a pixel at a time, which runs out of stack on big areas, so it's the same fill now
 	void flood_fill_recursive(int x, int y, uint32_t color){
-		if (x < 0 || x >= width() || y < 0 || y >= height()) return;
-		if (point_unsafe(x, y) == color) return;
-		pset(x, y, color);
- 
-		flood_fill(x+1, y, color);
-		flood_fill(x-1, y, color);
-		flood_fill(x, y+1, color);
-		flood_fill(x, y-1, color);
-	}
-	
-	void flood_fill(int x, int y, uint32_t color){
-		uint32_t oldColor = point(x, y);
-		if (oldColor == color) return;
-
-		std::queue<std::pair<int, int> > q;
-		q.push({x, y});
-
-		while (!q.empty()) {
-			int xx = q.front().first;
-			int yy = q.front().second;
-			q.pop();
-
-			if (xx < 0 || xx >= width() || yy < 0 || yy >= height() || point(xx, yy) == color) {
-				continue;
+		flood_fill(x, y, color);
+	}
+	
+	//Fills the 4-connected area around x, y that matches its color, or is within tolerance of it on every channel
+	void flood_fill(int x, int y, uint32_t color, uint8_t tolerance = 0){
+		if (x < 0 || x >= _width || y < 0 || y >= _height) return;
+		uint32_t * data32 = reinterpret_cast<uint32_t*>(_image.data());
+		const uint32_t oldColor = data32[static_cast<size_t>(y) * static_cast<size_t>(_width) + static_cast<size_t>(x)];
+		if (tolerance == 0){
+			//Filled pixels stop matching, so nothing gets visited twice
+			if (oldColor == color) return;
+			ScanlineFill(x, y, _width, _height, [&](int px, int py){
+				return data32[static_cast<size_t>(py) * static_cast<size_t>(_width) + static_cast<size_t>(px)] == oldColor;
+			}, [&](int x1, int x2, int py){
+				FillSpan(data32 + static_cast<size_t>(py) * static_cast<size_t>(_width) + static_cast<size_t>(x1), static_cast<size_t>(x2 - x1 + 1), color);
+			});
+			return;
+		}
+		const std::vector<uint8_t> region = floodRegion(x, y, tolerance);
+		for(size_t i = 0; i < region.size(); ++i){
+			if (region[i]) data32[i] = color;
+		}
+	}
+	
+	//The area flood_fill would cover as an opaque white mask, everything else transparent, ready for put_mask
+	Image flood_mask(int x, int y, uint8_t tolerance = 0) const {
+		Image mask(width(), height(), true);
+		if (x < 0 || x >= _width || y < 0 || y >= _height) return mask;
+		const std::vector<uint8_t> region = floodRegion(x, y, tolerance);
+		uint32_t * dest = reinterpret_cast<uint32_t*>(mask._image.data());
+		for(size_t i = 0; i < region.size(); ++i){
+			if (region[i]) dest[i] = Color(255, 255, 255, 255);
+		}
+		return mask;
+	}
+	
+	//Seeds come off a stack and get widened to the whole run they're in, then the rows above and below get one seed for each
+	//run that belongs.  inside has to turn false once a pixel is filled
+	template <typename Inside, typename Fill>
+	static void ScanlineFill(int x, int y, int width, int height, Inside inside, Fill fill){
+		std::vector<std::pair<int, int> > seeds;
+		seeds.push_back({x, y});
+		while (!seeds.empty()){
+			x = seeds.back().first;
+			y = seeds.back().second;
+			seeds.pop_back();
+			if (!inside(x, y)) continue;
+			int left = x;
+			int right = x;
+			while (left > 0 && inside(left - 1, y)) --left;
+			while (right < width - 1 && inside(right + 1, y)) ++right;
+			fill(left, right, y);
+			for(int row : {y - 1, y + 1}){
+				if (row < 0 || row >= height) continue;
+				bool inRun = false;
+				for(int i = left; i <= right; ++i){
+					const bool in = inside(i, row);
+					if (in && !inRun) seeds.push_back({i, row});
+					inRun = in;
+				}
 			}
-
-			pset(xx, yy, color);
-
-			q.push({xx + 1, yy});
-			q.push({xx - 1, yy});
-			q.push({xx, yy + 1});
-			q.push({xx, yy - 1});
 		}
 	}
+	
+	//Which pixels the fill from x, y reaches, 1 for reached.  Keeps its own record since matching pixels don't change
+	std::vector<uint8_t> floodRegion(int x, int y, uint8_t tolerance) const {
+		const size_t w = static_cast<size_t>(_width);
+		std::vector<uint8_t> region(w * static_cast<size_t>(_height), 0);
+		const uint32_t * data32 = reinterpret_cast<const uint32_t*>(_image.data());
+		const uint32_t seed = data32[static_cast<size_t>(y) * w + static_cast<size_t>(x)];
+		ScanlineFill(x, y, _width, _height, [&](int px, int py){
+			const size_t i = static_cast<size_t>(py) * w + static_cast<size_t>(px);
+			return !region[i] && WithinTolerance(data32[i], seed, tolerance);
+		}, [&](int x1, int x2, int py){
+			std::fill(region.begin() + static_cast<ptrdiff_t>(static_cast<size_t>(py) * w + static_cast<size_t>(x1)), region.begin() + static_cast<ptrdiff_t>(static_cast<size_t>(py) * w + static_cast<size_t>(x2) + 1), 1);
+		});
+		return region;
+	}
+	
+	inline static bool WithinTolerance(uint32_t a, uint32_t b, uint8_t tolerance){
+		if (a == b) return true;
+		for(int shift = 0; shift < 32; shift += 8){
+			if (abs(static_cast<int>((a >> shift) & 255) - static_cast<int>((b >> shift) & 255)) > tolerance) return false;
+		}
+		return true;
+	}
 
 	
 
 private:
 	friend class Font;
+	friend class FontSource;
+	friend class DrawList;
 	inline Image() : _width(0), _widthTimes4(0), _height(0), _image(){
 		CTOR_OUT("Creating private blank " << static_cast<void*>(this));
 	}
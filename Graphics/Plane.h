@@ -0,0 +1,421 @@
+#ifndef PLANE_H
+#define PLANE_H
+
+#include "./Image.h"
+
+//Single channel images for intermediates that don't need four bytes a pixel: Plane<uint8_t> for greyscale and edge maps,
+//Plane<uint16_t> for more levels, Plane<float> for maths, and BitMask at one bit a pixel for marker hits and fill areas.
+//They draw and save like Image does, and convert to and from it and each other
+
+//Full scale for each value type, conversions go through 0 to 1
+template <typename T> struct PlaneRange { static constexpr double max = 255.0; };
+template <> struct PlaneRange<uint16_t> { static constexpr double max = 65535.0; };
+template <> struct PlaneRange<float> { static constexpr double max = 1.0; };
+
+template <typename T>
+inline T PlaneValue(double unit){
+	if (unit <= 0.0) return T(0);
+	if (unit >= 1.0) return static_cast<T>(PlaneRange<T>::max);
+	return static_cast<T>(unit * PlaneRange<T>::max + 0.5);
+}
+template <>
+inline float PlaneValue<float>(double unit){ return static_cast<float>(unit); }
+
+template <typename T>
+inline double PlaneUnit(T value){ return static_cast<double>(value) / PlaneRange<T>::max; }
+
+//Lines and rectangles for anything with pset_unsafe, hline and vline
+template <typename Derived, typename Value>
+class PlaneShapes {
+public:
+	void line(int x, int y, int x2, int y2, Value value){
+		Derived & self = static_cast<Derived&>(*this);
+		if (y == y2){
+			self.hline(y, std::min(x, x2), std::max(x, x2), value);
+			return;
+		}
+		if (x == x2){
+			self.vline(x, std::min(y, y2), std::max(y, y2), value);
+			return;
+		}
+		const int dx = abs(x2 - x);
+		const int sx = x < x2 ? 1 : -1;
+		const int dy = -abs(y2 - y);
+		const int sy = y < y2 ? 1 : -1;
+		int error, steps;
+		if (!Image::clip_line(x, y, x2, y2, error, steps, 0, 0, self.width() - 1, self.height() - 1)) return;
+		while(true){
+			self.pset_unsafe(x, y, value);
+			if (--steps == 0) return;
+			const int e2 = error * 2;
+			if (e2 >= dy){
+				error += dy;
+				x += sx;
+			}
+			if (e2 <= dx){
+				error += dx;
+				y += sy;
+			}
+		}
+	}
+	
+	void polyline(const std::vector<std::pair<int, int> > & points, Value value){
+		for(size_t i = 1; i < points.size(); ++i){
+			line(points[i - 1].first, points[i - 1].second, points[i].first, points[i].second, value);
+		}
+	}
+	
+	void rect_x2_and_y2(int x, int y, int x2, int y2, Value value){
+		Derived & self = static_cast<Derived&>(*this);
+		self.hline(y, x, x2, value);
+		self.hline(y2, x, x2, value);
+		self.vline(x, y, y2, value);
+		self.vline(x2, y, y2, value);
+	}
+	
+	void rect_fill_x2_and_y2(int x, int y, int x2, int y2, Value value){
+		Derived & self = static_cast<Derived&>(*this);
+		if (y2 < y){ int tmp = y; y = y2; y2 = tmp; }
+		y = std::max(y, 0);
+		y2 = std::min(y2, self.height() - 1);
+		for(; y <= y2; ++y) self.hline(y, x, x2, value);
+	}
+};
+
+template <typename T>
+class Plane : public PlaneShapes<Plane<T>, T> {
+public:
+	Plane(int width, int height, T fill = T(0)) : _width(std::max(width, 0)), _height(std::max(height, 0)), _data(static_cast<size_t>(_width) * static_cast<size_t>(_height), fill){}
+	
+	//Image::GreyScale of each pixel, scaled to T
+	explicit Plane(const Image & img) : Plane(img.width(), img.height()){
+		for(int y = 0; y < _height; ++y){
+			const uint32_t * source = &img.point_unsafe(0, y);
+			T * dest = row(y);
+			for(int x = 0; x < _width; ++x) dest[x] = PlaneValue<T>(PlaneUnit<uint8_t>(Image::GreyScale(source[x])));
+		}
+	}
+	
+	//One channel of an image, 0 is red through 3 for alpha
+	static Plane channel(const Image & img, int channel){
+		Plane res(img.width(), img.height());
+		const int shift = channel * 8;
+		for(int y = 0; y < res._height; ++y){
+			const uint32_t * source = &img.point_unsafe(0, y);
+			T * dest = res.row(y);
+			for(int x = 0; x < res._width; ++x) dest[x] = PlaneValue<T>(PlaneUnit<uint8_t>(static_cast<uint8_t>(source[x] >> shift)));
+		}
+		return res;
+	}
+	
+	inline int width() const { return _width; }
+	inline int height() const { return _height; }
+	inline T * data(){ return _data.data(); }
+	inline const T * data() const { return _data.data(); }
+	inline T * row(int y){ return &_data[static_cast<size_t>(y) * static_cast<size_t>(_width)]; }
+	inline const T * row(int y) const { return &_data[static_cast<size_t>(y) * static_cast<size_t>(_width)]; }
+	
+	inline T point(int x, int y) const {
+		if (x < 0 || x >= _width || y < 0 || y >= _height) return T(0);
+		return point_unsafe(x, y);
+	}
+	inline const T & point_unsafe(int x, int y) const { return row(y)[x]; }
+	inline T & point_unsafe(int x, int y){ return row(y)[x]; }
+	
+	inline void pset(int x, int y, T value){
+		if (x < 0 || x >= _width || y < 0 || y >= _height) return;
+		pset_unsafe(x, y, value);
+	}
+	inline void pset_unsafe(int x, int y, T value){ row(y)[x] = value; }
+	
+	inline void fill(T value){ std::fill(_data.begin(), _data.end(), value); }
+	
+	inline void hline(int y, int x, int x2, T value){
+		if (y < 0 || y >= _height) return;
+		if (x2 < x){ int tmp = x; x = x2; x2 = tmp; }
+		x = std::max(x, 0);
+		x2 = std::min(x2, _width - 1);
+		if (x <= x2) std::fill(row(y) + x, row(y) + x2 + 1, value);
+	}
+	
+	inline void vline(int x, int y, int y2, T value){
+		if (x < 0 || x >= _width) return;
+		if (y2 < y){ int tmp = y; y = y2; y2 = tmp; }
+		y = std::max(y, 0);
+		y2 = std::min(y2, _height - 1);
+		for(; y <= y2; ++y) row(y)[x] = value;
+	}
+	
+	//Same picture in another value type, rescaled so full scale stays full scale
+	template <typename U>
+	Plane<U> convert() const {
+		Plane<U> res(_width, _height);
+		U * dest = res.data();
+		for(size_t i = 0; i < _data.size(); ++i) dest[i] = PlaneValue<U>(PlaneUnit<T>(_data[i]));
+		return res;
+	}
+	
+	//Grey, opaque
+	Image toImage() const {
+		Image res(_width, _height, true);
+		for(int y = 0; y < _height; ++y){
+			const T * source = row(y);
+			uint32_t * dest = &res.point_unsafe(0, y);
+			for(int x = 0; x < _width; ++x){
+				const uint32_t grey = PlaneValue<uint8_t>(PlaneUnit<T>(source[x]));
+				dest[x] = Image::Color(grey, grey, grey);
+			}
+		}
+		return res;
+	}
+	
+	//8 bit planes save as 8 bit grey PNGs, the others as 16 bit
+	inline bool save(const std::string & filename) const { return save(filename.c_str()); }
+	bool save(const char * filename) const {
+		if (_width <= 0 || _height <= 0){
+			std::cerr << "Trying to save with dimentions of " << _width << " x " << _height << std::endl;
+			return false;
+		}
+		std::vector<unsigned char> bytes;
+		const unsigned int depth = (sizeof(T) == 1) ? 8 : 16;
+		if (depth == 8){
+			bytes.assign(_data.begin(), _data.end());
+		} else {
+			//PNG wants 16 bit samples high byte first
+			bytes.resize(_data.size() * 2);
+			for(size_t i = 0; i < _data.size(); ++i){
+				const uint16_t v = PlaneValue<uint16_t>(PlaneUnit<T>(_data[i]));
+				bytes[i * 2] = static_cast<unsigned char>(v >> 8);
+				bytes[i * 2 + 1] = static_cast<unsigned char>(v & 255);
+			}
+		}
+		unsigned int error = lodepng::encode(filename, bytes, static_cast<unsigned int>(_width), static_cast<unsigned int>(_height), LCT_GREY, depth);
+		if (error){
+			std::cerr << "encoder error " << error << ": "<< lodepng_error_text(error) << std::endl;
+			std::cerr << filename << std::endl;
+			return false;
+		}
+		return true;
+	}
+	
+	//Any PNG, converted to grey the same way Image::GreyScale does it
+	inline bool load(const std::string & filename) { return load(filename.c_str()); }
+	bool load(const char * filename){
+		std::vector<unsigned char> bytes;
+		unsigned int w, h;
+		const unsigned int depth = (sizeof(T) == 1) ? 8 : 16;
+		//lodepng only converts to grey at 8 bits, so come through RGB
+		unsigned int error = lodepng::decode(bytes, w, h, filename, LCT_RGB, depth);
+		if (error){
+			std::cerr << "decoder error " << error << ": " << lodepng_error_text(error) << std::endl;
+			std::cerr << filename << std::endl;
+			return false;
+		}
+		_width = static_cast<int>(w);
+		_height = static_cast<int>(h);
+		_data.resize(static_cast<size_t>(w) * static_cast<size_t>(h));
+		for(size_t i = 0; i < _data.size(); ++i){
+			if (depth == 8){
+				const unsigned int total = bytes[i * 3] + bytes[i * 3 + 1] + bytes[i * 3 + 2];
+				_data[i] = PlaneValue<T>(PlaneUnit<uint8_t>(static_cast<uint8_t>(total / 3)));
+			} else {
+				const unsigned char * rgb = &bytes[i * 6];
+				const unsigned int total = ((rgb[0] << 8) | rgb[1]) + ((rgb[2] << 8) | rgb[3]) + ((rgb[4] << 8) | rgb[5]);
+				_data[i] = PlaneValue<T>(PlaneUnit<uint16_t>(static_cast<uint16_t>(total / 3)));
+			}
+		}
+		return true;
+	}
+
+private:
+	int _width;
+	int _height;
+	std::vector<T> _data;
+};
+
+typedef Plane<uint8_t> GreyPlane;
+typedef Plane<uint16_t> Plane16;
+typedef Plane<float> FloatPlane;
+
+//One bit a pixel.  Rows are padded out to whole 64 bit words so spans and counts go a word at a time
+class BitMask : public PlaneShapes<BitMask, bool> {
+public:
+	BitMask(int width, int height, bool set = false) : _width(std::max(width, 0)), _height(std::max(height, 0)), _words(static_cast<size_t>((_width + 63) / 64)), _bits(_words * static_cast<size_t>(_height), 0){
+		if (set) fill(true);
+	}
+	
+	//Set where the image is fully opaque, the same pixels put_mask would copy
+	explicit BitMask(const Image & img) : BitMask(img.width(), img.height()){
+		for(int y = 0; y < _height; ++y){
+			const uint32_t * source = &img.point_unsafe(0, y);
+			for(int x = 0; x < _width; ++x){
+				if (Image::Alpha(source[x]) == 255) pset_unsafe(x, y, true);
+			}
+		}
+	}
+	
+	//Set wherever the plane is at least level
+	template <typename T>
+	static BitMask threshold(const Plane<T> & plane, T level){
+		BitMask res(plane.width(), plane.height());
+		for(int y = 0; y < res._height; ++y){
+			const T * source = plane.row(y);
+			for(int x = 0; x < res._width; ++x){
+				if (source[x] >= level) res.pset_unsafe(x, y, true);
+			}
+		}
+		return res;
+	}
+	
+	inline int width() const { return _width; }
+	inline int height() const { return _height; }
+	
+	inline bool point(int x, int y) const {
+		if (x < 0 || x >= _width || y < 0 || y >= _height) return false;
+		return point_unsafe(x, y);
+	}
+	inline bool point_unsafe(int x, int y) const { return (word(x, y) >> (x & 63)) & 1; }
+	
+	inline void pset(int x, int y, bool set){
+		if (x < 0 || x >= _width || y < 0 || y >= _height) return;
+		pset_unsafe(x, y, set);
+	}
+	inline void pset_unsafe(int x, int y, bool set){
+		const uint64_t bit = uint64_t(1) << (x & 63);
+		if (set) word(x, y) |= bit;
+		else word(x, y) &= ~bit;
+	}
+	
+	void fill(bool set){
+		std::fill(_bits.begin(), _bits.end(), set ? ~uint64_t(0) : 0);
+		if (set) clearPadding();
+	}
+	
+	//Whole words in the middle, partial ones at the ends
+	void hline(int y, int x, int x2, bool set){
+		if (y < 0 || y >= _height) return;
+		if (x2 < x){ int tmp = x; x = x2; x2 = tmp; }
+		x = std::max(x, 0);
+		x2 = std::min(x2, _width - 1);
+		if (x > x2) return;
+		uint64_t * words = &_bits[static_cast<size_t>(y) * _words];
+		const int first = x / 64;
+		const int last = x2 / 64;
+		for(int i = first; i <= last; ++i){
+			uint64_t bits = ~uint64_t(0);
+			if (i == first) bits &= ~uint64_t(0) << (x & 63);
+			if (i == last && (x2 & 63) != 63) bits &= (uint64_t(1) << ((x2 & 63) + 1)) - 1;
+			if (set) words[i] |= bits;
+			else words[i] &= ~bits;
+		}
+	}
+	
+	inline void vline(int x, int y, int y2, bool set){
+		if (x < 0 || x >= _width) return;
+		if (y2 < y){ int tmp = y; y = y2; y2 = tmp; }
+		y = std::max(y, 0);
+		y2 = std::min(y2, _height - 1);
+		for(; y <= y2; ++y) pset_unsafe(x, y, set);
+	}
+	
+	//How many pixels are set
+	size_t count() const {
+		size_t total = 0;
+		for(uint64_t bits : _bits) total += PopCount(bits);
+		return total;
+	}
+	
+	//Both have to be the same size
+	BitMask & operator &=(const BitMask & other){
+		assert(other._width == _width && other._height == _height);
+		for(size_t i = 0; i < _bits.size(); ++i) _bits[i] &= other._bits[i];
+		return *this;
+	}
+	BitMask & operator |=(const BitMask & other){
+		assert(other._width == _width && other._height == _height);
+		for(size_t i = 0; i < _bits.size(); ++i) _bits[i] |= other._bits[i];
+		return *this;
+	}
+	void invert(){
+		for(uint64_t & bits : _bits) bits = ~bits;
+		clearPadding();
+	}
+	
+	//Set pixels one color and the rest another, the defaults are the same as Image::flood_mask gives
+	Image toImage(uint32_t set = Image::Color(255, 255, 255, 255), uint32_t clear = 0) const {
+		Image res(_width, _height, true);
+		for(int y = 0; y < _height; ++y){
+			uint32_t * dest = &res.point_unsafe(0, y);
+			for(int x = 0; x < _width; ++x) dest[x] = point_unsafe(x, y) ? set : clear;
+		}
+		return res;
+	}
+	
+	//255 where set
+	GreyPlane toPlane() const {
+		GreyPlane res(_width, _height);
+		for(int y = 0; y < _height; ++y){
+			uint8_t * dest = res.row(y);
+			for(int x = 0; x < _width; ++x) dest[x] = point_unsafe(x, y) ? 255 : 0;
+		}
+		return res;
+	}
+	
+	//1 bit grey PNGs, white where set
+	inline bool save(const std::string & filename) const { return save(filename.c_str()); }
+	bool save(const char * filename) const {
+		if (_width <= 0 || _height <= 0){
+			std::cerr << "Trying to save with dimentions of " << _width << " x " << _height << std::endl;
+			return false;
+		}
+		//lodepng wants the bits run straight on from row to row, leftmost pixel in the high bit
+		std::vector<unsigned char> bytes((static_cast<size_t>(_width) * static_cast<size_t>(_height) + 7) / 8, 0);
+		size_t bit = 0;
+		for(int y = 0; y < _height; ++y){
+			for(int x = 0; x < _width; ++x, ++bit){
+				if (point_unsafe(x, y)) bytes[bit / 8] |= static_cast<unsigned char>(128 >> (bit & 7));
+			}
+		}
+		unsigned int error = lodepng::encode(filename, bytes, static_cast<unsigned int>(_width), static_cast<unsigned int>(_height), LCT_GREY, 1);
+		if (error){
+			std::cerr << "encoder error " << error << ": "<< lodepng_error_text(error) << std::endl;
+			std::cerr << filename << std::endl;
+			return false;
+		}
+		return true;
+	}
+	
+	//Any PNG, set where its grey is at least half way
+	inline bool load(const std::string & filename) { return load(filename.c_str()); }
+	bool load(const char * filename){
+		GreyPlane grey(0, 0);
+		if (!grey.load(filename)) return false;
+		*this = threshold(grey, static_cast<uint8_t>(128));
+		return true;
+	}
+
+private:
+	inline uint64_t & word(int x, int y){ return _bits[static_cast<size_t>(y) * _words + static_cast<size_t>(x / 64)]; }
+	inline const uint64_t & word(int x, int y) const { return _bits[static_cast<size_t>(y) * _words + static_cast<size_t>(x / 64)]; }
+	
+	//Keeps the bits past the right edge clear so count and operators don't see them
+	void clearPadding(){
+		if ((_width & 63) == 0) return;
+		const uint64_t keep = (uint64_t(1) << (_width & 63)) - 1;
+		for(int y = 0; y < _height; ++y) _bits[static_cast<size_t>(y) * _words + _words - 1] &= keep;
+	}
+	
+	inline static size_t PopCount(uint64_t bits){
+		bits = bits - ((bits >> 1) & 0x5555555555555555ULL);
+		bits = (bits & 0x3333333333333333ULL) + ((bits >> 2) & 0x3333333333333333ULL);
+		bits = (bits + (bits >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return static_cast<size_t>((bits * 0x0101010101010101ULL) >> 56);
+	}
+	
+	int _width;
+	int _height;
+	size_t _words;
+	std::vector<uint64_t> _bits;
+};
+
+#endif
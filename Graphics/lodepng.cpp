@@ -28,11 +28,36 @@ The manual and changelog are in the header file "lodepng.h"
 Rename this file to lodepng.cpp to use it for C++, or to lodepng.c to use it for C.
 */
 
+/*lodepng_map_file maps files with mmap, or MapViewOfFile on Windows, pass -DLODEPNG_NO_MMAP to always read them
+instead*/
+#if !defined(LODEPNG_NO_COMPILE_DISK) && !defined(LODEPNG_NO_MMAP)
+#if defined(_WIN32)
+#define LODEPNG_MAPVIEW
+#elif defined(__unix__) || defined(__APPLE__)
+#define LODEPNG_MMAP
+#if !defined(_POSIX_C_SOURCE) && !defined(__APPLE__)
+#define _POSIX_C_SOURCE 200112L /*mmap and posix_madvise are POSIX, not C90. Must come before any system header*/
+#endif
+#endif
+#endif
+
 #include "lodepng.h"
 
 #ifdef LODEPNG_COMPILE_DISK
 #include <limits.h> /* LONG_MAX */
 #include <stdio.h> /* file handling */
+#ifdef LODEPNG_MMAP
+#include <fcntl.h> /* open */
+#include <sys/mman.h> /* mmap, posix_madvise */
+#include <sys/stat.h> /* fstat */
+#include <unistd.h> /* close */
+#endif /* LODEPNG_MMAP */
+#ifdef LODEPNG_MAPVIEW
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h> /* CreateFileMappingA, MapViewOfFile */
+#endif /* LODEPNG_MAPVIEW */
 #endif /* LODEPNG_COMPILE_DISK */
 
 #ifdef LODEPNG_COMPILE_ALLOCATORS
@@ -113,6 +138,34 @@ void lodepng_free(void* ptr);
 #define LODEPNG_RESTRICT /* not available */
 #endif
 
+/* SSE2 is always there on x86-64, and on 32-bit x86 when the compiler is told to target it. It's used for the
+PNG unfilter of 3 and 4 byte pixels. Define LODEPNG_NO_SSE2 to only use the portable code. */
+#if !defined(LODEPNG_NO_SSE2) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) ||\
+    (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define LODEPNG_SSE2
+#include <emmintrin.h>
+#endif
+
+/* With GCC and Clang, CRC32 and Adler32 also have PCLMUL and AVX2 versions, built with target attributes so the rest
+of the file doesn't need those instruction sets, and only called when the CPU reports them. Define
+LODEPNG_NO_CPU_DISPATCH to leave them out. */
+#if defined(LODEPNG_SSE2) && (defined(__GNUC__) || defined(__clang__)) && !defined(LODEPNG_NO_CPU_DISPATCH) &&\
+    (defined(__cplusplus) || (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)))
+#define LODEPNG_CPU_DISPATCH
+#include <immintrin.h>
+#define LODEPNG_TARGET(features) __attribute__((target(features)))
+
+static int lodepng_cpu_has_pclmul(void) {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("pclmul");
+}
+
+static int lodepng_cpu_has_avx2(void) {
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+}
+#endif
+
 /* Replacements for C library functions such as memcpy and strlen, to support platforms
 where a full C library is not available. The compiler can recognize them and compile
 to something as fast. */
@@ -129,6 +182,18 @@ static void lodepng_memset(void* LODEPNG_RESTRICT dst,
   for(i = 0; i < num; i++) ((char*)dst)[i] = (char)value;
 }
 
+#ifdef LODEPNG_COMPILE_ZLIB
+/* the ranges may overlap */
+static void lodepng_memmove(void* dst, const void* src, size_t size) {
+  size_t i;
+  if((char*)dst < (const char*)src) {
+    for(i = 0; i < size; i++) ((char*)dst)[i] = ((const char*)src)[i];
+  } else {
+    for(i = size; i > 0; i--) ((char*)dst)[i - 1] = ((const char*)src)[i - 1];
+  }
+}
+#endif /*LODEPNG_COMPILE_ZLIB*/
+
 /* does not check memory out of bounds, do not use on untrusted data */
 static size_t lodepng_strlen(const char* a) {
   const char* orig = a;
@@ -293,6 +358,18 @@ static ucvector ucvector_init(unsigned char* buffer, size_t size) {
   return v;
 }
 
+#if defined(LODEPNG_COMPILE_PNG) || (defined(LODEPNG_COMPILE_ZLIB) && defined(LODEPNG_COMPILE_DECODER))
+/*a buffer of at least size bytes from a LodePNGScratch, its old contents are not kept when it has to grow*/
+static unsigned char* scratch_reserve(unsigned char** buffer, size_t* buffersize, size_t size) {
+  if(size > *buffersize) {
+    lodepng_free(*buffer);
+    *buffer = (unsigned char*)lodepng_malloc(size);
+    *buffersize = *buffer ? size : 0;
+  }
+  return *buffer;
+}
+#endif /*LODEPNG_COMPILE_PNG || (LODEPNG_COMPILE_ZLIB && LODEPNG_COMPILE_DECODER)*/
+
 /* ////////////////////////////////////////////////////////////////////////// */
 
 #ifdef LODEPNG_COMPILE_PNG
@@ -391,6 +468,76 @@ unsigned lodepng_load_file(unsigned char** out, size_t* outsize, const char* fil
   return lodepng_buffer_file(*out, (size_t)size, filename);
 }
 
+unsigned lodepng_map_file(LodePNGMappedFile* file, const char* filename) {
+  unsigned char* data = 0;
+  unsigned error;
+#ifdef LODEPNG_MMAP
+  int fd = open(filename, O_RDONLY);
+  file->mapped = 0;
+  if(fd >= 0) {
+    struct stat info;
+    size_t size;
+    /*empty files can't be mapped, and anything else, like a pipe, or too big for size_t, is read the usual way*/
+    if(fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0
+       && (off_t)(size = (size_t)info.st_size) == info.st_size) {
+      void* map = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(map != MAP_FAILED) {
+        /*only a hint, it doesn't matter if it's ignored*/
+        (void)posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+        file->data = (const unsigned char*)map;
+        file->size = size;
+        file->mapped = 1;
+      }
+    }
+    close(fd); /*the mapping keeps the file*/
+    if(file->mapped) return 0;
+  }
+#elif defined(LODEPNG_MAPVIEW)
+  HANDLE handle = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  file->mapped = 0;
+  if(handle != INVALID_HANDLE_VALUE) {
+    LARGE_INTEGER info;
+    /*the same files as with mmap: not empty ones, only files on disk and no bigger than size_t*/
+    if(GetFileType(handle) == FILE_TYPE_DISK && GetFileSizeEx(handle, &info) && info.QuadPart > 0
+       && (LONGLONG)(size_t)info.QuadPart == info.QuadPart) {
+      HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+      if(mapping) {
+        void* map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping); /*the view keeps the mapping*/
+        if(map) {
+          file->data = (const unsigned char*)map;
+          file->size = (size_t)info.QuadPart;
+          file->mapped = 1;
+        }
+      }
+    }
+    CloseHandle(handle); /*and the mapping keeps the file*/
+    if(file->mapped) return 0;
+  }
+#endif /* LODEPNG_MMAP */
+  file->mapped = 0;
+  file->size = 0;
+  error = lodepng_load_file(&data, &file->size, filename);
+  file->data = data;
+  return error;
+}
+
+void lodepng_unmap_file(LodePNGMappedFile* file) {
+#if defined(LODEPNG_MMAP)
+  if(file->mapped) munmap((void*)file->data, file->size);
+  else lodepng_free((void*)file->data);
+#elif defined(LODEPNG_MAPVIEW)
+  if(file->mapped) UnmapViewOfFile(file->data);
+  else lodepng_free((void*)file->data);
+#else /* LODEPNG_MMAP */
+  lodepng_free((void*)file->data);
+#endif /* LODEPNG_MMAP */
+  file->data = 0;
+  file->size = 0;
+  file->mapped = 0;
+}
+
 /*write given buffer to the file, overwriting the file, it doesn't append to it.*/
 unsigned lodepng_save_file(const unsigned char* buffer, size_t buffersize, const char* filename) {
   FILE* file;
@@ -1085,6 +1232,173 @@ static unsigned huffmanDecodeSymbol(LodePNGBitReader* reader, const HuffmanTree*
     return codetree->table_value[value];
   }
 }
+
+/*
+Fast inflate path, used while there are at least 8 input bytes left. The bit buffer is 64 bits wide and refilled
+with one unaligned read per symbol, which leaves at least 57 valid bits: enough for the longest length code, its
+extra bits, the longest distance code and its extra bits without another refill. Litlen symbols are looked up
+FAST_LL_BITS at a time, and a table entry holds up to 3 literals when their codes fit in those bits together.
+Needs a 64-bit type, which C90 doesn't promise, so it's left out there and the regular path does everything.
+Pass -DLODEPNG_NO_FAST_INFLATE to leave it out anyway, Checks/inflatebench compares the two that way.
+*/
+#if !defined(LODEPNG_NO_FAST_INFLATE) && (defined(__cplusplus) || (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)))
+#define LODEPNG_FAST_INFLATE
+typedef unsigned long long lodepng_bitbuf64;
+
+#define FAST_LL_BITS 11u
+/*output room kept free: the longest match, plus what 16-byte match copies and 3-literal stores can run past it*/
+#define FAST_OUT_MARGIN (258u + 32u)
+
+/*fast table entry kinds. An entry is: bits 0-3 code bits used, 4-5 kind, 6-7 literal count,
+8-31 up to 3 literals, or for a length: 8-16 length base and 20-23 extra bits*/
+#define FAST_SLOW 0u /*code longer than FAST_LL_BITS, or invalid: decode it through the tree*/
+#define FAST_LITERAL 1u
+#define FAST_LENGTH 2u
+#define FAST_END 3u
+
+static LODEPNG_INLINE lodepng_bitbuf64 lodepng_read64bitLE(const unsigned char* p) {
+  return (lodepng_bitbuf64)p[0] | ((lodepng_bitbuf64)p[1] << 8u) | ((lodepng_bitbuf64)p[2] << 16u) |
+         ((lodepng_bitbuf64)p[3] << 24u) | ((lodepng_bitbuf64)p[4] << 32u) | ((lodepng_bitbuf64)p[5] << 40u) |
+         ((lodepng_bitbuf64)p[6] << 48u) | ((lodepng_bitbuf64)p[7] << 56u);
+}
+
+/*decodes the symbol at the LSBs of bits with the tree's lookup tables, like huffmanDecodeSymbol, and stores its
+code length in len. If bits holds fewer valid bits than len, the symbol is not to be trusted.*/
+static LODEPNG_INLINE unsigned huffmanPeekSymbol(const HuffmanTree* codetree, unsigned bits, unsigned* len) {
+  unsigned code = bits & ((1u << FIRSTBITS) - 1u);
+  unsigned l = codetree->table_len[code];
+  unsigned value = codetree->table_value[code];
+  if(l <= FIRSTBITS) {
+    *len = l;
+    return value;
+  }
+  value += (bits >> FIRSTBITS) & ((1u << (l - FIRSTBITS)) - 1u);
+  *len = codetree->table_len[value];
+  return codetree->table_value[value];
+}
+
+static unsigned makeFastLengthEntry(unsigned len, unsigned symbol) {
+  if(symbol <= 255) return len | (FAST_LITERAL << 4u) | (1u << 6u) | (symbol << 8u);
+  if(symbol == 256) return len | (FAST_END << 4u);
+  return len | (FAST_LENGTH << 4u) | (LENGTHBASE[symbol - FIRST_LENGTH_CODE_INDEX] << 8u) |
+         (LENGTHEXTRA[symbol - FIRST_LENGTH_CODE_INDEX] << 20u);
+}
+
+static void makeFastLitLenTable(unsigned* table, const HuffmanTree* tree_ll) {
+  unsigned i;
+  for(i = 0; i != (1u << FAST_LL_BITS); ++i) {
+    unsigned len, used = 0, count = 0, literals = 0;
+    unsigned symbol = huffmanPeekSymbol(tree_ll, i, &len);
+    if(symbol > LAST_LENGTH_CODE_INDEX || len > FAST_LL_BITS) {
+      table[i] = FAST_SLOW;
+    } else if(symbol > 255) {
+      table[i] = makeFastLengthEntry(len, symbol);
+    } else {
+      /*keep adding literals while the next code is also a literal that fits in the remaining bits*/
+      while(count < 3 && symbol <= 255 && used + len <= FAST_LL_BITS) {
+        literals |= symbol << (8u * count);
+        used += len;
+        ++count;
+        symbol = huffmanPeekSymbol(tree_ll, i >> used, &len);
+      }
+      table[i] = used | (FAST_LITERAL << 4u) | (count << 6u) | (literals << 8u);
+    }
+  }
+}
+
+/*runs until the end code, an error, or too little input is left for 8-byte reads; done is set at the end code.
+If grow is 0 out is never reallocated, the loop stops instead when it runs short of room.*/
+static unsigned inflateHuffmanFast(ucvector* out, LodePNGBitReader* reader, const HuffmanTree* tree_ll,
+                                   const HuffmanTree* tree_d, const unsigned* fast_ll,
+                                   size_t max_output_size, int grow, int* done) {
+  const unsigned char* data = reader->data;
+  size_t bp = reader->bp;
+  unsigned error = 0;
+  if(reader->size < 8u) return 0;
+
+  while((bp >> 3u) <= reader->size - 8u) {
+    lodepng_bitbuf64 bits = lodepng_read64bitLE(data + (bp >> 3u)) >> (bp & 7u);
+    unsigned entry = fast_ll[bits & ((1u << FAST_LL_BITS) - 1u)];
+    unsigned kind = (entry >> 4u) & 3u;
+    unsigned char* dest;
+
+    if(out->allocsize - out->size < FAST_OUT_MARGIN) {
+      if(!grow) break;
+      if(!ucvector_reserve(out, out->size + FAST_OUT_MARGIN)) ERROR_BREAK(83); /*alloc fail*/
+    }
+    dest = out->data + out->size;
+
+    if(kind == FAST_SLOW) {
+      unsigned len;
+      unsigned symbol = huffmanPeekSymbol(tree_ll, (unsigned)(bits & 32767u), &len);
+      if(symbol > LAST_LENGTH_CODE_INDEX) ERROR_BREAK(16); /*error: tried to read disallowed huffman symbol*/
+      entry = makeFastLengthEntry(len, symbol);
+      kind = (entry >> 4u) & 3u;
+    }
+
+    if(kind == FAST_LITERAL) {
+      /*always store 3, the margin has room and the size only counts the real ones*/
+      dest[0] = (unsigned char)(entry >> 8u);
+      dest[1] = (unsigned char)(entry >> 16u);
+      dest[2] = (unsigned char)(entry >> 24u);
+      out->size += (entry >> 6u) & 3u;
+      bp += entry & 15u;
+    } else if(kind == FAST_LENGTH) {
+      unsigned extra, code_d, len_d;
+      size_t length, distance;
+      const unsigned char* src;
+      unsigned char* stop;
+
+      bits >>= entry & 15u;
+      bp += entry & 15u;
+      extra = (entry >> 20u) & 15u;
+      length = ((entry >> 8u) & 511u) + (unsigned)(bits & ((1u << extra) - 1u));
+      bits >>= extra;
+      bp += extra;
+
+      code_d = huffmanPeekSymbol(tree_d, (unsigned)(bits & 32767u), &len_d);
+      if(code_d > 29) {
+        if(code_d <= 31) {
+          ERROR_BREAK(18); /*error: invalid distance code (30-31 are never used)*/
+        } else /* if(code_d == INVALIDSYMBOL) */{
+          ERROR_BREAK(16); /*error: tried to read disallowed huffman symbol*/
+        }
+      }
+      bits >>= len_d;
+      bp += len_d;
+      extra = DISTANCEEXTRA[code_d];
+      distance = DISTANCEBASE[code_d] + (unsigned)(bits & ((1u << extra) - 1u));
+      bp += extra;
+
+      if(distance > out->size) ERROR_BREAK(52); /*too long backward distance*/
+      src = dest - distance;
+      stop = dest + length;
+      out->size += length;
+      if(distance >= 16u) {
+        /*whole chunks never read what the same chunk writes, the last one may run past length into the margin*/
+        do {
+          lodepng_memcpy(dest, src, 16);
+          dest += 16;
+          src += 16;
+        } while(dest < stop);
+      } else if(distance == 1u) {
+        lodepng_memset(dest, *src, length);
+      } else {
+        while(dest < stop) *dest++ = *src++;
+      }
+    } else /*if(kind == FAST_END)*/ {
+      bp += entry & 15u;
+      *done = 1;
+      break;
+    }
+
+    if(max_output_size && out->size > max_output_size) ERROR_BREAK(109); /*error, larger than max size*/
+  }
+
+  reader->bp = bp;
+  return error;
+}
+#endif /*__cplusplus || C99*/
 #endif /*LODEPNG_COMPILE_DECODER*/
 
 #ifdef LODEPNG_COMPILE_DECODER
@@ -1235,6 +1549,89 @@ static unsigned getTreeInflateDynamic(HuffmanTree* tree_ll, HuffmanTree* tree_d,
   return error;
 }
 
+/*decodes one symbol of a Huffman block into out, or two literals in a row. out must have room for 260 more bytes.
+done is set at the end code.*/
+static unsigned inflateHuffmanSymbol(ucvector* out, LodePNGBitReader* reader, const HuffmanTree* tree_ll,
+                                     const HuffmanTree* tree_d, int* done) {
+  /*code_ll is literal, length or end code*/
+  unsigned code_ll;
+  /* ensure enough bits for 2 huffman code reads (15 bits each): if the first is a literal, a second literal is read at once. This
+  appears to be slightly faster, than ensuring 20 bits here for 1 huffman symbol and the potential 5 extra bits for the length symbol.*/
+  ensureBits32(reader, 30);
+  code_ll = huffmanDecodeSymbol(reader, tree_ll);
+  if(code_ll <= 255) {
+    /*slightly faster code path if multiple literals in a row*/
+    out->data[out->size++] = (unsigned char)code_ll;
+    code_ll = huffmanDecodeSymbol(reader, tree_ll);
+  }
+  if(code_ll <= 255) /*literal symbol*/ {
+    out->data[out->size++] = (unsigned char)code_ll;
+  } else if(code_ll >= FIRST_LENGTH_CODE_INDEX && code_ll <= LAST_LENGTH_CODE_INDEX) /*length code*/ {
+    unsigned code_d, distance;
+    unsigned numextrabits_l, numextrabits_d; /*extra bits for length and distance*/
+    size_t start, backward, length;
+
+    /*part 1: get length base*/
+    length = LENGTHBASE[code_ll - FIRST_LENGTH_CODE_INDEX];
+
+    /*part 2: get extra bits and add the value of that to length*/
+    numextrabits_l = LENGTHEXTRA[code_ll - FIRST_LENGTH_CODE_INDEX];
+    if(numextrabits_l != 0) {
+      /* bits already ensured above */
+      ensureBits25(reader, 5);
+      length += readBits(reader, numextrabits_l);
+    }
+
+    /*part 3: get distance code*/
+    ensureBits32(reader, 28); /* up to 15 for the huffman symbol, up to 13 for the extra bits */
+    code_d = huffmanDecodeSymbol(reader, tree_d);
+    if(code_d > 29) {
+      if(code_d <= 31) {
+        return 18; /*error: invalid distance code (30-31 are never used)*/
+      } else /* if(code_d == INVALIDSYMBOL) */{
+        return 16; /*error: tried to read disallowed huffman symbol*/
+      }
+    }
+    distance = DISTANCEBASE[code_d];
+
+    /*part 4: get extra bits from distance*/
+    numextrabits_d = DISTANCEEXTRA[code_d];
+    if(numextrabits_d != 0) {
+      /* bits already ensured above */
+      distance += readBits(reader, numextrabits_d);
+    }
+
+    /*part 5: fill in all the out[n] values based on the length and dist*/
+    start = out->size;
+    if(distance > start) return 52; /*too long backward distance*/
+    backward = start - distance;
+
+    out->size += length;
+    if(distance < length) {
+      size_t forward;
+      lodepng_memcpy(out->data + start, out->data + backward, distance);
+      start += distance;
+      for(forward = distance; forward < length; ++forward) {
+        out->data[start++] = out->data[backward++];
+      }
+    } else {
+      lodepng_memcpy(out->data + start, out->data + backward, length);
+    }
+  } else if(code_ll == 256) {
+    *done = 1; /*end code, finish the loop*/
+  } else /*if(code_ll == INVALIDSYMBOL)*/ {
+    return 16; /*error: tried to read disallowed huffman symbol*/
+  }
+  /*check if any of the ensureBits above went out of bounds*/
+  if(reader->bp > reader->bitsize) {
+    /*return error code 10 or 11 depending on the situation that happened in huffmanDecodeSymbol
+    (10=no endcode, 11=wrong jump outside of tree)*/
+    /* TODO: revise error codes 10,11,50: the above comment is no longer valid */
+    return 51; /*error, bit pointer jumps past memory*/
+  }
+  return 0;
+}
+
 /*inflate a block with dynamic of fixed Huffman tree. btype must be 1 or 2.*/
 static unsigned inflateHuffmanBlock(ucvector* out, LodePNGBitReader* reader,
                                     unsigned btype, size_t max_output_size) {
@@ -1252,89 +1649,25 @@ static unsigned inflateHuffmanBlock(ucvector* out, LodePNGBitReader* reader,
   if(btype == 1) error = getTreeInflateFixed(&tree_ll, &tree_d);
   else /*if(btype == 2)*/ error = getTreeInflateDynamic(&tree_ll, &tree_d, reader);
 
+#ifdef LODEPNG_FAST_INFLATE
+  /*most of the block goes through the fast path, the loop below finishes the last few bytes of input*/
+  if(!error) {
+    unsigned fast_ll[1u << FAST_LL_BITS];
+    makeFastLitLenTable(fast_ll, &tree_ll);
+    error = inflateHuffmanFast(out, reader, &tree_ll, &tree_d, fast_ll, max_output_size, 1, &done);
+    if(!error && out->allocsize - out->size < reserved_size) {
+      if(!ucvector_reserve(out, out->size + reserved_size)) error = 83; /*alloc fail*/
+    }
+  }
+#endif /*LODEPNG_FAST_INFLATE*/
 
   while(!error && !done) /*decode all symbols until end reached, breaks at end code*/ {
-    /*code_ll is literal, length or end code*/
-    unsigned code_ll;
-    /* ensure enough bits for 2 huffman code reads (15 bits each): if the first is a literal, a second literal is read at once. This
-    appears to be slightly faster, than ensuring 20 bits here for 1 huffman symbol and the potential 5 extra bits for the length symbol.*/
-    ensureBits32(reader, 30);
-    code_ll = huffmanDecodeSymbol(reader, &tree_ll);
-    if(code_ll <= 255) {
-      /*slightly faster code path if multiple literals in a row*/
-      out->data[out->size++] = (unsigned char)code_ll;
-      code_ll = huffmanDecodeSymbol(reader, &tree_ll);
-    }
-    if(code_ll <= 255) /*literal symbol*/ {
-      out->data[out->size++] = (unsigned char)code_ll;
-    } else if(code_ll >= FIRST_LENGTH_CODE_INDEX && code_ll <= LAST_LENGTH_CODE_INDEX) /*length code*/ {
-      unsigned code_d, distance;
-      unsigned numextrabits_l, numextrabits_d; /*extra bits for length and distance*/
-      size_t start, backward, length;
-
-      /*part 1: get length base*/
-      length = LENGTHBASE[code_ll - FIRST_LENGTH_CODE_INDEX];
-
-      /*part 2: get extra bits and add the value of that to length*/
-      numextrabits_l = LENGTHEXTRA[code_ll - FIRST_LENGTH_CODE_INDEX];
-      if(numextrabits_l != 0) {
-        /* bits already ensured above */
-        ensureBits25(reader, 5);
-        length += readBits(reader, numextrabits_l);
-      }
-
-      /*part 3: get distance code*/
-      ensureBits32(reader, 28); /* up to 15 for the huffman symbol, up to 13 for the extra bits */
-      code_d = huffmanDecodeSymbol(reader, &tree_d);
-      if(code_d > 29) {
-        if(code_d <= 31) {
-          ERROR_BREAK(18); /*error: invalid distance code (30-31 are never used)*/
-        } else /* if(code_d == INVALIDSYMBOL) */{
-          ERROR_BREAK(16); /*error: tried to read disallowed huffman symbol*/
-        }
-      }
-      distance = DISTANCEBASE[code_d];
-
-      /*part 4: get extra bits from distance*/
-      numextrabits_d = DISTANCEEXTRA[code_d];
-      if(numextrabits_d != 0) {
-        /* bits already ensured above */
-        distance += readBits(reader, numextrabits_d);
-      }
-
-      /*part 5: fill in all the out[n] values based on the length and dist*/
-      start = out->size;
-      if(distance > start) ERROR_BREAK(52); /*too long backward distance*/
-      backward = start - distance;
-
-      out->size += length;
-      if(distance < length) {
-        size_t forward;
-        lodepng_memcpy(out->data + start, out->data + backward, distance);
-        start += distance;
-        for(forward = distance; forward < length; ++forward) {
-          out->data[start++] = out->data[backward++];
-        }
-      } else {
-        lodepng_memcpy(out->data + start, out->data + backward, length);
-      }
-    } else if(code_ll == 256) {
-      done = 1; /*end code, finish the loop*/
-    } else /*if(code_ll == INVALIDSYMBOL)*/ {
-      ERROR_BREAK(16); /*error: tried to read disallowed huffman symbol*/
-    }
-    if(out->allocsize - out->size < reserved_size) {
-      if(!ucvector_reserve(out, out->size + reserved_size)) ERROR_BREAK(83); /*alloc fail*/
-    }
-    /*check if any of the ensureBits above went out of bounds*/
-    if(reader->bp > reader->bitsize) {
-      /*return error code 10 or 11 depending on the situation that happened in huffmanDecodeSymbol
-      (10=no endcode, 11=wrong jump outside of tree)*/
-      /* TODO: revise error codes 10,11,50: the above comment is no longer valid */
-      ERROR_BREAK(51); /*error, bit pointer jumps past memory*/
+    error = inflateHuffmanSymbol(out, reader, &tree_ll, &tree_d, &done);
+    if(!error && out->allocsize - out->size < reserved_size) {
+      if(!ucvector_reserve(out, out->size + reserved_size)) error = 83; /*alloc fail*/
     }
-    if(max_output_size && out->size > max_output_size) {
-      ERROR_BREAK(109); /*error, larger than max size*/
+    if(!error && max_output_size && out->size > max_output_size) {
+      error = 109; /*error, larger than max size*/
     }
   }
 
@@ -1497,10 +1830,25 @@ typedef struct Hash {
   int* headz; /*similar to head, but for chainz*/
   unsigned short* chainz; /*those with same amount of zeros*/
   unsigned short* zeros; /*length of zeros streak, used as a second hash chain*/
+
+  unsigned windowsize; /*the window the chains were allocated for, they also serve any smaller one*/
+  uivector lz77; /*LZ77 output of the current block, kept so the next block can use its memory*/
 } Hash;
 
-static unsigned hash_init(Hash* hash, unsigned windowsize) {
+/*clears the chains for a new stream, windowsize may be smaller than the one of hash_init*/
+static void hash_reset(Hash* hash, unsigned windowsize) {
   unsigned i;
+  for(i = 0; i != HASH_NUM_VALUES; ++i) hash->head[i] = -1;
+  for(i = 0; i != windowsize; ++i) hash->val[i] = -1;
+  for(i = 0; i != windowsize; ++i) hash->chain[i] = i; /*same value as index indicates uninitialized*/
+
+  for(i = 0; i <= MAX_SUPPORTED_DEFLATE_LENGTH; ++i) hash->headz[i] = -1;
+  for(i = 0; i != windowsize; ++i) hash->chainz[i] = i; /*same value as index indicates uninitialized*/
+}
+
+static unsigned hash_init(Hash* hash, unsigned windowsize) {
+  hash->windowsize = windowsize;
+  uivector_init(&hash->lz77);
   hash->head = (int*)lodepng_malloc(sizeof(int) * HASH_NUM_VALUES);
   hash->val = (int*)lodepng_malloc(sizeof(int) * windowsize);
   hash->chain = (unsigned short*)lodepng_malloc(sizeof(unsigned short) * windowsize);
@@ -1513,14 +1861,7 @@ static unsigned hash_init(Hash* hash, unsigned windowsize) {
     return 83; /*alloc fail*/
   }
 
-  /*initialize hash table*/
-  for(i = 0; i != HASH_NUM_VALUES; ++i) hash->head[i] = -1;
-  for(i = 0; i != windowsize; ++i) hash->val[i] = -1;
-  for(i = 0; i != windowsize; ++i) hash->chain[i] = i; /*same value as index indicates uninitialized*/
-
-  for(i = 0; i <= MAX_SUPPORTED_DEFLATE_LENGTH; ++i) hash->headz[i] = -1;
-  for(i = 0; i != windowsize; ++i) hash->chainz[i] = i; /*same value as index indicates uninitialized*/
-
+  hash_reset(hash, windowsize);
   return 0;
 }
 
@@ -1532,6 +1873,32 @@ static void hash_cleanup(Hash* hash) {
   lodepng_free(hash->zeros);
   lodepng_free(hash->headz);
   lodepng_free(hash->chainz);
+
+  uivector_cleanup(&hash->lz77);
+}
+
+/*the hash kept in the scratch, made anew if it was too small for this window*/
+static unsigned hash_from_scratch(Hash** hash, LodePNGScratch* scratch, unsigned windowsize) {
+  Hash* kept = (Hash*)scratch->hash;
+  if(kept && kept->windowsize >= windowsize) {
+    hash_reset(kept, windowsize);
+    *hash = kept;
+    return 0;
+  }
+  if(kept) {
+    hash_cleanup(kept);
+    lodepng_free(kept);
+    scratch->hash = 0;
+  }
+  kept = (Hash*)lodepng_malloc(sizeof(Hash));
+  if(!kept) return 83; /*alloc fail*/
+  scratch->hash = kept;
+  *hash = kept;
+  if(hash_init(kept, windowsize)) {
+    kept->windowsize = 0; /*so the next stream doesn't take the half allocated chains*/
+    return 83; /*alloc fail*/
+  }
+  return 0;
 }
 
 
@@ -1736,18 +2103,19 @@ static unsigned encodeLZ77(uivector* out, Hash* hash,
 
 /* /////////////////////////////////////////////////////////////////////////// */
 
-static unsigned deflateNoCompression(ucvector* out, const unsigned char* data, size_t datasize) {
+static unsigned deflateNoCompression(ucvector* out, const unsigned char* data, size_t datasize, unsigned final) {
   /*non compressed deflate block data: 1 bit BFINAL,2 bits BTYPE,(5 bits): it jumps to start of next byte,
   2 bytes LEN, 2 bytes NLEN, LEN bytes literal DATA*/
 
   size_t i, numdeflateblocks = (datasize + 65534u) / 65535u;
   unsigned datapos = 0;
+  if(numdeflateblocks == 0 && final) numdeflateblocks = 1; /*the stream still needs its last block*/
   for(i = 0; i != numdeflateblocks; ++i) {
     unsigned BFINAL, BTYPE, LEN, NLEN;
     unsigned char firstbyte;
     size_t pos = out->size;
 
-    BFINAL = (i == numdeflateblocks - 1);
+    BFINAL = final && (i == numdeflateblocks - 1);
     BTYPE = 0;
 
     LEN = 65535;
@@ -1841,7 +2209,8 @@ static unsigned deflateDynamic(LodePNGBitWriter* writer, Hash* hash,
   size_t numcodes_ll, numcodes_d, numcodes_lld, numcodes_lld_e, numcodes_cl;
   unsigned HLIT, HDIST, HCLEN;
 
-  uivector_init(&lz77_encoded);
+  lz77_encoded = hash->lz77; /*reuse the memory of the previous block*/
+  lz77_encoded.size = 0;
   HuffmanTree_init(&tree_ll);
   HuffmanTree_init(&tree_d);
   HuffmanTree_init(&tree_cl);
@@ -2008,7 +2377,7 @@ static unsigned deflateDynamic(LodePNGBitWriter* writer, Hash* hash,
   }
 
   /*cleanup*/
-  uivector_cleanup(&lz77_encoded);
+  hash->lz77 = lz77_encoded; /*hash_cleanup frees it*/
   HuffmanTree_cleanup(&tree_ll);
   HuffmanTree_cleanup(&tree_d);
   HuffmanTree_cleanup(&tree_cl);
@@ -2044,12 +2413,12 @@ static unsigned deflateFixed(LodePNGBitWriter* writer, Hash* hash,
     writeBits(writer, 0, 1); /*second bit of BTYPE*/
 
     if(settings->use_lz77) /*LZ77 encoded*/ {
-      uivector lz77_encoded;
-      uivector_init(&lz77_encoded);
+      uivector lz77_encoded = hash->lz77; /*reuse the memory of the previous block*/
+      lz77_encoded.size = 0;
       error = encodeLZ77(&lz77_encoded, hash, data, datapos, dataend, settings->windowsize,
                          settings->minmatch, settings->nicematch, settings->lazymatching);
       if(!error) writeLZ77data(writer, &lz77_encoded, &tree_ll, &tree_d);
-      uivector_cleanup(&lz77_encoded);
+      hash->lz77 = lz77_encoded; /*hash_cleanup frees it*/
     } else /*no LZ77, but still will be Huffman compressed*/ {
       for(i = datapos; i < dataend; ++i) {
         writeBitsReversed(writer, tree_ll.codes[data[i]], tree_ll.lengths[data[i]]);
@@ -2066,47 +2435,92 @@ static unsigned deflateFixed(LodePNGBitWriter* writer, Hash* hash,
   return error;
 }
 
-static unsigned lodepng_deflatev(ucvector* out, const unsigned char* in, size_t insize,
-                                 const LodePNGCompressSettings* settings) {
+/*on PNGs, deflate blocks of 65-262k seem to give most dense encoding*/
+static size_t deflateBlockSize(size_t insize) {
+  size_t blocksize = insize / 8u + 8;
+  if(blocksize < 65536) blocksize = 65536;
+  if(blocksize > 262144) blocksize = 262144;
+  return blocksize;
+}
+
+/*
+Deflates in[start..end) in blocks of blocksize bytes. Up to a window of bytes before start are put in the hash first,
+so matches can reach back into them. Unless final is set, an empty stored block ends the output ("sync flush"): that
+leaves it byte aligned, so the deflate output of the bytes after end can simply be appended.
+*/
+static unsigned deflateRange(ucvector* out, const unsigned char* in, size_t start, size_t end, size_t blocksize,
+                             unsigned final, const LodePNGCompressSettings* settings) {
   unsigned error = 0;
-  size_t i, blocksize, numdeflateblocks;
-  Hash hash;
+  size_t i, pos, numdeflateblocks;
+  Hash ownhash;
+  Hash* hash = &ownhash;
   LodePNGBitWriter writer;
 
   LodePNGBitWriter_init(&writer, out);
 
   if(settings->btype > 2) return 61;
-  else if(settings->btype == 0) return deflateNoCompression(out, in, insize);
-  else if(settings->btype == 1) blocksize = insize;
-  else /*if(settings->btype == 2)*/ {
-    /*on PNGs, deflate blocks of 65-262k seem to give most dense encoding*/
-    blocksize = insize / 8u + 8;
-    if(blocksize < 65536) blocksize = 65536;
-    if(blocksize > 262144) blocksize = 262144;
-  }
+  else if(settings->btype == 0) return deflateNoCompression(out, in + start, end - start, final);
+  else if(settings->btype == 1) blocksize = end - start;
+  if(blocksize == 0) blocksize = 1;
 
-  numdeflateblocks = (insize + blocksize - 1) / blocksize;
+  numdeflateblocks = (end - start + blocksize - 1) / blocksize;
   if(numdeflateblocks == 0) numdeflateblocks = 1;
 
-  error = hash_init(&hash, settings->windowsize);
+  if(settings->scratch) error = hash_from_scratch(&hash, settings->scratch, settings->windowsize);
+  else error = hash_init(hash, settings->windowsize);
+
+  if(!error && settings->use_lz77 && start != 0) {
+    unsigned numzeros = 0;
+    if(settings->windowsize == 0 || settings->windowsize > 32768) error = 60; /*same checks as encodeLZ77*/
+    else if((settings->windowsize & (settings->windowsize - 1)) != 0) error = 90;
+    pos = start > settings->windowsize ? start - settings->windowsize : 0;
+    for(; !error && pos < start; ++pos) {
+      /*same hash and zero run bookkeeping as encodeLZ77*/
+      unsigned hashval = getHash(in, end, pos);
+      if(hashval == 0) {
+        if(numzeros == 0) numzeros = countZeros(in, end, pos);
+        else if(pos + numzeros > end || in[pos + numzeros - 1] != 0) --numzeros;
+      } else {
+        numzeros = 0;
+      }
+      updateHashChain(hash, pos & (settings->windowsize - 1), hashval, (unsigned short)numzeros);
+    }
+  }
 
   if(!error) {
     for(i = 0; i != numdeflateblocks && !error; ++i) {
-      unsigned final = (i == numdeflateblocks - 1);
-      size_t start = i * blocksize;
-      size_t end = start + blocksize;
-      if(end > insize) end = insize;
+      unsigned lastblock = final && (i == numdeflateblocks - 1);
+      size_t blockstart = start + i * blocksize;
+      size_t blockend = blockstart + blocksize;
+      if(blockend > end) blockend = end;
 
-      if(settings->btype == 1) error = deflateFixed(&writer, &hash, in, start, end, settings, final);
-      else if(settings->btype == 2) error = deflateDynamic(&writer, &hash, in, start, end, settings, final);
+      if(settings->btype == 1) error = deflateFixed(&writer, hash, in, blockstart, blockend, settings, lastblock);
+      else if(settings->btype == 2) error = deflateDynamic(&writer, hash, in, blockstart, blockend, settings, lastblock);
+    }
+  }
+
+  if(!error && !final) {
+    /*BFINAL 0, BTYPE 00, padding to the byte boundary, then LEN 0 and NLEN 65535*/
+    writeBits(&writer, 0, 3);
+    if(!ucvector_resize(out, out->size + 4)) error = 83; /*alloc fail*/
+    else {
+      out->data[out->size - 4] = 0;
+      out->data[out->size - 3] = 0;
+      out->data[out->size - 2] = 255;
+      out->data[out->size - 1] = 255;
     }
   }
 
-  hash_cleanup(&hash);
+  if(!settings->scratch) hash_cleanup(hash);
 
   return error;
 }
 
+static unsigned lodepng_deflatev(ucvector* out, const unsigned char* in, size_t insize,
+                                 const LodePNGCompressSettings* settings) {
+  return deflateRange(out, in, 0, insize, deflateBlockSize(insize), 1, settings);
+}
+
 unsigned lodepng_deflate(unsigned char** out, size_t* outsize,
                          const unsigned char* in, size_t insize,
                          const LodePNGCompressSettings* settings) {
@@ -2135,10 +2549,108 @@ static unsigned deflate(unsigned char** out, size_t* outsize,
 /* / Adler32                                                                / */
 /* ////////////////////////////////////////////////////////////////////////// */
 
-static unsigned update_adler32(unsigned adler, const unsigned char* data, unsigned len) {
+#ifdef LODEPNG_SSE2
+/*
+Adler32 over len bytes, len a multiple of 32. Per 32 byte step, s1 gains the byte total and s2 gains 32 times the s1
+from before the step plus each byte weighted 32 down to 1. The s1 from before each step is summed up in ps and
+multiplied by 32 once at the end of a run, a run being short enough that nothing overflows before the modulo.
+*/
+static unsigned adler32BlocksSSE2(unsigned adler, const unsigned char* data, unsigned len) {
+  unsigned s1 = adler & 0xffffu;
+  unsigned s2 = (adler >> 16u) & 0xffffu;
+  unsigned blocks = len / 32u;
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i tap1 = _mm_setr_epi16(32, 31, 30, 29, 28, 27, 26, 25);
+  const __m128i tap2 = _mm_setr_epi16(24, 23, 22, 21, 20, 19, 18, 17);
+  const __m128i tap3 = _mm_setr_epi16(16, 15, 14, 13, 12, 11, 10, 9);
+  const __m128i tap4 = _mm_setr_epi16(8, 7, 6, 5, 4, 3, 2, 1);
+
+  while(blocks != 0u) {
+    unsigned n = blocks > 5552u / 32u ? 5552u / 32u : blocks;
+    __m128i v_ps = _mm_cvtsi32_si128((int)(s1 * n));
+    __m128i v_s2 = _mm_cvtsi32_si128((int)s2);
+    __m128i v_s1 = zero;
+    blocks -= n;
+    do {
+      __m128i bytes1 = _mm_loadu_si128((const __m128i*)data);
+      __m128i bytes2 = _mm_loadu_si128((const __m128i*)(data + 16));
+      v_ps = _mm_add_epi32(v_ps, v_s1);
+      v_s1 = _mm_add_epi32(v_s1, _mm_add_epi32(_mm_sad_epu8(bytes1, zero), _mm_sad_epu8(bytes2, zero)));
+      v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpacklo_epi8(bytes1, zero), tap1));
+      v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpackhi_epi8(bytes1, zero), tap2));
+      v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpacklo_epi8(bytes2, zero), tap3));
+      v_s2 = _mm_add_epi32(v_s2, _mm_madd_epi16(_mm_unpackhi_epi8(bytes2, zero), tap4));
+      data += 32;
+    } while(--n);
+    v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+    /*add up the lanes*/
+    v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(1, 0, 3, 2)));
+    v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(2, 3, 0, 1)));
+    v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(1, 0, 3, 2)));
+    s1 = (s1 + (unsigned)_mm_cvtsi128_si32(v_s1)) % 65521u;
+    s2 = (unsigned)_mm_cvtsi128_si32(v_s2) % 65521u;
+  }
+  return (s2 << 16u) | s1;
+}
+#endif /*LODEPNG_SSE2*/
+
+#ifdef LODEPNG_CPU_DISPATCH
+/*same as adler32BlocksSSE2, with the 32 bytes in one register and vpmaddubsw for the weights*/
+LODEPNG_TARGET("avx2")
+static unsigned adler32BlocksAVX2(unsigned adler, const unsigned char* data, unsigned len) {
   unsigned s1 = adler & 0xffffu;
   unsigned s2 = (adler >> 16u) & 0xffffu;
+  unsigned blocks = len / 32u;
+  const __m256i zero = _mm256_setzero_si256();
+  const __m256i ones = _mm256_set1_epi16(1);
+  const __m256i taps = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+                                        16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+
+  while(blocks != 0u) {
+    unsigned n = blocks > 5552u / 32u ? 5552u / 32u : blocks;
+    __m256i v_ps = _mm256_setr_epi32((int)(s1 * n), 0, 0, 0, 0, 0, 0, 0);
+    __m256i v_s2 = _mm256_setr_epi32((int)s2, 0, 0, 0, 0, 0, 0, 0);
+    __m256i v_s1 = zero;
+    __m128i sum1, sum2;
+    blocks -= n;
+    do {
+      __m256i bytes = _mm256_loadu_si256((const __m256i*)data);
+      v_ps = _mm256_add_epi32(v_ps, v_s1);
+      v_s1 = _mm256_add_epi32(v_s1, _mm256_sad_epu8(bytes, zero));
+      v_s2 = _mm256_add_epi32(v_s2, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, taps), ones));
+      data += 32;
+    } while(--n);
+    v_s2 = _mm256_add_epi32(v_s2, _mm256_slli_epi32(v_ps, 5));
+    sum1 = _mm_add_epi32(_mm256_castsi256_si128(v_s1), _mm256_extracti128_si256(v_s1, 1));
+    sum2 = _mm_add_epi32(_mm256_castsi256_si128(v_s2), _mm256_extracti128_si256(v_s2, 1));
+    sum1 = _mm_add_epi32(sum1, _mm_shuffle_epi32(sum1, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum2 = _mm_add_epi32(sum2, _mm_shuffle_epi32(sum2, _MM_SHUFFLE(2, 3, 0, 1)));
+    sum2 = _mm_add_epi32(sum2, _mm_shuffle_epi32(sum2, _MM_SHUFFLE(1, 0, 3, 2)));
+    s1 = (s1 + (unsigned)_mm_cvtsi128_si32(sum1)) % 65521u;
+    s2 = (unsigned)_mm_cvtsi128_si32(sum2) % 65521u;
+  }
+  return (s2 << 16u) | s1;
+}
+#endif /*LODEPNG_CPU_DISPATCH*/
 
+static unsigned update_adler32(unsigned adler, const unsigned char* data, unsigned len) {
+  unsigned s1, s2;
+
+#ifdef LODEPNG_SSE2
+  if(len >= 32u) {
+    unsigned bulk = len & ~31u;
+#ifdef LODEPNG_CPU_DISPATCH
+    if(lodepng_cpu_has_avx2()) adler = adler32BlocksAVX2(adler, data, bulk);
+    else
+#endif /*LODEPNG_CPU_DISPATCH*/
+    adler = adler32BlocksSSE2(adler, data, bulk);
+    data += bulk;
+    len -= bulk;
+  }
+#endif /*LODEPNG_SSE2*/
+
+  s1 = adler & 0xffffu;
+  s2 = (adler >> 16u) & 0xffffu;
   while(len != 0u) {
     unsigned i;
     /*at least 5552 sums can be done before the sums overflow, saving a lot of module divisions*/
@@ -2217,9 +2729,243 @@ unsigned lodepng_zlib_decompress(unsigned char** out, size_t* outsize, const uns
   return error;
 }
 
-/*expected_size is expected output size, to avoid intermediate allocations. Set to 0 if not known. */
+/*
+Inflates a zlib stream a window at a time, for decoders that never hold all of its output. The input comes in pieces
+from next (which gives a null piece at the end) through a small buffer, and the output goes into a window that keeps
+the 32KB back references can reach, followed by what the caller has not taken yet. custom_zlib and custom_inflate
+are not used.
+*/
+#define ZSTREAM_HISTORY 32768u
+#define ZSTREAM_INPUT 65536u /*size of the input buffer*/
+#define ZSTREAM_LOOKAHEAD 1024u /*input kept ahead of the reader while there is more, over the longest block header*/
+#define ZSTREAM_ROOM 290u /*output room one more symbol needs, the same as FAST_OUT_MARGIN*/
+#define ZSTREAM_FILL 65536u /*the least output made by a fill that doesn't reach the end*/
+
+/*steps of the stream*/
+#define ZSTREAM_ZLIB 0u /*the 2 byte zlib header*/
+#define ZSTREAM_BLOCK 1u /*a block header*/
+#define ZSTREAM_STORED 2u
+#define ZSTREAM_HUFFMAN 3u
+#define ZSTREAM_ADLER 4u
+#define ZSTREAM_DONE 5u
+
+typedef struct ZStream {
+  LodePNGBitReader reader; /*reads from in*/
+  unsigned char* in;
+  unsigned (*next)(void* source, const unsigned char** piece, size_t* piecesize);
+  void* source;
+  const unsigned char* piece; /*what's left of the current piece, not in the input buffer yet*/
+  size_t piecesize;
+  unsigned ended; /*next gave the null piece*/
+  ucvector out; /*the window*/
+  size_t taken; /*the caller is done with out up to here, what's before it is only kept as history*/
+  size_t summed; /*out is in the adler32 up to here*/
+  unsigned adler;
+  unsigned step;
+  unsigned final; /*the current block is the last one*/
+  size_t stored; /*bytes left of a stored block*/
+  HuffmanTree tree_ll;
+  HuffmanTree tree_d;
+#ifdef LODEPNG_FAST_INFLATE
+  unsigned fast_ll[1u << FAST_LL_BITS];
+#endif /*LODEPNG_FAST_INFLATE*/
+  const LodePNGDecompressSettings* settings;
+} ZStream;
+
+/*span is the most output the caller takes at once*/
+static unsigned zstream_init(ZStream* z, size_t span,
+                             unsigned (*next)(void* source, const unsigned char** piece, size_t* piecesize),
+                             void* source, const LodePNGDecompressSettings* settings) {
+  size_t windowsize;
+  z->in = 0;
+  z->out = ucvector_init(0, 0);
+  HuffmanTree_init(&z->tree_ll);
+  HuffmanTree_init(&z->tree_d);
+  if(lodepng_addofl(span, ZSTREAM_HISTORY + ZSTREAM_FILL + ZSTREAM_ROOM, &windowsize)) return 92;
+  z->in = (unsigned char*)lodepng_malloc(ZSTREAM_INPUT);
+  z->out = ucvector_init((unsigned char*)lodepng_malloc(windowsize), windowsize);
+  if(!z->in || !z->out.data) return 83; /*alloc fail*/
+  z->out.size = 0;
+  LodePNGBitReader_init(&z->reader, z->in, 0);
+  z->next = next;
+  z->source = source;
+  z->piece = 0;
+  z->piecesize = 0;
+  z->ended = 0;
+  z->taken = z->summed = 0;
+  z->adler = 1u;
+  z->step = ZSTREAM_ZLIB;
+  z->final = 0;
+  z->stored = 0;
+  z->settings = settings;
+  return 0;
+}
+
+static void zstream_cleanup(ZStream* z) {
+  lodepng_free(z->in);
+  lodepng_free(z->out.data);
+  HuffmanTree_cleanup(&z->tree_ll);
+  HuffmanTree_cleanup(&z->tree_d);
+}
+
+/*input bytes from the one the reader is in*/
+static size_t zstream_available(const ZStream* z) {
+  size_t pos = z->reader.bp >> 3u;
+  return pos < z->reader.size ? z->reader.size - pos : 0;
+}
+
+/*moves the input not read yet to the front of the buffer and tops it up from the pieces*/
+static unsigned zstream_refill(ZStream* z) {
+  size_t size = zstream_available(z);
+  lodepng_memmove(z->in, z->in + z->reader.size - size, size);
+  z->reader.bp &= 7u;
+  while(size < ZSTREAM_INPUT && !z->ended) {
+    size_t amount;
+    if(!z->piecesize) {
+      unsigned error = z->next(z->source, &z->piece, &z->piecesize);
+      if(error) return error;
+      if(!z->piece) z->ended = 1;
+      continue;
+    }
+    amount = z->piecesize < ZSTREAM_INPUT - size ? z->piecesize : ZSTREAM_INPUT - size;
+    lodepng_memcpy(z->in + size, z->piece, amount);
+    z->piece += amount;
+    z->piecesize -= amount;
+    size += amount;
+  }
+  z->reader.size = size;
+  z->reader.bitsize = size * 8u;
+  return 0;
+}
+
+static void zstream_sum(ZStream* z) {
+  if(!z->settings->ignore_adler32 && z->out.size > z->summed) {
+    z->adler = update_adler32(z->adler, z->out.data + z->summed, (unsigned)(z->out.size - z->summed));
+  }
+  z->summed = z->out.size;
+}
+
+static unsigned zstream_zlib(ZStream* z) {
+  const unsigned char* in = z->in + (z->reader.bp >> 3u);
+  if(zstream_available(z) < 2) return 53; /*error, size of zlib data too small*/
+  /*the same checks as lodepng_zlib_decompressv*/
+  if((in[0] * 256 + in[1]) % 31 != 0) return 24;
+  if((in[0] & 15) != 8 || ((in[0] >> 4) & 15) > 7) return 25;
+  if(((in[1] >> 5) & 1) != 0) return 26;
+  z->reader.bp += 16u;
+  z->step = ZSTREAM_BLOCK;
+  return 0;
+}
+
+static unsigned zstream_block(ZStream* z) {
+  LodePNGBitReader* reader = &z->reader;
+  unsigned error = 0, BTYPE;
+  if(reader->bp > reader->bitsize || reader->bitsize - reader->bp < 3) return 52; /*error, bit pointer will jump past memory*/
+  ensureBits9(reader, 3);
+  z->final = readBits(reader, 1);
+  BTYPE = readBits(reader, 2);
+
+  if(BTYPE == 3) return 20; /*error: invalid BTYPE*/
+  if(BTYPE == 0) {
+    /*stored block, see inflateNoCompression*/
+    size_t bytepos = (reader->bp + 7u) >> 3u;
+    unsigned LEN, NLEN;
+    if(bytepos + 4 > reader->size) return 52; /*error, bit pointer will jump past memory*/
+    LEN = (unsigned)reader->data[bytepos] + ((unsigned)reader->data[bytepos + 1] << 8u);
+    NLEN = (unsigned)reader->data[bytepos + 2] + ((unsigned)reader->data[bytepos + 3] << 8u);
+    if(!z->settings->ignore_nlen && LEN + NLEN != 65535) return 21; /*error: NLEN is not one's complement of LEN*/
+    reader->bp = (bytepos + 4) << 3u;
+    z->stored = LEN;
+    z->step = ZSTREAM_STORED;
+    return 0;
+  }
+
+  HuffmanTree_cleanup(&z->tree_ll);
+  HuffmanTree_cleanup(&z->tree_d);
+  HuffmanTree_init(&z->tree_ll);
+  HuffmanTree_init(&z->tree_d);
+  if(BTYPE == 1) error = getTreeInflateFixed(&z->tree_ll, &z->tree_d);
+  else error = getTreeInflateDynamic(&z->tree_ll, &z->tree_d, reader);
+  if(error) return error;
+#ifdef LODEPNG_FAST_INFLATE
+  makeFastLitLenTable(z->fast_ll, &z->tree_ll);
+#endif /*LODEPNG_FAST_INFLATE*/
+  z->step = ZSTREAM_HUFFMAN;
+  return 0;
+}
+
+static unsigned zstream_stored(ZStream* z) {
+  size_t amount = zstream_available(z);
+  if(amount > z->stored) amount = z->stored;
+  if(amount > z->out.allocsize - z->out.size) amount = z->out.allocsize - z->out.size;
+  if(!amount && z->stored && z->ended) return 23; /*error: reading outside of in buffer*/
+  /*out->data can be NULL (when LEN is zero), and arithmetics on NULL ptr is undefined*/
+  if(amount) {
+    lodepng_memcpy(z->out.data + z->out.size, z->in + (z->reader.bp >> 3u), amount);
+    z->out.size += amount;
+    z->reader.bp += amount << 3u;
+    z->stored -= amount;
+  }
+  if(!z->stored) z->step = z->final ? ZSTREAM_ADLER : ZSTREAM_BLOCK;
+  return 0;
+}
+
+static unsigned zstream_huffman(ZStream* z) {
+  unsigned error = 0;
+  int done = 0;
+#ifdef LODEPNG_FAST_INFLATE
+  error = inflateHuffmanFast(&z->out, &z->reader, &z->tree_ll, &z->tree_d, z->fast_ll, 0, 0, &done);
+#endif /*LODEPNG_FAST_INFLATE*/
+  /*the bits the regular path reads ahead have to be real input, unless the input is over anyway*/
+  while(!error && !done && z->out.allocsize - z->out.size >= ZSTREAM_ROOM
+        && (z->ended || zstream_available(z) >= ZSTREAM_LOOKAHEAD)) {
+    error = inflateHuffmanSymbol(&z->out, &z->reader, &z->tree_ll, &z->tree_d, &done);
+  }
+  if(done) z->step = z->final ? ZSTREAM_ADLER : ZSTREAM_BLOCK;
+  return error;
+}
+
+static unsigned zstream_adler(ZStream* z) {
+  z->step = ZSTREAM_DONE;
+  if(!z->settings->ignore_adler32) {
+    size_t bytepos = (z->reader.bp + 7u) >> 3u;
+    zstream_sum(z);
+    if(bytepos + 4 > z->reader.size || lodepng_read32bitInt(z->in + bytepos) != z->adler) {
+      return 58; /*error, adler checksum not correct, data must be corrupted*/
+    }
+  }
+  return 0;
+}
+
+/*drops what's beyond the history from the window, then inflates until it is full or the stream is done*/
+static unsigned zstream_fill(ZStream* z) {
+  unsigned error = 0;
+  size_t cut = z->out.size > ZSTREAM_HISTORY ? z->out.size - ZSTREAM_HISTORY : 0;
+  if(cut > z->taken) cut = z->taken;
+  if(cut) {
+    lodepng_memmove(z->out.data, z->out.data + cut, z->out.size - cut);
+    z->out.size -= cut;
+    z->taken -= cut;
+    z->summed -= cut;
+  }
+
+  while(!error && z->step != ZSTREAM_DONE && z->out.allocsize - z->out.size >= ZSTREAM_ROOM) {
+    if(!z->ended && zstream_available(z) < ZSTREAM_LOOKAHEAD) error = zstream_refill(z);
+    else if(z->step == ZSTREAM_ZLIB) error = zstream_zlib(z);
+    else if(z->step == ZSTREAM_BLOCK) error = zstream_block(z);
+    else if(z->step == ZSTREAM_STORED) error = zstream_stored(z);
+    else if(z->step == ZSTREAM_HUFFMAN) error = zstream_huffman(z);
+    else error = zstream_adler(z);
+  }
+  zstream_sum(z);
+  return error;
+}
+
+/*expected_size is expected output size, to avoid intermediate allocations. Set to 0 if not known.
+With scratch, *out becomes scratch->data and stays owned by the scratch. */
 static unsigned zlib_decompress(unsigned char** out, size_t* outsize, size_t expected_size,
-                                const unsigned char* in, size_t insize, const LodePNGDecompressSettings* settings) {
+                                const unsigned char* in, size_t insize, const LodePNGDecompressSettings* settings,
+                                LodePNGScratch* scratch) {
   unsigned error;
   if(settings->custom_zlib) {
     error = settings->custom_zlib(out, outsize, in, insize, settings);
@@ -2231,12 +2977,19 @@ static unsigned zlib_decompress(unsigned char** out, size_t* outsize, size_t exp
     }
   } else {
     ucvector v = ucvector_init(*out, *outsize);
-    if(expected_size) {
+    if(scratch) {
+      v = ucvector_init(scratch_reserve(&scratch->data, &scratch->datasize, expected_size), scratch->datasize);
+      v.size = 0;
+    } else if(expected_size) {
       /*reserve the memory to avoid intermediate reallocations*/
       ucvector_resize(&v, *outsize + expected_size);
       v.size = *outsize;
     }
     error = lodepng_zlib_decompressv(&v, in, insize, settings);
+    if(scratch) {
+      scratch->data = v.data;
+      scratch->datasize = v.allocsize;
+    }
     *out = v.data;
     *outsize = v.size;
   }
@@ -2247,14 +3000,138 @@ static unsigned zlib_decompress(unsigned char** out, size_t* outsize, size_t exp
 
 #ifdef LODEPNG_COMPILE_ENCODER
 
+/*Adler32 of two buffers back to back, from the Adler32 of each and the length of the second*/
+static unsigned adler32Combine(unsigned adler1, unsigned adler2, size_t len2) {
+  unsigned rem = (unsigned)(len2 % 65521u);
+  unsigned s1 = adler1 & 0xffffu;
+  unsigned s2 = (rem * s1) % 65521u;
+  s1 += (adler2 & 0xffffu) + 65521u - 1u;
+  s2 += ((adler1 >> 16u) & 0xffffu) + ((adler2 >> 16u) & 0xffffu) + 65521u - rem;
+  if(s1 >= 65521u) s1 -= 65521u;
+  if(s1 >= 65521u) s1 -= 65521u;
+  if(s2 >= 65521u * 2u) s2 -= 65521u * 2u;
+  if(s2 >= 65521u) s2 -= 65521u;
+  return (s2 << 16u) | s1;
+}
+
+/*one piece of input per job, each deflated on its own after the window before it is put in its hash*/
+typedef struct DeflateJobs {
+  const unsigned char* in;
+  size_t start; /*where the first piece starts, the bytes before it are only the window*/
+  size_t insize;
+  size_t piecesize;
+  size_t count;
+  unsigned final; /*whether the last piece ends the deflate stream*/
+  const LodePNGCompressSettings* settings;
+  ucvector* outs;
+  unsigned* adlers;
+  unsigned* errors;
+} DeflateJobs;
+
+static void deflatePiece(void* data, size_t index) {
+  DeflateJobs* jobs = (DeflateJobs*)data;
+  size_t start = jobs->start + index * jobs->piecesize;
+  size_t end = start + jobs->piecesize;
+  LodePNGCompressSettings settings = *jobs->settings;
+  settings.scratch = 0; /*the pieces run at the same time*/
+  if(end > jobs->insize) end = jobs->insize;
+  jobs->errors[index] = deflateRange(&jobs->outs[index], jobs->in, start, end, jobs->piecesize,
+                                     jobs->final && index + 1 == jobs->count, &settings);
+  jobs->adlers[index] = adler32(jobs->in + start, (unsigned)(end - start));
+}
+
+/*
+Deflates in[start, insize) through settings->parallel_run, one piece per deflate block, appending the blocks to out
+in order and adding the bytes to the running Adler32 in *adler, put together from those of the pieces.
+*/
+static unsigned deflatePieces(ucvector* out, unsigned* adler, const unsigned char* in, size_t start, size_t insize,
+                              size_t piecesize, unsigned final, const LodePNGCompressSettings* settings) {
+  unsigned error = 0;
+  size_t i, total = 0;
+  DeflateJobs jobs;
+  jobs.in = in;
+  jobs.start = start;
+  jobs.insize = insize;
+  jobs.piecesize = piecesize;
+  jobs.count = insize == start ? 1 : (insize - start + piecesize - 1) / piecesize;
+  jobs.final = final;
+  jobs.settings = settings;
+  jobs.outs = (ucvector*)lodepng_malloc(jobs.count * sizeof(ucvector));
+  /*before anything else can fail, the cleanup below frees these*/
+  if(jobs.outs) {
+    for(i = 0; i != jobs.count; ++i) jobs.outs[i] = ucvector_init(NULL, 0);
+  }
+  jobs.adlers = (unsigned*)lodepng_malloc(jobs.count * sizeof(unsigned));
+  jobs.errors = (unsigned*)lodepng_malloc(jobs.count * sizeof(unsigned));
+  if(!jobs.outs || !jobs.adlers || !jobs.errors) error = 83; /*alloc fail*/
+
+  if(!error) {
+    settings->parallel_run(deflatePiece, &jobs, jobs.count, settings->parallel_context);
+    for(i = 0; i != jobs.count && !error; ++i) {
+      error = jobs.errors[i];
+      total += jobs.outs[i].size;
+    }
+  }
+
+  if(!error && !ucvector_reserve(out, out->size + total)) error = 83; /*alloc fail*/
+
+  if(!error) {
+    for(i = 0; i != jobs.count; ++i) {
+      size_t len = (i + 1 == jobs.count) ? insize - start - i * piecesize : piecesize;
+      lodepng_memcpy(out->data + out->size, jobs.outs[i].data, jobs.outs[i].size);
+      out->size += jobs.outs[i].size;
+      *adler = adler32Combine(*adler, jobs.adlers[i], len);
+    }
+  }
+
+  if(jobs.outs) {
+    for(i = 0; i != jobs.count; ++i) lodepng_free(jobs.outs[i].data);
+  }
+  lodepng_free(jobs.outs);
+  lodepng_free(jobs.adlers);
+  lodepng_free(jobs.errors);
+  return error;
+}
+
+/*
+Deflate through settings->parallel_run: one piece per deflate block, so the blocks come out as in the serial encoder
+apart from the sync flush after each piece.
+*/
+static unsigned deflateParallel(unsigned char** out, size_t* outsize, unsigned* adler,
+                                const unsigned char* in, size_t insize, const LodePNGCompressSettings* settings) {
+  ucvector v = ucvector_init(NULL, 0);
+  unsigned error;
+  *adler = 1u;
+  error = deflatePieces(&v, adler, in, 0, insize, deflateBlockSize(insize), 1, settings);
+  *out = v.data;
+  *outsize = v.size;
+  return error;
+}
+
 unsigned lodepng_zlib_compress(unsigned char** out, size_t* outsize, const unsigned char* in,
                                size_t insize, const LodePNGCompressSettings* settings) {
   size_t i;
   unsigned error;
   unsigned char* deflatedata = 0;
   size_t deflatesize = 0;
-
-  error = deflate(&deflatedata, &deflatesize, in, insize, settings);
+  unsigned ADLER32 = 0;
+
+  if(settings->parallel_run && !settings->custom_deflate) {
+    error = deflateParallel(&deflatedata, &deflatesize, &ADLER32, in, insize, settings);
+  } else if(settings->scratch && !settings->custom_deflate) {
+    /*deflate into the kept buffer, only the zlib stream below is new memory*/
+    ucvector v = ucvector_init(settings->scratch->zdata, settings->scratch->zdatasize);
+    v.size = 0;
+    error = lodepng_deflatev(&v, in, insize, settings);
+    settings->scratch->zdata = v.data;
+    settings->scratch->zdatasize = v.allocsize;
+    deflatedata = v.data;
+    deflatesize = v.size;
+    if(!error) ADLER32 = adler32(in, (unsigned)insize);
+  } else {
+    error = deflate(&deflatedata, &deflatesize, in, insize, settings);
+    if(!error) ADLER32 = adler32(in, (unsigned)insize);
+  }
 
   *out = NULL;
   *outsize = 0;
@@ -2265,7 +3142,6 @@ unsigned lodepng_zlib_compress(unsigned char** out, size_t* outsize, const unsig
   }
 
   if(!error) {
-    unsigned ADLER32 = adler32(in, (unsigned)insize);
     /*zlib data: 1 byte CMF (CM+CINFO), 1 byte FLG, deflate data, 4 byte ADLER32 checksum of the Decompressed data*/
     unsigned CMF = 120; /*0b01111000: CM 8, CINFO 7. With CINFO 7, any window size up to 32768 can be used.*/
     unsigned FLEVEL = 0;
@@ -2280,10 +3156,95 @@ unsigned lodepng_zlib_compress(unsigned char** out, size_t* outsize, const unsig
     lodepng_set32bitInt(&(*out)[*outsize - 4], ADLER32);
   }
 
-  lodepng_free(deflatedata);
+  if(!settings->scratch || deflatedata != settings->scratch->zdata) lodepng_free(deflatedata);
   return error;
 }
 
+/*
+Deflates a zlib stream a piece at a time, for encoders that never hold all of its input. Added bytes are gathered
+after a window of the ones before them, and every full piece is deflated with deflateRange, matches reaching back
+into the window, and a sync flush so that the output so far is whole bytes that can be written out. With
+parallel_run, ZWRITER_BATCH pieces are gathered and deflated at the same time as in lodepng_zlib_compress. Each
+still sees the window before it, so the stream is the same as without, only the input held grows to the batch.
+custom_zlib and custom_deflate are not used.
+*/
+#define ZWRITER_HISTORY 32768u
+#define ZWRITER_PIECE 262144u /*the largest deflateBlockSize, pieces are deflated as single blocks*/
+#define ZWRITER_BATCH 16u
+
+typedef struct ZWriter {
+  ucvector in; /*the window, then the bytes not deflated yet*/
+  size_t start; /*where the bytes not deflated yet start*/
+  size_t pending; /*how many bytes are deflated at once: a piece, or a batch of them with parallel_run*/
+  ucvector out; /*zlib data the caller hasn't taken yet*/
+  unsigned adler;
+  const LodePNGCompressSettings* settings;
+} ZWriter;
+
+static unsigned zwriter_init(ZWriter* z, const LodePNGCompressSettings* settings) {
+  z->in = ucvector_init(NULL, 0);
+  z->out = ucvector_init(NULL, 0);
+  z->start = 0;
+  z->adler = 1u;
+  z->settings = settings;
+  z->pending = ZWRITER_PIECE;
+  if(settings->parallel_run && !settings->custom_deflate) z->pending *= ZWRITER_BATCH;
+  if(!ucvector_reserve(&z->in, ZWRITER_HISTORY + z->pending)) return 83; /*alloc fail*/
+  if(!ucvector_resize(&z->out, 2)) return 83; /*alloc fail*/
+  /*the same header as lodepng_zlib_compress: CM 8, CINFO 7, no FDICT, FLEVEL 0*/
+  z->out.data[0] = 120;
+  z->out.data[1] = 1;
+  return 0;
+}
+
+static void zwriter_cleanup(ZWriter* z) {
+  lodepng_free(z->in.data);
+  lodepng_free(z->out.data);
+}
+
+static unsigned zwriter_deflate(ZWriter* z, unsigned final) {
+  unsigned error;
+  size_t cut = z->in.size > ZWRITER_HISTORY ? z->in.size - ZWRITER_HISTORY : 0;
+  if(z->pending != ZWRITER_PIECE) {
+    error = deflatePieces(&z->out, &z->adler, z->in.data, z->start, z->in.size, ZWRITER_PIECE, final, z->settings);
+    if(error) return error;
+  } else {
+    error = deflateRange(&z->out, z->in.data, z->start, z->in.size, ZWRITER_PIECE, final, z->settings);
+    if(error) return error;
+    z->adler = update_adler32(z->adler, z->in.data + z->start, (unsigned)(z->in.size - z->start));
+  }
+  /*only the window stays*/
+  lodepng_memmove(z->in.data, z->in.data + cut, z->in.size - cut);
+  z->in.size -= cut;
+  z->start = z->in.size;
+  return 0;
+}
+
+static unsigned zwriter_add(ZWriter* z, const unsigned char* data, size_t size) {
+  while(size) {
+    size_t amount = z->pending - (z->in.size - z->start);
+    if(amount > size) amount = size;
+    if(!ucvector_resize(&z->in, z->in.size + amount)) return 83; /*alloc fail*/
+    lodepng_memcpy(z->in.data + z->in.size - amount, data, amount);
+    data += amount;
+    size -= amount;
+    if(z->in.size - z->start == z->pending) {
+      unsigned error = zwriter_deflate(z, 0);
+      if(error) return error;
+    }
+  }
+  return 0;
+}
+
+/*deflates what's left as the last block and ends the stream with the Adler32*/
+static unsigned zwriter_finish(ZWriter* z) {
+  unsigned error = zwriter_deflate(z, 1);
+  if(error) return error;
+  if(!ucvector_resize(&z->out, z->out.size + 4)) return 83; /*alloc fail*/
+  lodepng_set32bitInt(z->out.data + z->out.size - 4, z->adler);
+  return 0;
+}
+
 /* compress using the default or custom zlib function */
 static unsigned zlib_compress(unsigned char** out, size_t* outsize, const unsigned char* in,
                               size_t insize, const LodePNGCompressSettings* settings) {
@@ -2302,9 +3263,11 @@ static unsigned zlib_compress(unsigned char** out, size_t* outsize, const unsign
 
 #ifdef LODEPNG_COMPILE_DECODER
 static unsigned zlib_decompress(unsigned char** out, size_t* outsize, size_t expected_size,
-                                const unsigned char* in, size_t insize, const LodePNGDecompressSettings* settings) {
+                                const unsigned char* in, size_t insize, const LodePNGDecompressSettings* settings,
+                                LodePNGScratch* scratch) {
   if(!settings->custom_zlib) return 87; /*no custom zlib function provided */
   (void)expected_size;
+  (void)scratch;
   return settings->custom_zlib(out, outsize, in, insize, settings);
 }
 #endif /*LODEPNG_COMPILE_DECODER*/
@@ -2337,9 +3300,13 @@ void lodepng_compress_settings_init(LodePNGCompressSettings* settings) {
   settings->custom_zlib = 0;
   settings->custom_deflate = 0;
   settings->custom_context = 0;
+
+  settings->parallel_run = 0;
+  settings->parallel_context = 0;
+  settings->scratch = 0;
 }
 
-const LodePNGCompressSettings lodepng_default_compress_settings = {2, 1, DEFAULT_WINDOWSIZE, 3, 128, 1, 0, 0, 0};
+const LodePNGCompressSettings lodepng_default_compress_settings = {2, 1, DEFAULT_WINDOWSIZE, 3, 128, 1, 0, 0, 0, 0, 0, 0};
 
 
 #endif /*LODEPNG_COMPILE_ENCODER*/
@@ -2354,12 +3321,35 @@ void lodepng_decompress_settings_init(LodePNGDecompressSettings* settings) {
   settings->custom_zlib = 0;
   settings->custom_inflate = 0;
   settings->custom_context = 0;
+  settings->scratch = 0;
 }
 
-const LodePNGDecompressSettings lodepng_default_decompress_settings = {0, 0, 0, 0, 0, 0};
+const LodePNGDecompressSettings lodepng_default_decompress_settings = {0, 0, 0, 0, 0, 0, 0};
 
 #endif /*LODEPNG_COMPILE_DECODER*/
 
+#if defined(LODEPNG_COMPILE_DECODER) || defined(LODEPNG_COMPILE_ENCODER)
+
+void lodepng_scratch_init(LodePNGScratch* scratch) {
+  scratch->data = 0;
+  scratch->datasize = 0;
+  scratch->zdata = 0;
+  scratch->zdatasize = 0;
+  scratch->hash = 0;
+}
+
+void lodepng_scratch_cleanup(LodePNGScratch* scratch) {
+  lodepng_free(scratch->data);
+  lodepng_free(scratch->zdata);
+#if defined(LODEPNG_COMPILE_ZLIB) && defined(LODEPNG_COMPILE_ENCODER)
+  if(scratch->hash) hash_cleanup((Hash*)scratch->hash);
+#endif /*LODEPNG_COMPILE_ZLIB && LODEPNG_COMPILE_ENCODER*/
+  lodepng_free(scratch->hash);
+  lodepng_scratch_init(scratch);
+}
+
+#endif /*LODEPNG_COMPILE_DECODER || LODEPNG_COMPILE_ENCODER*/
+
 /* ////////////////////////////////////////////////////////////////////////// */
 /* ////////////////////////////////////////////////////////////////////////// */
 /* // End of Zlib related code. Begin of PNG related code.                 // */
@@ -2374,48 +3364,646 @@ const LodePNGDecompressSettings lodepng_default_decompress_settings = {0, 0, 0,
 
 
 #ifdef LODEPNG_COMPILE_CRC
-/* CRC polynomial: 0xedb88320 */
-static unsigned lodepng_crc32_table[256] = {
-           0u, 1996959894u, 3993919788u, 2567524794u,  124634137u, 1886057615u, 3915621685u, 2657392035u,
-   249268274u, 2044508324u, 3772115230u, 2547177864u,  162941995u, 2125561021u, 3887607047u, 2428444049u,
-   498536548u, 1789927666u, 4089016648u, 2227061214u,  450548861u, 1843258603u, 4107580753u, 2211677639u,
-   325883990u, 1684777152u, 4251122042u, 2321926636u,  335633487u, 1661365465u, 4195302755u, 2366115317u,
-   997073096u, 1281953886u, 3579855332u, 2724688242u, 1006888145u, 1258607687u, 3524101629u, 2768942443u,
-   901097722u, 1119000684u, 3686517206u, 2898065728u,  853044451u, 1172266101u, 3705015759u, 2882616665u,
-   651767980u, 1373503546u, 3369554304u, 3218104598u,  565507253u, 1454621731u, 3485111705u, 3099436303u,
-   671266974u, 1594198024u, 3322730930u, 2970347812u,  795835527u, 1483230225u, 3244367275u, 3060149565u,
-  1994146192u,   31158534u, 2563907772u, 4023717930u, 1907459465u,  112637215u, 2680153253u, 3904427059u,
-  2013776290u,  251722036u, 2517215374u, 3775830040u, 2137656763u,  141376813u, 2439277719u, 3865271297u,
-  1802195444u,  476864866u, 2238001368u, 4066508878u, 1812370925u,  453092731u, 2181625025u, 4111451223u,
-  1706088902u,  314042704u, 2344532202u, 4240017532u, 1658658271u,  366619977u, 2362670323u, 4224994405u,
-  1303535960u,  984961486u, 2747007092u, 3569037538u, 1256170817u, 1037604311u, 2765210733u, 3554079995u,
-  1131014506u,  879679996u, 2909243462u, 3663771856u, 1141124467u,  855842277u, 2852801631u, 3708648649u,
-  1342533948u,  654459306u, 3188396048u, 3373015174u, 1466479909u,  544179635u, 3110523913u, 3462522015u,
-  1591671054u,  702138776u, 2966460450u, 3352799412u, 1504918807u,  783551873u, 3082640443u, 3233442989u,
-  3988292384u, 2596254646u,   62317068u, 1957810842u, 3939845945u, 2647816111u,   81470997u, 1943803523u,
-  3814918930u, 2489596804u,  225274430u, 2053790376u, 3826175755u, 2466906013u,  167816743u, 2097651377u,
-  4027552580u, 2265490386u,  503444072u, 1762050814u, 4150417245u, 2154129355u,  426522225u, 1852507879u,
-  4275313526u, 2312317920u,  282753626u, 1742555852u, 4189708143u, 2394877945u,  397917763u, 1622183637u,
-  3604390888u, 2714866558u,  953729732u, 1340076626u, 3518719985u, 2797360999u, 1068828381u, 1219638859u,
-  3624741850u, 2936675148u,  906185462u, 1090812512u, 3747672003u, 2825379669u,  829329135u, 1181335161u,
-  3412177804u, 3160834842u,  628085408u, 1382605366u, 3423369109u, 3138078467u,  570562233u, 1426400815u,
-  3317316542u, 2998733608u,  733239954u, 1555261956u, 3268935591u, 3050360625u,  752459403u, 1541320221u,
-  2607071920u, 3965973030u, 1969922972u,   40735498u, 2617837225u, 3943577151u, 1913087877u,   83908371u,
-  2512341634u, 3803740692u, 2075208622u,  213261112u, 2463272603u, 3855990285u, 2094854071u,  198958881u,
-  2262029012u, 4057260610u, 1759359992u,  534414190u, 2176718541u, 4139329115u, 1873836001u,  414664567u,
-  2282248934u, 4279200368u, 1711684554u,  285281116u, 2405801727u, 4167216745u, 1634467795u,  376229701u,
-  2685067896u, 3608007406u, 1308918612u,  956543938u, 2808555105u, 3495958263u, 1231636301u, 1047427035u,
-  2932959818u, 3654703836u, 1088359270u,  936918000u, 2847714899u, 3736837829u, 1202900863u,  817233897u,
-  3183342108u, 3401237130u, 1404277552u,  615818150u, 3134207493u, 3453421203u, 1423857449u,  601450431u,
-  3009837614u, 3294710456u, 1567103746u,  711928724u, 3020668471u, 3272380065u, 1510334235u,  755167117u
+/* CRC polynomial: 0xedb88320. Row 0 is the usual byte-at-a-time table, row k gives the CRC of a byte followed by k
+zero bytes, so that 16 bytes can be looked up independently and combined ("slicing-by-16") */
+static const unsigned lodepng_crc32_table[16][256] = {
+  {
+             0u, 1996959894u, 3993919788u, 2567524794u,  124634137u, 1886057615u, 3915621685u, 2657392035u,
+     249268274u, 2044508324u, 3772115230u, 2547177864u,  162941995u, 2125561021u, 3887607047u, 2428444049u,
+     498536548u, 1789927666u, 4089016648u, 2227061214u,  450548861u, 1843258603u, 4107580753u, 2211677639u,
+     325883990u, 1684777152u, 4251122042u, 2321926636u,  335633487u, 1661365465u, 4195302755u, 2366115317u,
+     997073096u, 1281953886u, 3579855332u, 2724688242u, 1006888145u, 1258607687u, 3524101629u, 2768942443u,
+     901097722u, 1119000684u, 3686517206u, 2898065728u,  853044451u, 1172266101u, 3705015759u, 2882616665u,
+     651767980u, 1373503546u, 3369554304u, 3218104598u,  565507253u, 1454621731u, 3485111705u, 3099436303u,
+     671266974u, 1594198024u, 3322730930u, 2970347812u,  795835527u, 1483230225u, 3244367275u, 3060149565u,
+    1994146192u,   31158534u, 2563907772u, 4023717930u, 1907459465u,  112637215u, 2680153253u, 3904427059u,
+    2013776290u,  251722036u, 2517215374u, 3775830040u, 2137656763u,  141376813u, 2439277719u, 3865271297u,
+    1802195444u,  476864866u, 2238001368u, 4066508878u, 1812370925u,  453092731u, 2181625025u, 4111451223u,
+    1706088902u,  314042704u, 2344532202u, 4240017532u, 1658658271u,  366619977u, 2362670323u, 4224994405u,
+    1303535960u,  984961486u, 2747007092u, 3569037538u, 1256170817u, 1037604311u, 2765210733u, 3554079995u,
+    1131014506u,  879679996u, 2909243462u, 3663771856u, 1141124467u,  855842277u, 2852801631u, 3708648649u,
+    1342533948u,  654459306u, 3188396048u, 3373015174u, 1466479909u,  544179635u, 3110523913u, 3462522015u,
+    1591671054u,  702138776u, 2966460450u, 3352799412u, 1504918807u,  783551873u, 3082640443u, 3233442989u,
+    3988292384u, 2596254646u,   62317068u, 1957810842u, 3939845945u, 2647816111u,   81470997u, 1943803523u,
+    3814918930u, 2489596804u,  225274430u, 2053790376u, 3826175755u, 2466906013u,  167816743u, 2097651377u,
+    4027552580u, 2265490386u,  503444072u, 1762050814u, 4150417245u, 2154129355u,  426522225u, 1852507879u,
+    4275313526u, 2312317920u,  282753626u, 1742555852u, 4189708143u, 2394877945u,  397917763u, 1622183637u,
+    3604390888u, 2714866558u,  953729732u, 1340076626u, 3518719985u, 2797360999u, 1068828381u, 1219638859u,
+    3624741850u, 2936675148u,  906185462u, 1090812512u, 3747672003u, 2825379669u,  829329135u, 1181335161u,
+    3412177804u, 3160834842u,  628085408u, 1382605366u, 3423369109u, 3138078467u,  570562233u, 1426400815u,
+    3317316542u, 2998733608u,  733239954u, 1555261956u, 3268935591u, 3050360625u,  752459403u, 1541320221u,
+    2607071920u, 3965973030u, 1969922972u,   40735498u, 2617837225u, 3943577151u, 1913087877u,   83908371u,
+    2512341634u, 3803740692u, 2075208622u,  213261112u, 2463272603u, 3855990285u, 2094854071u,  198958881u,
+    2262029012u, 4057260610u, 1759359992u,  534414190u, 2176718541u, 4139329115u, 1873836001u,  414664567u,
+    2282248934u, 4279200368u, 1711684554u,  285281116u, 2405801727u, 4167216745u, 1634467795u,  376229701u,
+    2685067896u, 3608007406u, 1308918612u,  956543938u, 2808555105u, 3495958263u, 1231636301u, 1047427035u,
+    2932959818u, 3654703836u, 1088359270u,  936918000u, 2847714899u, 3736837829u, 1202900863u,  817233897u,
+    3183342108u, 3401237130u, 1404277552u,  615818150u, 3134207493u, 3453421203u, 1423857449u,  601450431u,
+    3009837614u, 3294710456u, 1567103746u,  711928724u, 3020668471u, 3272380065u, 1510334235u,  755167117u
+  },
+  {
+             0u,  421212481u,  842424962u,  724390851u, 1684849924u, 2105013317u, 1448781702u, 1329698503u,
+    3369699848u, 3519200073u, 4210026634u, 3824474571u, 2897563404u, 3048111693u, 2659397006u, 2274893007u,
+    1254232657u, 1406739216u, 2029285587u, 1643069842u,  783210325u,  934667796u,  479770071u,   92505238u,
+    2182846553u, 2600511768u, 2955803355u, 2838940570u, 3866582365u, 4285295644u, 3561045983u, 3445231262u,
+    2508465314u, 2359236067u, 2813478432u, 3198777185u, 4058571174u, 3908292839u, 3286139684u, 3670389349u,
+    1566420650u, 1145479147u, 1869335592u, 1987116393u,  959540142u,  539646703u,  185010476u,  303839341u,
+    3745920755u, 3327985586u, 3983561841u, 4100678960u, 3140154359u, 2721170102u, 2300350837u, 2416418868u,
+     396344571u,  243568058u,  631889529u, 1018359608u, 1945336319u, 1793607870u, 1103436669u, 1490954812u,
+    4034481925u, 3915546180u, 3259968903u, 3679722694u, 2484439553u, 2366552896u, 2787371139u, 3208174018u,
+     950060301u,  565965900u,  177645455u,  328046286u, 1556873225u, 1171730760u, 1861902987u, 2011255754u,
+    3132841300u, 2745199637u, 2290958294u, 2442530455u, 3738671184u, 3352078609u, 3974232786u, 4126854035u,
+    1919080284u, 1803150877u, 1079293406u, 1498383519u,  370020952u,  253043481u,  607678682u, 1025720731u,
+    1711106983u, 2095471334u, 1472923941u, 1322268772u,   26324643u,  411738082u,  866634785u,  717028704u,
+    2904875439u, 3024081134u, 2668790573u, 2248782444u, 3376948395u, 3495106026u, 4219356713u, 3798300520u,
+     792689142u,  908347575u,  487136116u,   68299317u, 1263779058u, 1380486579u, 2036719216u, 1618931505u,
+    3890672638u, 4278043327u, 3587215740u, 3435896893u, 2206873338u, 2593195963u, 2981909624u, 2829542713u,
+     998479947u,  580430090u,  162921161u,  279890824u, 1609522511u, 1190423566u, 1842954189u, 1958874764u,
+    4082766403u, 3930137346u, 3245109441u, 3631694208u, 2536953671u, 2385372678u, 2768287173u, 3155920004u,
+    1900120602u, 1750776667u, 1131931800u, 1517083097u,  355290910u,  204897887u,  656092572u, 1040194781u,
+    3113746450u, 2692952403u, 2343461520u, 2461357009u, 3723805974u, 3304059991u, 4022511508u, 4141455061u,
+    2919742697u, 3072101800u, 2620513899u, 2234183466u, 3396041197u, 3547351212u, 4166851439u, 3779471918u,
+    1725839073u, 2143618976u, 1424512099u, 1307796770u,   45282277u,  464110244u,  813994343u,  698327078u,
+    3838160568u, 4259225593u, 3606301754u, 3488152955u, 2158586812u, 2578602749u, 2996767038u, 2877569151u,
+     740041904u,  889656817u,  506086962u,  120682355u, 1215357364u, 1366020341u, 2051441462u, 1667084919u,
+    3422213966u, 3538019855u, 4190942668u, 3772220557u, 2945847882u, 3062702859u, 2644537544u, 2226864521u,
+      52649286u,  439905287u,  823476164u,  672009861u, 1733269570u, 2119477507u, 1434057408u, 1281543041u,
+    2167981343u, 2552493150u, 3004082077u, 2853541596u, 3847487515u, 4233048410u, 3613549209u, 3464057816u,
+    1239502615u, 1358593622u, 2077699477u, 1657543892u,  764250643u,  882293586u,  532408465u,  111204816u,
+    1585378284u, 1197851309u, 1816695150u, 1968414767u,  974272232u,  587794345u,  136598634u,  289367339u,
+    2527558116u, 2411481253u, 2760973158u, 3179948583u, 4073438432u, 3956313505u, 3237863010u, 3655790371u,
+     347922877u,  229101820u,  646611775u, 1066513022u, 1892689081u, 1774917112u, 1122387515u, 1543337850u,
+    3697634229u, 3313392372u, 3998419255u, 4148705398u, 3087642289u, 2702352368u, 2319436851u, 2468674930u
+  },
+  {
+             0u,   29518391u,   59036782u,   38190681u,  118073564u,  114017003u,   76381362u,   89069189u,
+     236147128u,  265370511u,  228034006u,  206958561u,  152762724u,  148411219u,  178138378u,  190596925u,
+     472294256u,  501532999u,  530741022u,  509615401u,  456068012u,  451764635u,  413917122u,  426358261u,
+     305525448u,  334993663u,  296822438u,  275991697u,  356276756u,  352202787u,  381193850u,  393929805u,
+     944588512u,  965684439u, 1003065998u,  973863097u, 1061482044u, 1049003019u, 1019230802u, 1023561829u,
+     912136024u,  933002607u,  903529270u,  874031361u,  827834244u,  815125939u,  852716522u,  856752605u,
+     611050896u,  631869351u,  669987326u,  640506825u,  593644876u,  580921211u,  551983394u,  556069653u,
+     712553512u,  733666847u,  704405574u,  675154545u,  762387700u,  749958851u,  787859610u,  792175277u,
+    1889177024u, 1901651959u, 1931368878u, 1927033753u, 2006131996u, 1985040171u, 1947726194u, 1976933189u,
+    2122964088u, 2135668303u, 2098006038u, 2093965857u, 2038461604u, 2017599123u, 2047123658u, 2076625661u,
+    1824272048u, 1836991623u, 1866005214u, 1861914857u, 1807058540u, 1786244187u, 1748062722u, 1777547317u,
+    1655668488u, 1668093247u, 1630251878u, 1625932113u, 1705433044u, 1684323811u, 1713505210u, 1742760333u,
+    1222101792u, 1226154263u, 1263738702u, 1251046777u, 1339974652u, 1310460363u, 1281013650u, 1301863845u,
+    1187289752u, 1191637167u, 1161842422u, 1149379777u, 1103966788u, 1074747507u, 1112139306u, 1133218845u,
+    1425107024u, 1429406311u, 1467333694u, 1454888457u, 1408811148u, 1379576507u, 1350309090u, 1371438805u,
+    1524775400u, 1528845279u, 1499917702u, 1487177649u, 1575719220u, 1546255107u, 1584350554u, 1605185389u,
+    3778354048u, 3774312887u, 3803303918u, 3816007129u, 3862737756u, 3892238699u, 3854067506u, 3833203973u,
+    4012263992u, 4007927823u, 3970080342u, 3982554209u, 3895452388u, 3924658387u, 3953866378u, 3932773565u,
+    4245928176u, 4241609415u, 4271336606u, 4283762345u, 4196012076u, 4225268251u, 4187931714u, 4166823541u,
+    4076923208u, 4072833919u, 4035198246u, 4047918865u, 4094247316u, 4123732899u, 4153251322u, 4132437965u,
+    3648544096u, 3636082519u, 3673983246u, 3678331705u, 3732010428u, 3753090955u, 3723829714u, 3694611429u,
+    3614117080u, 3601426159u, 3572488374u, 3576541825u, 3496125444u, 3516976691u, 3555094634u, 3525581405u,
+    3311336976u, 3298595879u, 3336186494u, 3340255305u, 3260503756u, 3281337595u, 3251864226u, 3222399125u,
+    3410866088u, 3398419871u, 3368647622u, 3372945905u, 3427010420u, 3448139075u, 3485520666u, 3456284973u,
+    2444203584u, 2423127159u, 2452308526u, 2481530905u, 2527477404u, 2539934891u, 2502093554u, 2497740997u,
+    2679949304u, 2659102159u, 2620920726u, 2650438049u, 2562027300u, 2574714131u, 2603727690u, 2599670141u,
+    2374579504u, 2353749767u, 2383274334u, 2412743529u, 2323684844u, 2336421851u, 2298759554u, 2294686645u,
+    2207933576u, 2186809023u, 2149495014u, 2178734801u, 2224278612u, 2236720739u, 2266437690u, 2262135309u,
+    2850214048u, 2820717207u, 2858812622u, 2879680249u, 2934667388u, 2938704459u, 2909776914u, 2897069605u,
+    2817622296u, 2788420399u, 2759153014u, 2780249921u, 2700618180u, 2704950259u, 2742877610u, 2730399645u,
+    3049550800u, 3020298727u, 3057690558u, 3078802825u, 2999835404u, 3004150075u, 2974355298u, 2961925461u,
+    3151438440u, 3121956959u, 3092510214u, 3113327665u, 3168701108u, 3172786307u, 3210370778u, 3197646061u
+  },
+  {
+             0u, 3099354981u, 2852767883u,  313896942u, 2405603159u,  937357362u,  627793884u, 2648127673u,
+    3316918511u, 2097696650u, 1874714724u, 3607201537u, 1255587768u, 4067088605u, 3772741427u, 1482887254u,
+    1343838111u, 3903140090u, 4195393300u, 1118632049u, 3749429448u, 1741137837u, 1970407491u, 3452858150u,
+    2511175536u,  756094997u, 1067759611u, 2266550430u,  449832999u, 2725482306u, 2965774508u,  142231497u,
+    2687676222u,  412010587u,  171665333u, 2995192016u,  793786473u, 2548850444u, 2237264098u, 1038456711u,
+    1703315409u, 3711623348u, 3482275674u, 1999841343u, 3940814982u, 1381529571u, 1089329165u, 4166106984u,
+    4029413537u, 1217896388u, 1512189994u, 3802027855u, 2135519222u, 3354724499u, 3577784189u, 1845280792u,
+     899665998u, 2367928107u, 2677414085u,  657096608u, 3137160985u,   37822588u,  284462994u, 2823350519u,
+    2601801789u,  598228824u,  824021174u, 2309093331u,  343330666u, 2898962447u, 3195996129u,  113467524u,
+    1587572946u, 3860600759u, 4104763481u, 1276501820u, 3519211397u, 1769898208u, 2076913422u, 3279374443u,
+    3406630818u, 1941006535u, 1627703081u, 3652755532u, 1148164341u, 4241751952u, 3999682686u, 1457141531u,
+     247015245u, 3053797416u, 2763059142u,  470583459u, 2178658330u,  963106687u,  735213713u, 2473467892u,
+     992409347u, 2207944806u, 2435792776u,  697522413u, 3024379988u,  217581361u,  508405983u, 2800865210u,
+    4271038444u, 1177467017u, 1419450215u, 3962007554u, 1911572667u, 3377213406u, 3690561584u, 1665525589u,
+    1799331996u, 3548628985u, 3241568279u, 2039091058u, 3831314379u, 1558270126u, 1314193216u, 4142438437u,
+    2928380019u,  372764438u,   75645176u, 3158189981u,  568925988u, 2572515393u, 2346768303u,  861712586u,
+    3982079547u, 1441124702u, 1196457648u, 4293663189u, 1648042348u, 3666298377u, 3358779879u, 1888390786u,
+     686661332u, 2421291441u, 2196002399u,  978858298u, 2811169155u,  523464422u,  226935048u, 3040519789u,
+    3175145892u,  100435649u,  390670639u, 2952089162u,  841119475u, 2325614998u, 2553003640u,  546822429u,
+    2029308235u, 3225988654u, 3539796416u, 1782671013u, 4153826844u, 1328167289u, 1570739863u, 3844338162u,
+    1298864389u, 4124540512u, 3882013070u, 1608431339u, 3255406162u, 2058742071u, 1744848601u, 3501990332u,
+    2296328682u,  811816591u,  584513889u, 2590678532u,  129869501u, 3204563416u, 2914283062u,  352848211u,
+     494030490u, 2781751807u, 3078325777u,  264757620u, 2450577869u,  715964072u,  941166918u, 2158327331u,
+    3636881013u, 1618608400u, 1926213374u, 3396585883u, 1470427426u, 4011365959u, 4255988137u, 1158766284u,
+    1984818694u, 3471935843u, 3695453837u, 1693991400u, 4180638033u, 1100160564u, 1395044826u, 3952793279u,
+    3019491049u,  189112716u,  435162722u, 2706139399u, 1016811966u, 2217162459u, 2526189877u,  774831696u,
+     643086745u, 2666061564u, 2354934034u,  887166583u, 2838900430u,  294275499u,   54519365u, 3145957664u,
+    3823145334u, 1532818963u, 1240029693u, 4048895640u, 1820460577u, 3560857924u, 3331051178u, 2117577167u,
+    3598663992u, 1858283101u, 2088143283u, 3301633750u, 1495127663u, 3785470218u, 4078182116u, 1269332353u,
+     332098007u, 2876706482u, 3116540252u,   25085497u, 2628386432u,  605395429u,  916469259u, 2384220526u,
+    2254837415u, 1054503362u,  745528876u, 2496903497u,  151290352u, 2981684885u, 2735556987u,  464596510u,
+    1137851976u, 4218313005u, 3923506883u, 1365741990u, 3434129695u, 1946996346u, 1723425172u, 3724871409u
+  },
+  {
+             0u, 1029712304u, 2059424608u, 1201699536u, 4118849216u, 3370159984u, 2403399072u, 2988497936u,
+     812665793u,  219177585u, 1253054625u, 2010132753u, 3320900865u, 4170237105u, 3207642721u, 2186319825u,
+    1625331586u, 1568718386u,  438355170u,  658566482u, 2506109250u, 2818578674u, 4020265506u, 3535817618u,
+    1351670851u, 1844508147u,  709922595u,  389064339u, 2769320579u, 2557498163u, 3754961379u, 3803185235u,
+    3250663172u, 4238411444u, 3137436772u, 2254525908u,  876710340u,  153198708u, 1317132964u, 1944187668u,
+    4054934725u, 3436268917u, 2339452837u, 3054575125u,   70369797u,  961670069u, 2129760613u, 1133623509u,
+    2703341702u, 2621542710u, 3689016294u, 3867263574u, 1419845190u, 1774270454u,  778128678u,  318858390u,
+    2438067015u, 2888948471u, 3952189479u, 3606153623u, 1691440519u, 1504803895u,  504432359u,  594620247u,
+    1492342857u, 1704161785u,  573770537u,  525542041u, 2910060169u, 2417219385u, 3618876905u, 3939730521u,
+    1753420680u, 1440954936u,  306397416u,  790849880u, 2634265928u, 2690882808u, 3888375336u, 3668168600u,
+     940822475u,   91481723u, 1121164459u, 2142483739u, 3448989963u, 4042473659u, 3075684971u, 2318603227u,
+     140739594u,  889433530u, 1923340138u, 1338244826u, 4259521226u, 3229813626u, 2267247018u, 3124975642u,
+    2570221389u, 2756861693u, 3824297005u, 3734113693u, 1823658381u, 1372780605u,  376603373u,  722643805u,
+    2839690380u, 2485261628u, 3548540908u, 4007806556u, 1556257356u, 1638052860u,  637716780u,  459464860u,
+    4191346895u, 3300051327u, 2199040943u, 3195181599u,  206718479u,  825388991u, 1989285231u, 1274166495u,
+    3382881038u, 4106388158u, 3009607790u, 2382549470u, 1008864718u,   21111934u, 1189240494u, 2072147742u,
+    2984685714u, 2357631266u, 3408323570u, 4131834434u, 1147541074u, 2030452706u, 1051084082u,   63335554u,
+    2174155603u, 3170292451u, 4216760371u, 3325460867u, 1947622803u, 1232499747u,  248909555u,  867575619u,
+    3506841360u, 3966111392u, 2881909872u, 2527485376u,  612794832u,  434546784u, 1581699760u, 1663499008u,
+    3782634705u, 3692447073u, 2612412337u, 2799048193u,  351717905u,  697754529u, 1849071985u, 1398190273u,
+    1881644950u, 1296545318u,  182963446u,  931652934u, 2242328918u, 3100053734u, 4284967478u, 3255255942u,
+    1079497815u, 2100821479u,  983009079u,  133672583u, 3050795671u, 2293717799u, 3474399735u, 4067887175u,
+     281479188u,  765927844u, 1778867060u, 1466397380u, 3846680276u, 3626469220u, 2676489652u, 2733102084u,
+     548881365u,  500656741u, 1517752501u, 1729575173u, 3577210133u, 3898068133u, 2952246901u, 2459410373u,
+    3910527195u, 3564487019u, 2480257979u, 2931134987u,  479546907u,  569730987u, 1716854139u, 1530213579u,
+    3647316762u, 3825568426u, 2745561210u, 2663766474u,  753206746u,  293940330u, 1445287610u, 1799716618u,
+    2314567513u, 3029685993u, 4080348217u, 3461678473u, 2088098201u, 1091956777u,  112560889u, 1003856713u,
+    3112514712u, 2229607720u, 3276105720u, 4263857736u, 1275433560u, 1902492648u,  918929720u,  195422344u,
+     685033439u,  364179055u, 1377080511u, 1869921551u, 3713294623u, 3761522863u, 2811507327u, 2599689167u,
+     413436958u,  633644462u, 1650777982u, 1594160846u, 3978570462u, 3494118254u, 2548332990u, 2860797966u,
+    1211387997u, 1968470509u,  854852413u,  261368461u, 3182753437u, 2161434413u, 3346310653u, 4195650637u,
+    2017729436u, 1160000044u,   42223868u, 1071931724u, 2378480988u, 2963576044u, 4144295484u, 3395602316u
+  },
+  {
+             0u, 3411858341u, 1304994059u, 2257875630u, 2609988118u, 1355649459u, 3596215069u,  486879416u,
+    3964895853u,  655315400u, 2711298918u, 1791488195u, 2009251963u, 3164476382u,  973758832u, 4048990933u,
+      64357019u, 3364540734u, 1310630800u, 2235723829u, 2554806413u, 1394316072u, 3582976390u,  517157411u,
+    4018503926u,  618222419u, 2722963965u, 1762783832u, 1947517664u, 3209171269u,  970744811u, 4068520014u,
+     128714038u, 3438335635u, 1248109629u, 2167961496u, 2621261600u, 1466012805u, 3522553387u,  447296910u,
+    3959392091u,  547575038u, 2788632144u, 1835791861u, 1886307661u, 3140622056u, 1034314822u, 4143626211u,
+      75106221u, 3475428360u, 1236444838u, 2196665603u, 2682996155u, 1421317662u, 3525567664u,  427767573u,
+    3895035328u,  594892389u, 2782995659u, 1857943406u, 1941489622u, 3101955187u, 1047553757u, 4113347960u,
+     257428076u, 3288652233u, 1116777319u, 2311878850u, 2496219258u, 1603640287u, 3640781169u,  308099796u,
+    3809183745u,  676813732u, 2932025610u, 1704983215u, 2023410199u, 3016104370u,  894593820u, 4262377657u,
+     210634999u, 3352484690u, 1095150076u, 2316991065u, 2535410401u, 1547934020u, 3671583722u,  294336591u,
+    3772615322u,  729897279u, 2903845777u, 1716123700u, 2068629644u, 2953845545u,  914647431u, 4258839074u,
+     150212442u, 3282623743u, 1161604689u, 2388688372u, 2472889676u, 1480171241u, 3735940167u,  368132066u,
+    3836185911u,  805002898u, 2842635324u, 1647574937u, 2134298401u, 3026852996u,  855535146u, 4188192143u,
+     186781121u, 3229539940u, 1189784778u, 2377547631u, 2427670487u, 1542429810u, 3715886812u,  371670393u,
+    3882979244u,  741170185u, 2864262823u, 1642462466u, 2095107514u, 3082559007u,  824732849u, 4201955092u,
+     514856152u, 3589064573u, 1400419795u, 2552522358u, 2233554638u, 1316849003u, 3370776517u,   62202976u,
+    4075001525u,  968836368u, 3207280574u, 1954014235u, 1769133219u, 2720925446u,  616199592u, 4024870413u,
+     493229635u, 3594175974u, 1353627464u, 2616354029u, 2264355925u, 1303087088u, 3409966430u,    6498043u,
+    4046820398u,  979978123u, 3170710821u, 2007099008u, 1789187640u, 2717386141u,  661419827u, 3962610838u,
+     421269998u, 3527459403u, 1423225061u, 2676515648u, 2190300152u, 1238466653u, 3477467891u,   68755798u,
+    4115633027u, 1041448998u, 3095868040u, 1943789869u, 1860096405u, 2776760880u,  588673182u, 3897205563u,
+     449450869u, 3516317904u, 1459794558u, 2623431131u, 2170245475u, 1242006214u, 3432247400u,  131015629u,
+    4137259288u, 1036337853u, 3142660115u, 1879958454u, 1829294862u, 2790523051u,  549483013u, 3952910752u,
+     300424884u, 3669282065u, 1545650111u, 2541513754u, 2323209378u, 1092980487u, 3350330793u,  216870412u,
+    4256931033u,  921128828u, 2960342482u, 2066738807u, 1714085583u, 2910195050u,  736264132u, 3770592353u,
+     306060335u, 3647131530u, 1610005796u, 2494197377u, 2309971513u, 1123257756u, 3295149874u,  255536279u,
+    4268596802u,  892423655u, 3013951305u, 2029645036u, 1711070292u, 2929725425u,  674528607u, 3815288570u,
+     373562242u, 3709388839u, 1535949449u, 2429577516u, 2379569556u, 1183418929u, 3223189663u,  188820282u,
+    4195850735u,  827017802u, 3084859620u, 2089020225u, 1636228089u, 2866415708u,  743340786u, 3876759895u,
+     361896217u, 3738094268u, 1482340370u, 2466671543u, 2382584591u, 1163888810u, 3284924932u,  144124321u,
+    4190215028u,  849168593u, 3020503679u, 2136336858u, 1649465698u, 2836138695u,  798521449u, 3838094284u
+  },
+  {
+             0u, 2792819636u, 2543784233u,  837294749u, 4098827283u, 1379413927u, 1674589498u, 3316072078u,
+     871321191u, 2509784531u, 2758827854u,   34034938u, 3349178996u, 1641505216u, 1346337629u, 4131942633u,
+    1742642382u, 3249117050u, 4030828007u, 1446413907u, 2475800797u,  904311657u,   68069876u, 2725880384u,
+    1412551337u, 4064729373u, 3283010432u, 1708771380u, 2692675258u,  101317902u,  937551763u, 2442587175u,
+    3485284764u, 1774858792u, 1478633653u, 4266992385u, 1005723023u, 2642744891u, 2892827814u,  169477906u,
+    4233263099u, 1512406095u, 1808623314u, 3451546982u,  136139752u, 2926205020u, 2676114113u,  972376437u,
+    2825102674u,  236236518u, 1073525883u, 2576072655u, 1546420545u, 4200303349u, 3417542760u, 1841601500u,
+    2609703733u, 1039917185u,  202635804u, 2858742184u, 1875103526u, 3384067218u, 4166835727u, 1579931067u,
+    1141601657u, 3799809741u, 3549717584u, 1977839588u, 2957267306u,  372464350u,  668680259u, 2175552503u,
+    2011446046u, 3516084394u, 3766168119u, 1175200131u, 2209029901u,  635180217u,  338955812u, 2990736784u,
+     601221559u, 2242044419u, 3024812190u,  306049834u, 3617246628u, 1911408144u, 1074125965u, 3866285881u,
+     272279504u, 3058543716u, 2275784441u,  567459149u, 3832906691u, 1107462263u, 1944752874u, 3583875422u,
+    2343980261u,  767641425u,  472473036u, 3126744696u, 2147051766u, 3649987394u, 3899029983u, 1309766251u,
+    3092841090u,  506333494u,  801510315u, 2310084639u, 1276520081u, 3932237093u, 3683203000u, 2113813516u,
+    3966292011u, 1243601823u, 2079834370u, 3716205238u,  405271608u, 3192979340u, 2411259153u,  701492901u,
+    3750207052u, 2045810168u, 1209569125u, 4000285905u,  734575199u, 2378150379u, 3159862134u,  438345922u,
+    2283203314u,  778166598u,  529136603u, 3120492655u, 2086260449u, 3660498261u, 3955679176u, 1303499900u,
+    3153699989u,  495890209u,  744928700u, 2316418568u, 1337360518u, 3921775410u, 3626602927u, 2120129051u,
+    4022892092u, 1237286280u, 2018993941u, 3726666913u,  461853231u, 3186645403u, 2350400262u,  711936178u,
+    3693557851u, 2052076527u, 1270360434u, 3989775046u,  677911624u, 2384402428u, 3220639073u,  427820757u,
+    1202443118u, 3789347034u, 3493118535u, 1984154099u, 3018127229u,  362020041u,  612099668u, 2181885408u,
+    1950653705u, 3526596285u, 3822816288u, 1168934804u, 2148251930u,  645706414u,  395618355u, 2984485767u,
+     544559008u, 2248295444u, 3085590153u,  295523645u, 3560598451u, 1917673479u, 1134918298u, 3855773998u,
+     328860103u, 3052210803u, 2214924526u,  577903450u, 3889505748u, 1101147744u, 1883911421u, 3594338121u,
+    3424493451u, 1785369663u, 1535282850u, 4260726038u,  944946072u, 2653270060u, 2949491377u,  163225861u,
+    4294103532u, 1501944408u, 1752023237u, 3457862513u,  196998655u, 2915761739u, 2619532502u,  978710370u,
+    2881684293u,  229902577u, 1012666988u, 2586515928u, 1603020630u, 4193987810u, 3356702335u, 1852063179u,
+    2553040162u, 1046169238u,  263412747u, 2848217023u, 1818454321u, 3390333573u, 4227627032u, 1569420204u,
+      60859927u, 2782375331u, 2487203646u,  843627658u, 4159668740u, 1368951216u, 1617990445u, 3322386585u,
+     810543216u, 2520310724u, 2815490393u,   27783917u, 3288386659u, 1652017111u, 1402985802u, 4125677310u,
+    1685994201u, 3255382381u, 4091620336u, 1435902020u, 2419138250u,  910562686u,  128847843u, 2715354199u,
+    1469150398u, 4058414858u, 3222168983u, 1719234083u, 2749255853u,   94984985u,  876691844u, 2453031472u
+  },
+  {
+             0u, 3433693342u, 1109723005u, 2391738339u, 2219446010u, 1222643300u, 3329165703u,  180685081u,
+    3555007413u,  525277995u, 2445286600u, 1567235158u, 1471092047u, 2600801745u,  361370162u, 3642757804u,
+    2092642603u, 2953916853u, 1050555990u, 4063508168u, 4176560081u,  878395215u, 3134470316u, 1987983410u,
+    2942184094u, 1676945920u, 3984272867u,  567356797u,  722740324u, 3887998202u, 1764827929u, 2778407815u,
+    4185285206u,  903635656u, 3142804779u, 2012833205u, 2101111980u, 2979425330u, 1058630609u, 4088621903u,
+     714308067u, 3862526333u, 1756790430u, 2753330688u, 2933487385u, 1651734407u, 3975966820u,  542535930u,
+    2244825981u, 1231508451u, 3353891840u,  188896414u,   25648519u, 3442302233u, 1134713594u, 2399689316u,
+    1445480648u, 2592229462u,  336416693u, 3634843435u, 3529655858u,  516441772u, 2420588879u, 1559052753u,
+     698204909u, 3845636723u, 1807271312u, 2803025166u, 2916600855u, 1635634313u, 4025666410u,  593021940u,
+    4202223960u,  919787974u, 3093159461u, 1962401467u, 2117261218u, 2996361020u, 1008193759u, 4038971457u,
+    1428616134u, 2576151384u,  386135227u, 3685348389u, 3513580860u,  499580322u, 2471098945u, 1608776415u,
+    2260985971u, 1248454893u, 3303468814u,  139259792u,   42591881u, 3458459159u, 1085071860u, 2349261162u,
+    3505103035u,  474062885u, 2463016902u, 1583654744u, 1419882049u, 2550902495u,  377792828u, 3660491170u,
+      51297038u, 3483679632u, 1093385331u, 2374089965u, 2269427188u, 1273935210u, 3311514249u,  164344343u,
+    2890961296u, 1627033870u, 4000683757u,  585078387u,  672833386u, 3836780532u, 1782552599u, 2794821769u,
+    2142603813u, 3005188795u, 1032883544u, 4047146438u, 4227826911u,  928351297u, 3118105506u, 1970307900u,
+    1396409818u, 2677114180u,  287212199u, 3719594553u, 3614542624u,  467372990u, 2505346141u, 1509854403u,
+    2162073199u, 1282711281u, 3271268626u,  240228748u,   76845205u, 3359543307u, 1186043880u, 2317064054u,
+     796964081u, 3811226735u, 1839575948u, 2702160658u, 2882189835u, 1734392469u, 3924802934u,  625327592u,
+    4234522436u,  818917338u, 3191908409u, 1927981223u, 2016387518u, 3028656416u,  973776579u, 4137723485u,
+    2857232268u, 1726474002u, 3899187441u,  616751215u,  772270454u, 3803048424u, 1814228491u, 2693328533u,
+    2041117753u, 3036871847u,  999160644u, 4146592730u, 4259508931u,  826864221u, 3217552830u, 1936586016u,
+    3606501031u,  442291769u, 2496909786u, 1484378436u, 1388107869u, 2652297411u,  278519584u, 3694387134u,
+      85183762u, 3384397196u, 1194773103u, 2342308593u, 2170143720u, 1307820918u, 3279733909u,  265733131u,
+    2057717559u, 3054258089u,  948125770u, 4096344276u, 4276898253u,  843467091u, 3167309488u, 1885556270u,
+    2839764098u, 1709792284u, 3949353983u,  667704161u,  755585656u, 3785577190u, 1865176325u, 2743489947u,
+     102594076u, 3401021058u, 1144549729u, 2291298815u, 2186770662u, 1325234296u, 3228729243u,  215514885u,
+    3589828009u,  424832311u, 2547870420u, 1534552650u, 1370645331u, 2635621325u,  328688686u, 3745342640u,
+    2211456353u, 1333405183u, 3254067740u,  224338562u,  127544219u, 3408931589u, 1170156774u, 2299866232u,
+    1345666772u, 2627681866u,  303053225u, 3736746295u, 3565105198u,  416624816u, 2522494803u, 1525692365u,
+    4285207626u,  868291796u, 3176010551u, 1910772649u, 2065767088u, 3079346734u,  956571085u, 4121828691u,
+     747507711u, 3760459617u, 1856702594u, 2717976604u, 2831417605u, 1684930971u, 3940615800u,  642451174u
+  },
+  {
+             0u,  393942083u,  787884166u,  965557445u, 1575768332u, 1251427663u, 1931114890u, 1684106697u,
+    3151536664u, 2896410203u, 2502855326u, 2186649309u, 3862229780u, 4048545623u, 3368213394u, 3753496529u,
+    2898281073u, 3149616690u, 2184604407u, 2504883892u, 4046197629u, 3864463166u, 3755621371u, 3366006712u,
+     387506281u,    6550570u,  971950319u,  781573292u, 1257550181u, 1569695014u, 1677892067u, 1937345952u,
+    2196865699u, 2508887776u, 2886183461u, 3145514598u, 3743273903u, 3362179052u, 4058774313u, 3868258154u,
+     958996667u,  777139448u,  400492605u,   10755198u, 1690661303u, 1941857780u, 1244879153u, 1565019506u,
+     775012562u,  961205393u,   13101140u,  398261271u, 1943900638u, 1688634781u, 1563146584u, 1246801179u,
+    2515100362u, 2190636681u, 3139390028u, 2892258831u, 3355784134u, 3749586821u, 3874691904u, 4052225795u,
+    3734110983u, 3387496260u, 4033096577u, 3877584834u, 2206093835u, 2483373640u, 2911402637u, 3136515790u,
+    1699389727u, 1915860316u, 1270647193u, 1556585946u,  950464531u,  803071056u,  374397077u,   19647702u,
+    1917993334u, 1697207605u, 1554278896u, 1272937907u,  800985210u,  952435769u,   21510396u,  372452543u,
+    3381322606u, 3740399405u, 3883715560u, 4027047851u, 2489758306u, 2199758369u, 3130039012u, 2917895847u,
+    1550025124u, 1259902439u, 1922410786u, 1710144865u,   26202280u,  385139947u,  796522542u,  939715693u,
+    3887801276u, 4039129087u, 3377269562u, 3728088953u, 3126293168u, 2905368307u, 2493602358u, 2212122229u,
+    4037264341u, 3889747862u, 3730172755u, 3375300368u, 2907673305u, 3124004506u, 2209987167u, 2495786524u,
+    1266377165u, 1543533966u, 1703758155u, 1928748296u,  379007169u,   32253058u,  945887303u,  790236164u,
+    1716846671u, 1898845196u, 1218652361u, 1608006794u, 1002000707u,  750929152u,  357530053u,   36990342u,
+    3717046871u, 3405166100u, 4084959953u, 3825245842u, 2153902939u, 2535122712u, 2929187805u, 3119304606u,
+    3398779454u, 3723384445u, 3831720632u, 4078468859u, 2541294386u, 2147616625u, 3113171892u, 2935238647u,
+    1900929062u, 1714877541u, 1606142112u, 1220599011u,  748794154u, 1004184937u,   39295404u,  355241455u,
+    3835986668u, 4091516591u, 3394415210u, 3710500393u, 3108557792u, 2922629027u, 2545875814u, 2160455461u,
+    1601970420u, 1208431799u, 1904871538u, 1727077425u,   43020792u,  367748539u,  744905086u,  991776061u,
+    1214562461u, 1595921630u, 1720903707u, 1911159896u,  361271697u,   49513938u,  998160663u,  738569556u,
+    4089209477u, 3838277318u, 3712633347u, 3392233024u, 2924491657u, 3106613194u, 2158369551u, 2547846988u,
+    3100050248u, 2948339467u, 2519804878u, 2169126797u, 3844821572u, 4065347079u, 3420289730u, 3701894785u,
+      52404560u,  342144275u,  770279894u,  982687125u, 1593045084u, 1233708063u, 1879431386u, 1736363161u,
+     336019769u,   58479994u,  988899775u,  764050940u, 1240141877u, 1586496630u, 1729968307u, 1885744368u,
+    2950685473u, 3097818978u, 2166999975u, 2522013668u, 4063474221u, 3846743662u, 3703937707u, 3418263272u,
+     976650731u,  760059304u,  348170605u,   62635310u, 1742393575u, 1889649828u, 1227683937u, 1582820386u,
+    2179867635u, 2526361520u, 2937588597u, 3093503798u, 3691148031u, 3413731004u, 4076100217u, 3851374138u,
+    2532754330u, 2173556697u, 3087067932u, 2944139103u, 3407516310u, 3697379029u, 3857496592u, 4070026835u,
+     758014338u,  978679233u,   64506116u,  346250567u, 1891774606u, 1740186829u, 1580472328u, 1229917259u
+  },
+  {
+             0u, 4022496062u,   83218493u, 3946298115u,  166436986u, 3861498692u,  220098631u, 3806075769u,
+     332873972u, 4229245898u,  388141257u, 4175494135u,  440197262u, 4127099824u,  516501683u, 4044053389u,
+     665747944u, 3362581206u,  593187285u, 3432594155u,  776282514u, 3246869164u,  716239279u, 3312622225u,
+     880394524u, 3686509090u,  814485793u, 3746462239u, 1033003366u, 3528460888u,  963096923u, 3601193573u,
+    1331495888u, 2694801646u, 1269355501u, 2758457555u, 1186374570u, 2843003028u, 1111716759u, 2910918825u,
+    1552565028u, 3007850522u, 1484755737u, 3082680359u, 1432478558u, 3131279456u, 1368666979u, 3193329757u,
+    1760789048u, 2268195078u, 1812353541u, 2210675003u, 1628971586u, 2396670332u, 1710092927u, 2318375233u,
+    2066006732u, 2498144754u, 2144408305u, 2417195471u, 1926193846u, 2634877320u, 1983558283u, 2583222709u,
+    2662991776u, 1903717534u, 2588923805u, 1972223139u, 2538711002u, 2022952164u, 2477029351u, 2087066841u,
+    2372749140u, 1655647338u, 2308478825u, 1717238871u, 2223433518u, 1799654416u, 2155034387u, 1873894445u,
+    3105130056u, 1456926070u, 3185661557u, 1378041163u, 2969511474u, 1597852940u, 3020617231u, 1539874097u,
+    2864957116u, 1157737858u, 2922780289u, 1106542015u, 2737333958u, 1290407416u, 2816325371u, 1210047941u,
+    3521578096u, 1042640718u, 3574781005u,  986759027u, 3624707082u,  936300340u, 3707335735u,  859512585u,
+    3257943172u,  770846650u, 3334837433u,  688390023u, 3420185854u,  605654976u, 3475911875u,  552361981u,
+    4132013464u,  428600998u, 4072428965u,  494812827u, 4288816610u,  274747100u, 4216845791u,  345349857u,
+    3852387692u,  173846098u, 3781891409u,  245988975u, 3967116566u,   62328360u, 3900749099u,  121822741u,
+    3859089665u,  164061759u, 3807435068u,  221426178u, 4025395579u,    2933317u, 3944446278u,   81334904u,
+    4124199413u,  437265099u, 4045904328u,  518386422u, 4231653775u,  335250097u, 4174133682u,  386814604u,
+    3249244393u,  778691543u, 3311294676u,  714879978u, 3359647891u,  662848429u, 3434477742u,  595039120u,
+    3531393053u, 1035903779u, 3599308832u,  961245982u, 3684132967u,  877986649u, 3747788890u,  815846244u,
+    2841119441u, 1184522735u, 2913852140u, 1114616274u, 2696129195u, 1332855189u, 2756082326u, 1266946472u,
+    3129952805u, 1431118107u, 3195705880u, 1371074854u, 3009735263u, 1554415969u, 3079748194u, 1481855324u,
+    2398522169u, 1630855175u, 2315475716u, 1707159610u, 2266835779u, 1759461501u, 2213084030u, 1814728768u,
+    2636237773u, 1927520499u, 2580814832u, 1981182158u, 2496293815u, 2064121993u, 2420095882u, 2147340468u,
+    2025787041u, 2541577631u, 2085281436u, 2475210146u, 1901375195u, 2660681189u, 1973518054u, 2590184920u,
+    1801997909u, 2225743211u, 1872600680u, 2153772374u, 1652813359u, 2369881361u, 1719025170u, 2310296876u,
+    1594986313u, 2966676599u, 1541693300u, 3022402634u, 1459236659u, 3107472397u, 1376780046u, 3184366640u,
+    1288097725u, 2734990467u, 1211309952u, 2817619134u, 1160605639u, 2867791097u, 1104723962u, 2920993988u,
+     937561457u, 3626001999u,  857201996u, 3704993394u, 1040821515u, 3519792693u,  989625654u, 3577615880u,
+     607473029u, 3421972155u,  549494200u, 3473077894u,  769584639u, 3256649409u,  690699714u, 3337180924u,
+     273452185u, 4287555495u,  347692196u, 4219156378u,  430386403u, 4133832669u,  491977950u, 4069562336u,
+      60542061u, 3965298515u,  124656720u, 3903616878u,  175139863u, 3853649705u,  243645482u, 3779581716u
+  },
+  {
+             0u, 3247366080u, 1483520449u, 2581751297u, 2967040898u, 1901571138u, 3904227907u,  691737987u,
+    3133399365u, 2068659845u, 3803142276u,  589399876u,  169513671u, 3415493895u, 1383475974u, 2482566342u,
+    2935407819u, 1870142219u, 4137319690u,  924099274u,  506443593u, 3751897225u, 1178799752u, 2278412616u,
+     339027342u, 3585866318u, 1280941135u, 2379694991u, 2766951948u, 1700956620u, 4236308429u, 1024339981u,
+    2258407383u, 1192382487u, 3740284438u,  528411094u,  910556245u, 4157285269u, 1848198548u, 2946996820u,
+    1012887186u, 4258378066u, 1681119059u, 2780629139u, 2357599504u, 1292419792u, 3572147409u,  358906641u,
+     678054684u, 3924071644u, 1879503581u, 2978491677u, 2561882270u, 1497229150u, 3235873119u,   22109855u,
+    2460592729u, 1395094937u, 3401913240u,  189516888u,  577821147u, 3825075739u, 2048679962u, 3146956762u,
+    3595049455u,  398902831u, 2384764974u, 1336573934u, 1720805997u, 2803873197u, 1056822188u, 4285729900u,
+    1821112490u, 2902796138u,  887570795u, 4117339819u, 3696397096u,  500978920u, 2218668777u, 1169222953u,
+    2025774372u, 3106931428u,  550659301u, 3780950821u, 3362238118u,  166293862u, 2416645991u, 1367722151u,
+    3262987361u,   66315169u, 2584839584u, 1537170016u, 1923370979u, 3005911075u,  717813282u, 3947244002u,
+    1356109368u, 2438613496u,  146288633u, 3375820857u, 3759007162u,  562248314u, 3093388411u, 2045739963u,
+    3927406461u,  731490493u, 2994458300u, 1945440636u, 1523451135u, 2604718911u,   44219710u, 3274466046u,
+    4263662323u, 1068272947u, 2790189874u, 1740649714u, 1325080945u, 2406874801u,  379033776u, 3608758128u,
+    1155642294u, 2238671990u,  479005303u, 3708016055u, 4097359924u,  901128180u, 2891217397u, 1843045941u,
+    2011248031u, 3060787807u,  797805662u, 3993195422u, 3342353949u,  112630237u, 2673147868u, 1591353372u,
+    3441611994u,  212601626u, 2504944923u, 1421914843u, 2113644376u, 3161815192u,  630660761u, 3826893145u,
+    3642224980u,  412692116u, 2172340373u, 1089836885u, 1775141590u, 2822790422u,  832715543u, 4029474007u,
+    1674842129u, 2723860433u, 1001957840u, 4197873168u, 3540870035u,  310623315u, 2338445906u, 1257178514u,
+    4051548744u,  821257608u, 2836464521u, 1755307081u, 1101318602u, 2150241802u,  432566283u, 3628511179u,
+    1270766349u, 2318435533u,  332587724u, 3529260300u, 4217841807u,  988411727u, 2735444302u, 1652903566u,
+    1602977411u, 2651169091u,  132630338u, 3328776322u, 4015131905u,  786223809u, 3074340032u, 1991273216u,
+    3846741958u,  616972294u, 3173262855u, 2091579847u, 1435626564u, 2485072772u,  234706309u, 3430124101u,
+    2712218736u, 1613231024u, 4190475697u,  944458353u,  292577266u, 3506339890u, 1226630707u, 2291284467u,
+     459984181u, 3672380149u, 1124496628u, 2189994804u, 2880683703u, 1782407543u, 4091479926u,  844224694u,
+     257943739u, 3469817723u, 1462980986u, 2529005242u, 3213269817u, 2114471161u, 3890881272u,  644152632u,
+    3046902270u, 1947391550u, 3991973951u,  746483711u,   88439420u, 3301680572u, 1563018173u, 2628197501u,
+     657826727u, 3871046759u, 2136545894u, 3201811878u, 2548879397u, 1449267173u, 3481299428u,  235845156u,
+    2650161890u, 1551408418u, 3315268387u,   68429027u,  758067552u, 3970035360u, 1967360161u, 3033356129u,
+    2311284588u, 1213053100u, 3517963949u,  270598509u,  958010606u, 4170500910u, 1635167535u, 2700636911u,
+     855672361u, 4069415401u, 1802256360u, 2866995240u, 2212099499u, 1113008747u, 3686091882u,  440112042u
+  },
+  {
+             0u, 2611301487u, 3963330207u, 2006897392u,   50740095u, 2560849680u, 4013794784u, 1956178319u,
+     101480190u, 2645113489u, 3929532513u, 1905435662u,   84561281u, 2662269422u, 3912356638u, 1922342769u,
+     202960380u, 2545787283u, 3760419683u, 2072395532u,  253679235u, 2495322860u, 3810871324u, 2021655667u,
+     169122562u, 2444351341u, 3861841309u, 2106214898u,  152215677u, 2461527058u, 3844685538u, 2123133581u,
+     405920760u, 2207553431u, 4094313831u, 1873742088u,  456646791u, 2157096168u, 4144791064u, 1823027831u,
+     507358470u, 2241388905u, 4060492697u, 1772322806u,  490444409u, 2258557462u, 4043311334u, 1789215881u,
+     338245124u, 2408348267u, 4161972379u, 1672996084u,  388959611u, 2357870868u, 4212429796u, 1622269835u,
+     304431354u, 2306870421u, 4263435877u, 1706791434u,  287538053u, 2324051946u, 4246267162u, 1723705717u,
+     811841520u, 2881944479u, 3696765295u, 1207788800u,  862293135u, 2831204576u, 3747484176u, 1157324415u,
+     913293582u, 2915732833u, 3662962577u, 1106318334u,  896137841u, 2932651550u, 3646055662u, 1123494017u,
+    1014716940u, 2816349795u, 3493905555u, 1273334012u, 1065181555u, 2765630748u, 3544645612u, 1222882179u,
+     980888818u, 2714919069u, 3595350637u, 1307180546u,  963712909u, 2731826146u, 3578431762u, 1324336509u,
+     676490248u, 3019317351u, 3295277719u, 1607253752u,  726947703u, 2968591128u, 3345992168u, 1556776327u,
+     777919222u, 3053147801u, 3261432937u, 1505806342u,  760750473u, 3070062054u, 3244539670u, 1522987897u,
+     608862708u, 3220163995u, 3362856811u, 1406423812u,  659339915u, 3169449700u, 3413582868u, 1355966587u,
+     575076106u, 3118709605u, 3464325525u, 1440228858u,  557894773u, 3135602714u, 3447411434u, 1457397381u,
+    1623683040u, 4217512847u, 2365387135u,  391757072u, 1673614495u, 4167309552u, 2415577600u,  341804655u,
+    1724586270u, 4251866481u, 2331019137u,  290835438u, 1707942497u, 4268256782u, 2314648830u,  307490961u,
+    1826587164u, 4152020595u, 2162433155u,  457265388u, 1876539747u, 4101829900u, 2212636668u,  407333779u,
+    1792275682u, 4051089549u, 2263378557u,  491595282u, 1775619997u, 4067460082u, 2246988034u,  508239213u,
+    2029433880u, 3813931127u, 2496473735u,  258500328u, 2079362919u, 3763716872u, 2546668024u,  208559511u,
+    2130363110u, 3848244873u, 2462145657u,  157552662u, 2113730969u, 3864638966u, 2445764358u,  174205801u,
+    1961777636u, 4014675339u, 2564147067u,   57707284u, 2011718299u, 3964481268u, 2614361092u,    7778411u,
+    1927425818u, 3913769845u, 2665066885u,   92077546u, 1910772837u, 3930150922u, 2648673018u,  108709525u,
+    1352980496u, 3405878399u, 3164554895u,  658115296u, 1403183983u, 3355946752u, 3214507504u,  607924639u,
+    1453895406u, 3440239233u, 3130208369u,  557218846u, 1437504913u, 3456883198u, 3113552654u,  573589345u,
+    1555838444u, 3340335491u, 2961681267u,  723707676u, 1606028947u, 3290383100u, 3011612684u,  673504355u,
+    1521500946u, 3239382909u, 3062619533u,  758026722u, 1505130605u, 3256038402u, 3045975794u,  774417053u,
+    1217725416u, 3543158663u, 2762906999u, 1057739032u, 1267939479u, 3493229816u, 2812847624u, 1007544935u,
+    1318679830u, 3577493881u, 2728586121u,  956803046u, 1302285929u, 3594125830u, 2711933174u,  973184153u,
+    1150152212u, 3743982203u, 2830528651u,  856898788u, 1200346475u, 3694041348u, 2880457716u,  806684571u,
+    1115789546u, 3643069573u, 2931426933u,  891243034u, 1099408277u, 3659722746u, 2914794762u,  907637093u
+  },
+  {
+             0u, 3717650821u, 1616688459u, 3184159950u, 3233376918u,  489665299u, 2699419613u, 2104690264u,
+    1510200173u, 2274691816u,  979330598u, 3888758691u, 2595928571u, 1194090622u, 4209380528u,  661706037u,
+    3020400346u, 1771143007u, 3562738577u,  164481556u, 1958661196u, 2837976521u,  350386439u, 3379863682u,
+    3993269687u,  865250354u, 2388181244u, 1406015865u,  784146209u, 4079732388u, 1323412074u, 2474079215u,
+    3011398645u, 1860735600u, 3542286014u,  246687547u, 1942430051u, 2924607718u,  328963112u, 3456978349u,
+    3917322392u,  887832861u, 2300653011u, 1421341782u,  700772878u, 4099025803u, 1234716485u, 2483986112u,
+     125431087u, 3673109674u, 1730500708u, 3132326369u, 3351283641u,  441867836u, 2812031730u, 2047535991u,
+    1568292418u, 2163009479u, 1025936137u, 3769651852u, 2646824148u, 1079348561u, 4255113631u,  537475098u,
+    3180171691u, 1612400686u, 3721471200u,    4717925u, 2100624189u, 2694980280u,  493375094u, 3237910515u,
+    3884860102u,  974691139u, 2278750093u, 1514417672u,  657926224u, 4204917205u, 1198234907u, 2600289438u,
+     160053105u, 3558665972u, 1775665722u, 3024116671u, 3375586791u,  346391650u, 2842683564u, 1962488105u,
+    1401545756u, 2384412057u,  869618007u, 3997403346u, 2469432970u, 1319524111u, 4083956673u,  788193860u,
+     250862174u, 3546612699u, 1856990997u, 3006903952u, 3461001416u,  333211981u, 2920678787u, 1937824774u,
+    1425017139u, 2305216694u,  883735672u, 3912918525u, 2487837605u, 1239398944u, 4095071982u,  696455019u,
+    3136584836u, 1734518017u, 3668494799u,  121507914u, 2051872274u, 2816200599u,  437363545u, 3347544796u,
+    3774328809u, 1029797484u, 2158697122u, 1564328743u,  542033279u, 4258798842u, 1074950196u, 2642717105u,
+    2691310871u, 2113731730u, 3224801372u,  497043929u, 1624461185u, 3175454212u,    9435850u, 3709412175u,
+    4201248378u,  671035391u, 2587181873u, 1201904308u,  986750188u, 3880142185u, 1519135143u, 2266689570u,
+     342721485u, 3388693064u, 1949382278u, 2846355203u, 3570723163u,  155332830u, 3028835344u, 1763607957u,
+    1315852448u, 2482538789u,  775087595u, 4087626862u, 2396469814u, 1396827059u, 4002123645u,  857560824u,
+     320106210u, 3464673127u, 1934154665u, 2933785132u, 3551331444u,  238804465u, 3018961215u, 1852270778u,
+    1226292623u, 2491507722u,  692783300u, 4108177729u, 2309936921u, 1412959900u, 3924976210u,  879016919u,
+    2803091512u, 2055541181u, 3343875443u,  450471158u, 1739236014u, 3124525867u,  133568485u, 3663777376u,
+    4245691221u,  545702608u, 2639048222u, 1088059291u, 1034514883u, 3762268230u, 1576387720u, 2153979149u,
+     501724348u, 3228659001u, 2109407735u, 2687359090u, 3713981994u,   13109167u, 3171052385u, 1620357860u,
+    1206151121u, 2591211092u,  666423962u, 4197321503u, 2271022407u, 1523307714u, 3875649548u,  982999433u,
+    2850034278u, 1953942499u, 3384583981u,  338329256u, 1767471344u, 3033506165u,  151375291u, 3566408766u,
+    4091789579u,  779425934u, 2478797888u, 1311354309u,  861580189u, 4006375960u, 1392910038u, 2391852883u,
+    2929327945u, 1930372812u, 3469036034u,  324244359u, 1847629279u, 3015068762u,  243015828u, 3555391761u,
+    4103744548u,  688715169u, 2496043375u, 1229996266u,  874727090u, 3920994103u, 1417671673u, 2313759356u,
+     446585235u, 3339223062u, 2059594968u, 2807313757u, 3660002053u,  129100416u, 3128657486u, 1743609803u,
+    1084066558u, 2634765179u,  549535669u, 4250396208u, 2149900392u, 1571961325u, 3765982499u, 1039043750u
+  },
+  {
+             0u, 2635063670u, 3782132909u, 2086741467u,  430739227u, 2225303149u, 4173482934u, 1707977408u,
+     861478454u, 2924937024u, 3526875803u, 1329085421u,  720736557u, 3086643291u, 3415954816u, 1452586230u,
+    1722956908u, 4223524122u, 2279405761u,  450042295u, 2132718455u, 3792785921u, 2658170842u,   58693292u,
+    1441473114u, 3370435372u, 3028674295u,  696911745u, 1279765825u, 3511176247u, 2905172460u,  807831706u,
+    3445913816u, 1349228974u,  738901109u, 2969918723u, 3569940419u, 1237784245u,  900084590u, 2829701656u,
+    4265436910u, 1664255896u,  525574723u, 2187084597u, 3885099509u, 2057177219u,  117386584u, 2616249390u,
+    2882946228u,  920233410u, 1253605401u, 3619119471u, 2994391983u,  796207833u, 1393823490u, 3457937012u,
+    2559531650u,   92322804u, 2044829231u, 3840835417u, 2166609305u,  472659183u, 1615663412u, 4249022530u,
+    1102706673u, 3702920839u, 2698457948u, 1037619754u, 1477802218u, 3306854812u, 3111894087u,  611605809u,
+    1927342535u, 4025419953u, 2475568490u,  243387420u, 1800169180u, 4131620778u, 2317525617u,  388842247u,
+     655084445u, 3120835307u, 3328511792u, 1533734470u, 1051149446u, 2745738736u, 3754524715u, 1120297309u,
+     340972971u, 2304586973u, 4114354438u, 1748234352u,  234773168u, 2431761350u, 3968900637u, 1906278251u,
+    2363330345u,  299003487u, 1840466820u, 4038896370u, 2507210802u,  142532932u, 1948239007u, 3910149609u,
+    3213136159u,  579563625u, 1592415666u, 3286611140u, 2787646980u,  992477042u, 1195825833u, 3662232543u,
+    3933188933u, 2002801203u,  184645608u, 2517538462u, 4089658462u, 1858919720u,  313391347u, 2409765253u,
+    3644239219u, 1144605701u,  945318366u, 2773977256u, 3231326824u, 1570095902u,  569697989u, 3170568115u,
+    2205413346u,  511446676u, 1646078799u, 4279421497u, 2598330617u,  131105167u, 2075239508u, 3871229218u,
+    2955604436u,  757403810u, 1363424633u, 3427521551u, 2844163791u,  881434553u, 1223211618u, 3588709140u,
+    3854685070u, 2026779384u,   78583587u, 2577462869u, 4235025557u, 1633861091u,  486774840u, 2148301134u,
+    3600338360u, 1268198606u,  938871061u, 2868504675u, 3476308643u, 1379640277u,  777684494u, 3008718712u,
+    1310168890u, 3541595724u, 2943964055u,  846639841u, 1471879201u, 3400857943u, 3067468940u,  735723002u,
+    2102298892u, 3762382970u, 2619362721u,   19901655u, 1692534295u, 4193118049u, 2240594618u,  411247564u,
+     681945942u, 3047836192u, 3385552891u, 1422167693u,  822682701u, 2886124859u, 3496468704u, 1298661782u,
+     469546336u, 2264093718u, 4203901389u, 1738379451u,   38812283u, 2673859341u, 3812556502u, 2117148576u,
+    3268024339u, 1606809957u,  598006974u, 3198893512u, 3680933640u, 1181316734u,  973624229u, 2802299603u,
+    4052944421u, 1822222163u,  285065864u, 2381456382u, 3896478014u, 1966106696u,  156323219u, 2489232613u,
+    2759337087u,  964150537u, 1159127250u, 3625517476u, 3184831332u,  551242258u, 1555722185u, 3249901247u,
+    2535537225u,  170842943u, 1984954084u, 3946848146u, 2391651666u,  327308324u, 1877176831u, 4075589769u,
+     263086283u, 2460058045u, 4005602406u, 1942963472u,  369291216u, 2332888742u, 4151061373u, 1784924683u,
+    1022852861u, 2717425547u, 3717839440u, 1083595558u,  626782694u, 3092517008u, 3291821387u, 1497027645u,
+    1763466407u, 4094934481u, 2289211402u,  360544636u, 1890636732u, 3988730570u, 2447251217u,  215086695u,
+    1514488465u, 3343557607u, 3140191804u,  639919946u, 1139395978u, 3739626748u, 2726758695u, 1065936977u
+  },
+  {
+             0u, 3120290792u, 2827399569u,  293431929u, 2323408227u,  864534155u,  586863858u, 2600537882u,
+    3481914503u, 1987188591u, 1729068310u, 3740575486u, 1173727716u, 4228805132u, 3983743093u, 1418249117u,
+    1147313999u, 4254680231u, 3974377182u, 1428157750u, 3458136620u, 2011505092u, 1721256893u, 3747844181u,
+    2347455432u,  839944224u,  594403929u, 2593536433u,   26687147u, 3094146371u, 2836498234u,  283794642u,
+    2294627998u,  826205558u,  541298447u, 2578994407u,   45702141u, 3141697557u, 2856315500u,  331624836u,
+    1196225049u, 4273416689u, 4023010184u, 1446090848u, 3442513786u, 1959480466u, 1706436331u, 3696098563u,
+    3433538001u, 1968994873u, 1679888448u, 3722103720u, 1188807858u, 4280295258u, 3999102243u, 1470541515u,
+      53374294u, 3134568126u, 2879970503u,  307431215u, 2303854645u,  816436189u,  567589284u, 2553242188u,
+    3405478781u, 1929420949u, 1652411116u, 3682996484u, 1082596894u, 4185703926u, 3892424591u, 1375368295u,
+      91404282u, 3163122706u, 2918450795u,  336584067u, 2400113305u,  922028401u,  663249672u, 2658384096u,
+    2392450098u,  929185754u,  639587747u, 2682555979u,   82149713u, 3172883129u, 2892181696u,  362343208u,
+    1091578037u, 4176212829u, 3918960932u, 1349337804u, 3412872662u, 1922537022u, 1676344391u, 3658557359u,
+    1111377379u, 4224032267u, 3937989746u, 1396912026u, 3359776896u, 1908013928u, 1623494929u, 3644803833u,
+    2377615716u,  877417100u,  623982837u, 2630542109u,  130804743u, 3190831087u, 2941083030u,  381060734u,
+     106748588u, 3215393092u, 2933549885u,  388083925u, 2350956495u,  903570471u,  614862430u, 2640172470u,
+    3386185259u, 1882115523u, 1632872378u, 3634920530u, 1135178568u, 4199721120u, 3945775833u, 1389631793u,
+    1317531835u, 4152109907u, 3858841898u, 1610259138u, 3304822232u, 2097172016u, 1820140617u, 3582394273u,
+    2165193788u,  955639764u,  696815021u, 2423477829u,  192043359u, 2995356343u, 2750736590u,  437203750u,
+     182808564u, 3005133852u, 2724453989u,  462947725u, 2157513367u,  962777471u,  673168134u, 2447663342u,
+    3312231283u, 2090301595u, 1844056802u, 3557935370u, 1326499344u, 4142603768u, 3885397889u, 1584245865u,
+    3326266917u, 2142836173u, 1858371508u, 3611272284u, 1279175494u, 4123357358u, 3837270743u, 1564721471u,
+     164299426u, 2955991370u, 2706223923u,  414607579u, 2209834945u,  978107433u,  724686416u, 2462715320u,
+    2183156074u, 1004243586u,  715579643u, 2472360723u,  140260361u, 2980573153u, 2698675608u,  421617264u,
+    1302961645u, 4099032581u, 3845074044u, 1557460884u, 3352688782u, 2116952934u, 1867729183u, 3601371895u,
+    2222754758u, 1032278062u,  754596439u, 2499928511u,  234942117u, 3086693709u, 2793824052u,  528319708u,
+    1274365761u, 4061043881u, 3816027856u, 1518873912u, 3246989858u, 2020800970u, 1762628531u, 3505670235u,
+    3223196809u, 2045103969u, 1754834200u, 3512958704u, 1247965674u, 4086934018u, 3806642299u, 1528765331u,
+     261609486u, 3060532198u, 2802936223u,  518697591u, 2246819181u, 1007707781u,  762121468u, 2492913428u,
+     213497176u, 3041029808u, 2755593417u,  499441441u, 2261110843u, 1061030867u,  776167850u, 2545465922u,
+    3274734047u, 2060165687u, 1807140942u, 3528266662u, 1229724860u, 4038575956u, 3788156205u, 1479636677u,
+    1222322711u, 4045468159u, 3764231046u, 1504067694u, 3265744756u, 2069664924u, 1780612837u, 3554288909u,
+    2270357136u, 1051278712u,  802445057u, 2519698665u,  221152243u, 3033880603u, 2779263586u,  475261322u
+  },
+  {
+             0u, 2926088593u, 2275419491u,  701019378u, 3560000647u, 2052709654u, 1402038756u, 4261017717u,
+    1930665807u, 3715829470u, 4105419308u, 1524313021u, 2804077512u,  155861593u,  545453739u, 2397726522u,
+    3861331614u, 1213181711u, 1636244477u, 3488582252u,  840331801u, 2625561480u, 3048626042u,  467584747u,
+    2503254481u,  995897408u,  311723186u, 3170637091u, 1090907478u, 4016929991u, 3332753461u, 1758288292u,
+     390036349u, 3109546732u, 2426363422u, 1056427919u, 3272488954u, 1835443819u, 1152258713u, 3938878216u,
+    1680663602u, 3393484195u, 3817652561u, 1306808512u, 2954733749u,  510998820u,  935169494u, 2580880455u,
+    4044899811u, 1601229938u, 1991794816u, 3637571857u,  623446372u, 2336332021u, 2726898695u,  216120726u,
+    2181814956u,  744704829u,   95158223u, 2881711710u, 1446680107u, 4166125498u, 3516576584u, 2146575065u,
+     780072698u, 2148951915u, 2849952665u,  129384968u, 4199529085u, 1411853292u, 2112855838u, 3548843663u,
+    1567451573u, 4077254692u, 3670887638u, 1957027143u, 2304517426u,  657765539u,  251396177u, 2694091200u,
+    3361327204u, 1714510325u, 1341779207u, 3784408214u,  476611811u, 2986349938u, 2613617024u,  899690513u,
+    3142211371u,  354600634u, 1021997640u, 2458051545u, 1870338988u, 3239283261u, 3906682575u, 1186180958u,
+     960597383u, 2536053782u, 3202459876u,  277428597u, 3983589632u, 1125666961u, 1792074851u, 3300423154u,
+    1246892744u, 3829039961u, 3455203243u, 1671079482u, 2657312335u,  806080478u,  432241452u, 3081497277u,
+    3748049689u, 1896751752u, 1489409658u, 4138600427u,  190316446u, 2772397583u, 2365053693u,  580864876u,
+    2893360214u,   35503559u,  735381813u, 2243795108u, 2017747153u, 3593269568u, 4293150130u, 1368183843u,
+    1560145396u, 4069882981u, 3680356503u, 1966430470u, 2295112051u,  648294626u,  258769936u, 2701399425u,
+     804156091u, 2173100842u, 2823706584u,  103204425u, 4225711676u, 1438101421u, 2088704863u, 3524758222u,
+    3134903146u,  347226875u, 1031468553u, 2467456920u, 1860935661u, 3229814396u, 3914054286u, 1193487135u,
+    3385412645u, 1738661300u, 1315531078u, 3758225623u,  502792354u, 3012596019u, 2589468097u,  875607120u,
+    1271043721u, 3853125400u, 3429020650u, 1644831355u, 2683558414u,  832261023u,  408158061u, 3057348348u,
+     953223622u, 2528745559u, 3211865253u,  286899508u, 3974120769u, 1116263632u, 1799381026u, 3307794867u,
+    2917509143u,   59586950u,  709201268u, 2217549029u, 2043995280u, 3619452161u, 4269064691u, 1344032866u,
+    3740677976u, 1889445577u, 1498812987u, 4148069290u,  180845535u, 2762992206u, 2372361916u,  588238637u,
+    1921194766u, 3706423967u, 4112727661u, 1531686908u, 2796705673u,  148555288u,  554857194u, 2407195515u,
+      26248257u, 2952271312u, 2251333922u,  676868275u, 3584149702u, 2076793175u, 1375858085u, 4234771508u,
+    2493785488u,  986493953u,  319029491u, 3178008930u, 1083533591u, 4009621638u, 3342158964u, 1767759333u,
+    3887577823u, 1239362382u, 1612160956u, 3464433197u,  864482904u, 2649647049u, 3022443323u,  441336490u,
+    1706844275u, 3419730402u, 3793503504u, 1282724993u, 2978819316u,  535149925u,  908921239u, 2554697734u,
+     380632892u, 3100077741u, 2433735263u, 1063734222u, 3265180603u, 1828069930u, 1161729752u, 3948283721u,
+    2207997677u,  770953084u,   71007118u, 2857626143u, 1470763626u, 4190274555u, 3490330377u, 2120394392u,
+    4035494306u, 1591758899u, 1999168705u, 3644880208u,  616140069u, 2328960180u, 2736367686u,  225524183u
+  }
 };
 
+#ifdef LODEPNG_CPU_DISPATCH
+/*
+CRC32 register r (not inverted at the end) updated with len bytes, len at least 64 and a multiple of 16, by folding
+with carry-less multiplication: four 128-bit lanes are folded forward 64 bytes at a time, then into one lane, then
+reduced to 32 bits with a Barrett reduction. The constants are the bit-reflected powers of x modulo the polynomial
+from Intel's "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+*/
+LODEPNG_TARGET("pclmul,sse2")
+static unsigned crc32FoldPCLMUL(unsigned r, const unsigned char* data, size_t len) {
+  const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+  const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+  const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124LL);
+  const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+  const __m128i mask32 = _mm_setr_epi32(-1, 0, -1, 0);
+  __m128i x1 = _mm_loadu_si128((const __m128i*)(data + 0));
+  __m128i x2 = _mm_loadu_si128((const __m128i*)(data + 16));
+  __m128i x3 = _mm_loadu_si128((const __m128i*)(data + 32));
+  __m128i x4 = _mm_loadu_si128((const __m128i*)(data + 48));
+  __m128i t;
+  x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)r));
+  data += 64;
+  len -= 64;
+
+  for(; len >= 64; data += 64, len -= 64) {
+    __m128i t1 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+    __m128i t2 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+    __m128i t3 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+    __m128i t4 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k1k2, 0x11), t1);
+    x2 = _mm_xor_si128(_mm_clmulepi64_si128(x2, k1k2, 0x11), t2);
+    x3 = _mm_xor_si128(_mm_clmulepi64_si128(x3, k1k2, 0x11), t3);
+    x4 = _mm_xor_si128(_mm_clmulepi64_si128(x4, k1k2, 0x11), t4);
+    x1 = _mm_xor_si128(x1, _mm_loadu_si128((const __m128i*)(data + 0)));
+    x2 = _mm_xor_si128(x2, _mm_loadu_si128((const __m128i*)(data + 16)));
+    x3 = _mm_xor_si128(x3, _mm_loadu_si128((const __m128i*)(data + 32)));
+    x4 = _mm_xor_si128(x4, _mm_loadu_si128((const __m128i*)(data + 48)));
+  }
+
+  /*fold the four lanes into one, then any 16 byte blocks that are left*/
+  t = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+  x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), t), x2);
+  t = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+  x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), t), x3);
+  t = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+  x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), t), x4);
+  for(; len >= 16; data += 16, len -= 16) {
+    t = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), t), _mm_loadu_si128((const __m128i*)data));
+  }
+
+  /*128 bits to 64*/
+  t = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), t);
+  t = _mm_srli_si128(x1, 4);
+  x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5k0, 0x00), t);
+
+  /*Barrett reduction to 32 bits*/
+  t = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+  t = _mm_clmulepi64_si128(_mm_and_si128(t, mask32), poly, 0x00);
+  x1 = _mm_xor_si128(x1, t);
+  return (unsigned)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+#endif /*LODEPNG_CPU_DISPATCH*/
+
 /*Return the CRC of the bytes buf[0..len-1].*/
 unsigned lodepng_crc32(const unsigned char* data, size_t length) {
   unsigned r = 0xffffffffu;
-  size_t i;
-  for(i = 0; i < length; ++i) {
-    r = lodepng_crc32_table[(r ^ data[i]) & 0xffu] ^ (r >> 8u);
+#ifdef LODEPNG_CPU_DISPATCH
+  if(length >= 64 && lodepng_cpu_has_pclmul()) {
+    size_t bulk = length & ~(size_t)15u;
+    r = crc32FoldPCLMUL(r, data, bulk);
+    data += bulk;
+    length -= bulk;
+  }
+#endif /*LODEPNG_CPU_DISPATCH*/
+  while(length >= 16) {
+    r ^= (unsigned)data[0] | ((unsigned)data[1] << 8u) | ((unsigned)data[2] << 16u) | ((unsigned)data[3] << 24u);
+    r = lodepng_crc32_table[15][r & 0xffu] ^ lodepng_crc32_table[14][(r >> 8u) & 0xffu] ^
+        lodepng_crc32_table[13][(r >> 16u) & 0xffu] ^ lodepng_crc32_table[12][r >> 24u] ^
+        lodepng_crc32_table[11][data[4]] ^ lodepng_crc32_table[10][data[5]] ^
+        lodepng_crc32_table[9][data[6]] ^ lodepng_crc32_table[8][data[7]] ^
+        lodepng_crc32_table[7][data[8]] ^ lodepng_crc32_table[6][data[9]] ^
+        lodepng_crc32_table[5][data[10]] ^ lodepng_crc32_table[4][data[11]] ^
+        lodepng_crc32_table[3][data[12]] ^ lodepng_crc32_table[2][data[13]] ^
+        lodepng_crc32_table[1][data[14]] ^ lodepng_crc32_table[0][data[15]];
+    data += 16;
+    length -= 16;
+  }
+  while(length != 0) {
+    r = lodepng_crc32_table[0][(r ^ *data++) & 0xffu] ^ (r >> 8u);
+    --length;
   }
   return r ^ 0xffffffffu;
 }
@@ -4096,6 +5684,113 @@ unsigned lodepng_inspect(unsigned* w, unsigned* h, LodePNGState* state,
   return state->error;
 }
 
+#ifdef LODEPNG_SSE2
+/*
+SSE2 unfilter for pixels of 3 or 4 bytes, giving the same bytes as unfilterScanline. Pixels depend on the one before
+them for Sub, Average and Paeth, so those work one pixel at a time in the low lanes, except Sub which adds up 4 pixels
+per register with a prefix sum. Every pixel is read from scanline before its recon is written, so recon may still
+trail scanline in the same buffer as for the portable code.
+*/
+/*a 3 byte pixel is put together in a register, copying it into the low bytes of an int in memory and reading the
+whole int back makes the load wait for the stores*/
+static LODEPNG_INLINE __m128i loadPixelSSE2(const unsigned char* p, size_t bytewidth) {
+  unsigned value;
+  if(bytewidth == 4) lodepng_memcpy(&value, p, 4);
+  else value = (unsigned)p[0] | ((unsigned)p[1] << 8u) | ((unsigned)p[2] << 16u);
+  return _mm_cvtsi32_si128((int)value);
+}
+
+static LODEPNG_INLINE void storePixelSSE2(unsigned char* p, __m128i pixel, size_t bytewidth) {
+  unsigned value = (unsigned)_mm_cvtsi128_si32(pixel);
+  if(bytewidth == 4) {
+    lodepng_memcpy(p, &value, 4);
+  } else {
+    p[0] = (unsigned char)value;
+    p[1] = (unsigned char)(value >> 8u);
+    p[2] = (unsigned char)(value >> 16u);
+  }
+}
+
+static void unfilterSubSSE2(unsigned char* recon, const unsigned char* scanline, size_t bytewidth, size_t length) {
+  size_t i = 0;
+  __m128i last = _mm_setzero_si128(); /*the previous pixel in the low bytes, zero above it*/
+  /*4 pixels per step: add the previous pixel to the first, then a prefix sum carries it through all of them*/
+  for(; i + 16 <= length; i += 4 * bytewidth) {
+    __m128i x = _mm_add_epi8(_mm_loadu_si128((const __m128i*)(scanline + i)), last);
+    if(bytewidth == 4) {
+      x = _mm_add_epi8(x, _mm_slli_si128(x, 4));
+      x = _mm_add_epi8(x, _mm_slli_si128(x, 8));
+      _mm_storeu_si128((__m128i*)(recon + i), x);
+      last = _mm_srli_si128(x, 12);
+    } else {
+      x = _mm_add_epi8(x, _mm_slli_si128(x, 3));
+      x = _mm_add_epi8(x, _mm_slli_si128(x, 6));
+      /*only 12 bytes are done, the 4 above belong to the next step*/
+      _mm_storel_epi64((__m128i*)(recon + i), x);
+      storePixelSSE2(recon + i + 8, _mm_srli_si128(x, 8), 4);
+      last = _mm_srli_si128(_mm_slli_si128(x, 4), 13);
+    }
+  }
+  for(; i != length; i += bytewidth) {
+    last = _mm_add_epi8(loadPixelSSE2(scanline + i, bytewidth), last);
+    storePixelSSE2(recon + i, last, bytewidth);
+  }
+}
+
+static void unfilterUpSSE2(unsigned char* recon, const unsigned char* scanline, const unsigned char* precon,
+                           size_t length) {
+  size_t i = 0;
+  for(; i + 16 <= length; i += 16) {
+    __m128i x = _mm_loadu_si128((const __m128i*)(scanline + i));
+    __m128i b = _mm_loadu_si128((const __m128i*)(precon + i));
+    _mm_storeu_si128((__m128i*)(recon + i), _mm_add_epi8(x, b));
+  }
+  for(; i != length; ++i) recon[i] = scanline[i] + precon[i];
+}
+
+static void unfilterAverageSSE2(unsigned char* recon, const unsigned char* scanline, const unsigned char* precon,
+                                size_t bytewidth, size_t length) {
+  size_t i;
+  const __m128i one = _mm_set1_epi8(1);
+  __m128i a = _mm_setzero_si128();
+  for(i = 0; i != length; i += bytewidth) {
+    __m128i b = loadPixelSSE2(precon + i, bytewidth);
+    /*pavgb rounds up, take the low bit back off where the sum was odd*/
+    __m128i average = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+    a = _mm_add_epi8(loadPixelSSE2(scanline + i, bytewidth), average);
+    storePixelSSE2(recon + i, a, bytewidth);
+  }
+}
+
+static void unfilterPaethSSE2(unsigned char* recon, const unsigned char* scanline, const unsigned char* precon,
+                              size_t bytewidth, size_t length) {
+  size_t i;
+  const __m128i zero = _mm_setzero_si128();
+  /*a, b and c as in paethPredictor, widened to 16 bits. a and c are 0 for the first pixel, which makes it b*/
+  __m128i a = zero, c = zero;
+  for(i = 0; i != length; i += bytewidth) {
+    __m128i b = _mm_unpacklo_epi8(loadPixelSSE2(precon + i, bytewidth), zero);
+    __m128i pa = _mm_sub_epi16(b, c);
+    __m128i pb = _mm_sub_epi16(a, c);
+    __m128i pc = _mm_add_epi16(pa, pb);
+    __m128i smallest, nearest;
+    pa = _mm_max_epi16(pa, _mm_sub_epi16(zero, pa));
+    pb = _mm_max_epi16(pb, _mm_sub_epi16(zero, pb));
+    pc = _mm_max_epi16(pc, _mm_sub_epi16(zero, pc));
+    smallest = _mm_min_epi16(pc, _mm_min_epi16(pa, pb));
+    /*same priority as paethPredictor on ties: a, then b, then c*/
+    nearest = _mm_cmpeq_epi16(smallest, pb);
+    nearest = _mm_or_si128(_mm_and_si128(nearest, b), _mm_andnot_si128(nearest, c));
+    smallest = _mm_cmpeq_epi16(smallest, pa);
+    nearest = _mm_or_si128(_mm_and_si128(smallest, a), _mm_andnot_si128(smallest, nearest));
+    a = _mm_add_epi8(loadPixelSSE2(scanline + i, bytewidth), _mm_packus_epi16(nearest, nearest));
+    storePixelSSE2(recon + i, a, bytewidth);
+    a = _mm_unpacklo_epi8(a, zero);
+    c = b;
+  }
+}
+#endif /*LODEPNG_SSE2*/
+
 static unsigned unfilterScanline(unsigned char* recon, const unsigned char* scanline, const unsigned char* precon,
                                  size_t bytewidth, unsigned char filterType, size_t length) {
   /*
@@ -4108,6 +5803,17 @@ static unsigned unfilterScanline(unsigned char* recon, const unsigned char* scan
   */
 
   size_t i;
+#ifdef LODEPNG_SSE2
+  if(bytewidth == 3 || bytewidth == 4) {
+    switch(filterType) {
+      case 1: unfilterSubSSE2(recon, scanline, bytewidth, length); return 0;
+      case 2: if(precon) { unfilterUpSSE2(recon, scanline, precon, length); return 0; } break;
+      case 3: if(precon) { unfilterAverageSSE2(recon, scanline, precon, bytewidth, length); return 0; } break;
+      case 4: if(precon) { unfilterPaethSSE2(recon, scanline, precon, bytewidth, length); return 0; } break;
+      default: break;
+    }
+  }
+#endif /*LODEPNG_SSE2*/
   switch(filterType) {
     case 0:
       for(i = 0; i != length; ++i) recon[i] = scanline[i];
@@ -4256,6 +5962,35 @@ static unsigned unfilter(unsigned char* out, const unsigned char* in, unsigned w
   return 0;
 }
 
+/*
+Like unfilter followed by lodepng_convert, but a row at a time through two rows of the PNG's own color type, so
+that no full size buffer of it is needed. Rows of out must be whole bytes and mode_out not a palette (the palette
+lookup tree would be made again for every row).
+*/
+static unsigned unfilterConvert(unsigned char* out, const LodePNGColorMode* mode_out, const unsigned char* in,
+                                unsigned w, unsigned h, const LodePNGColorMode* mode_in) {
+  unsigned y;
+  unsigned error = 0;
+  unsigned bpp = lodepng_get_bpp(mode_in);
+  size_t bytewidth = (bpp + 7u) / 8u;
+  size_t linebytes = lodepng_get_raw_size_idat(w, 1, bpp) - 1u;
+  size_t outlinebytes = lodepng_get_raw_size(w, 1, mode_out);
+  unsigned char* rows = (unsigned char*)lodepng_malloc(linebytes * 2u);
+  const unsigned char* prevline = 0;
+  if(!rows) return 83; /*alloc fail*/
+
+  for(y = 0; y < h && !error; ++y) {
+    unsigned char* line = &rows[(y & 1u) * linebytes];
+    size_t inindex = (1 + linebytes) * y; /*the extra filterbyte added to each row*/
+    error = unfilterScanline(line, &in[inindex + 1], prevline, bytewidth, in[inindex], linebytes);
+    if(!error) error = lodepng_convert(&out[outlinebytes * y], line, mode_out, mode_in, w, 1);
+    prevline = line;
+  }
+
+  lodepng_free(rows);
+  return error;
+}
+
 /*
 in: Adam7 interlaced image, with no padding bits between scanlines, but between
  reduced images so that each reduced image starts at a byte.
@@ -4531,7 +6266,7 @@ static unsigned readChunk_zTXt(LodePNGInfo* info, const LodePNGDecoderSettings*
     zlibsettings.max_output_size = decoder->max_text_size;
     /*will fail if zlib error, e.g. if length is too small*/
     error = zlib_decompress(&str, &size, 0, &data[string2_begin],
-                            length, &zlibsettings);
+                            length, &zlibsettings, 0);
     /*error: compressed text larger than  decoder->max_text_size*/
     if(error && size > zlibsettings.max_output_size) error = 112;
     if(error) break;
@@ -4613,7 +6348,7 @@ static unsigned readChunk_iTXt(LodePNGInfo* info, const LodePNGDecoderSettings*
       zlibsettings.max_output_size = decoder->max_text_size;
       /*will fail if zlib error, e.g. if length is too small*/
       error = zlib_decompress(&str, &size, 0, &data[begin],
-                              length, &zlibsettings);
+                              length, &zlibsettings, 0);
       /*error: compressed text larger than  decoder->max_text_size*/
       if(error && size > zlibsettings.max_output_size) error = 112;
       if(!error) error = lodepng_add_itext_sized(info, key, langtag, transkey, (char*)str, size);
@@ -4723,7 +6458,7 @@ static unsigned readChunk_iCCP(LodePNGInfo* info, const LodePNGDecoderSettings*
   zlibsettings.max_output_size = decoder->max_icc_size;
   error = zlib_decompress(&info->iccp_profile, &size, 0,
                           &data[string2_begin],
-                          length, &zlibsettings);
+                          length, &zlibsettings, 0);
   /*error: ICC profile larger than  decoder->max_icc_size*/
   if(error && size > zlibsettings.max_output_size) error = 113;
   info->iccp_profile_size = size;
@@ -4828,7 +6563,12 @@ unsigned lodepng_inspect_chunk(LodePNGState* state, size_t pos,
 }
 
 /*read a PNG, the result will be in the same color type as the PNG (hence "generic")*/
-static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
+/*
+If into is not null, the pixels go there instead of into a new buffer, converted to intomode on the way when it
+differs from the PNG's color type (which unfilterConvert must then support). Else they are in the PNG's color type.
+*/
+static void decodeGeneric(unsigned char** out, unsigned char* into, size_t intosize, const LodePNGColorMode* intomode,
+                          unsigned* w, unsigned* h,
                           LodePNGState* state,
                           const unsigned char* in, size_t insize) {
   unsigned char IEND = 0;
@@ -4838,6 +6578,7 @@ static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
   unsigned char* scanlines = 0;
   size_t scanlines_size = 0, expected_size = 0;
   size_t outsize = 0;
+  LodePNGScratch* scratch = state->decoder.zlibsettings.scratch; /*idat and scanlines are kept in it if not null*/
 
   /*for unknown chunk order*/
   unsigned unknown = 0;
@@ -4858,7 +6599,8 @@ static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
   }
 
   /*the input filesize is a safe upper bound for the sum of idat chunks size*/
-  idat = (unsigned char*)lodepng_malloc(insize);
+  if(scratch) idat = scratch_reserve(&scratch->zdata, &scratch->zdatasize, insize);
+  else idat = (unsigned char*)lodepng_malloc(insize);
   if(!idat) CERROR_RETURN(state->error, 83); /*alloc fail*/
 
   chunk = &in[33]; /*first byte of the first chunk after the header*/
@@ -5009,29 +6751,70 @@ static void decodeGeneric(unsigned char** out, unsigned* w, unsigned* h,
       expected_size += lodepng_get_raw_size_idat((*w + 0), (*h + 0) >> 1, bpp);
     }
 
-    state->error = zlib_decompress(&scanlines, &scanlines_size, expected_size, idat, idatsize, &state->decoder.zlibsettings);
+    state->peak_bytes = insize + expected_size; /*the IDAT data is kept until it is inflated*/
+    state->error = zlib_decompress(&scanlines, &scanlines_size, expected_size, idat, idatsize,
+                                   &state->decoder.zlibsettings, scratch);
   }
   if(!state->error && scanlines_size != expected_size) state->error = 91; /*decompressed size doesn't match prediction*/
-  lodepng_free(idat);
+  if(!scratch || idat != scratch->zdata) lodepng_free(idat);
 
   if(!state->error) {
-    outsize = lodepng_get_raw_size(*w, *h, &state->info_png.color);
-    *out = (unsigned char*)lodepng_malloc(outsize);
-    if(!*out) state->error = 83; /*alloc fail*/
+    outsize = lodepng_get_raw_size(*w, *h, into ? intomode : &state->info_png.color);
+    if(into) {
+      if(intosize < outsize) state->error = 116; /*output buffer too small*/
+      else *out = into;
+    } else {
+      *out = (unsigned char*)lodepng_malloc(outsize);
+      if(!*out) state->error = 83; /*alloc fail*/
+    }
   }
   if(!state->error) {
-    lodepng_memset(*out, 0, outsize);
-    state->error = postProcessScanlines(*out, scanlines, *w, *h, &state->info_png);
+    if(expected_size + outsize > state->peak_bytes) state->peak_bytes = expected_size + outsize;
+    if(into && !lodepng_color_mode_equal(intomode, &state->info_png.color)) {
+      state->error = unfilterConvert(*out, intomode, scanlines, *w, *h, &state->info_png.color);
+    } else {
+      /*whole byte pixels are all written by the unfiltering, only bit packed ones are or'ed into place*/
+      if(lodepng_get_bpp(&state->info_png.color) < 8) lodepng_memset(*out, 0, outsize);
+      state->error = postProcessScanlines(*out, scanlines, *w, *h, &state->info_png);
+    }
   }
-  lodepng_free(scanlines);
+  if(!scratch || scanlines != scratch->data) lodepng_free(scanlines);
 }
 
-unsigned lodepng_decode(unsigned char** out, unsigned* w, unsigned* h,
-                        LodePNGState* state,
-                        const unsigned char* in, size_t insize) {
+/*decodes into into if not null, else into a new *out*/
+static unsigned decodeRaw(unsigned char** out, unsigned char* into, size_t intosize, unsigned* w, unsigned* h,
+                          LodePNGState* state,
+                          const unsigned char* in, size_t insize) {
+  unsigned convert = state->decoder.color_convert;
+  unsigned rowwise = 0;
   *out = 0;
-  decodeGeneric(out, w, h, state, in, insize);
+  state->peak_bytes = 0;
+  if(into) {
+    /*The pixels are unfiltered straight into place when no conversion is asked for or needed, and converted a row
+    at a time when the image isn't interlaced and the rows of into are whole bytes. Otherwise they go into a buffer
+    of the PNG's own color type first. The header decides, decodeGeneric reads it again after this.*/
+    state->error = lodepng_inspect(w, h, state, in, insize);
+    if(!state->error) {
+      convert = convert && !lodepng_color_mode_equal(&state->info_raw, &state->info_png.color);
+      if(lodepng_pixel_overflow(*w, *h, &state->info_png.color, &state->info_raw)) state->error = 92;
+      else if(intosize < lodepng_get_raw_size(*w, *h, convert ? &state->info_raw : &state->info_png.color)) {
+        state->error = 116; /*output buffer too small*/
+      } else if(convert && !(state->info_raw.colortype == LCT_RGB || state->info_raw.colortype == LCT_RGBA)
+                && !(state->info_raw.bitdepth == 8)) {
+        state->error = 56; /*unsupported color mode conversion*/
+      }
+    }
+    if(state->error) {
+      *w = *h = 0;
+      return state->error;
+    }
+    rowwise = convert && state->info_png.interlace_method == 0 && lodepng_get_bpp(&state->info_raw) % 8u == 0
+              && state->info_raw.colortype != LCT_PALETTE;
+  }
+  if(rowwise) decodeGeneric(out, into, intosize, &state->info_raw, w, h, state, in, insize);
+  else decodeGeneric(out, convert ? 0 : into, intosize, &state->info_png.color, w, h, state, in, insize);
   if(state->error) return state->error;
+  if(rowwise) return 0; /*converted already*/
   if(!state->decoder.color_convert || lodepng_color_mode_equal(&state->info_raw, &state->info_png.color)) {
     /*same color type, no copying or converting of data needed*/
     /*store the info_png color settings on the info_raw so that the info_raw still reflects what colortype
@@ -5042,6 +6825,7 @@ unsigned lodepng_decode(unsigned char** out, unsigned* w, unsigned* h,
     }
   } else { /*color conversion needed*/
     unsigned char* data = *out;
+    size_t datasize = lodepng_get_raw_size(*w, *h, &state->info_png.color);
     size_t outsize;
 
     /*TODO: check if this works according to the statement in the documentation: "The converter can convert
@@ -5050,19 +6834,175 @@ unsigned lodepng_decode(unsigned char** out, unsigned* w, unsigned* h,
        && !(state->info_raw.bitdepth == 8)) {
       return 56; /*unsupported color mode conversion*/
     }
+    /*Pixels decoded straight into into stay there. Their header modes matched, only a tRNS key or PLTE read after
+    the header tells them apart, and converting to the mode without it leaves every value as it is*/
+    if(into && data == into) return state->error;
 
     outsize = lodepng_get_raw_size(*w, *h, &state->info_raw);
-    *out = (unsigned char*)lodepng_malloc(outsize);
+    if(into) *out = into;
+    else *out = (unsigned char*)lodepng_malloc(outsize);
     if(!(*out)) {
       state->error = 83; /*alloc fail*/
     }
     else state->error = lodepng_convert(*out, data, &state->info_raw,
                                         &state->info_png.color, *w, *h);
+    if(datasize + outsize > state->peak_bytes) state->peak_bytes = datasize + outsize;
     lodepng_free(data);
   }
   return state->error;
 }
 
+unsigned lodepng_decode(unsigned char** out, unsigned* w, unsigned* h,
+                        LodePNGState* state,
+                        const unsigned char* in, size_t insize) {
+  return decodeRaw(out, 0, 0, w, h, state, in, insize);
+}
+
+unsigned lodepng_decode_into(unsigned char* out, size_t outsize, unsigned* w, unsigned* h,
+                             LodePNGState* state,
+                             const unsigned char* in, size_t insize) {
+  unsigned char* decoded = 0;
+  unsigned error = decodeRaw(&decoded, out, outsize, w, h, state, in, insize);
+  /*only a failed conversion leaves the unconverted pixels in a buffer of their own*/
+  if(decoded != out) lodepng_free(decoded);
+  return error;
+}
+
+#ifdef LODEPNG_COMPILE_ZLIB
+/*the IDAT chunks of a PNG as pieces for a ZStream*/
+typedef struct IdatSource {
+  const unsigned char* in;
+  size_t insize;
+  size_t pos; /*the next chunk*/
+  unsigned ignore_crc;
+} IdatSource;
+
+/*checks that the chunk at pos fits in the file, like decodeGeneric*/
+static unsigned checkChunk(const unsigned char* in, size_t insize, size_t pos) {
+  unsigned chunkLength;
+  if(pos + 12 > insize || pos + 12 < pos) return 30; /*error: next chunk out of bounds of the in buffer*/
+  chunkLength = lodepng_chunk_length(in + pos);
+  if(chunkLength > 2147483647) return 63; /*error: chunk length larger than the max PNG chunk size*/
+  if(pos + (size_t)chunkLength + 12 > insize) return 64; /*error: size of the in buffer too small*/
+  return 0;
+}
+
+static unsigned nextIdat(void* source, const unsigned char** piece, size_t* piecesize) {
+  IdatSource* idat = (IdatSource*)source;
+  const unsigned char* chunk = idat->in + idat->pos;
+  unsigned error = checkChunk(idat->in, idat->insize, idat->pos);
+  *piece = 0;
+  *piecesize = 0;
+  if(error) return error;
+  if(!lodepng_chunk_type_equals(chunk, "IDAT")) return 0; /*the image data is over*/
+  if(!idat->ignore_crc && lodepng_chunk_check_crc(chunk)) return 57; /*invalid CRC*/
+  *piece = lodepng_chunk_data_const(chunk);
+  *piecesize = lodepng_chunk_length(chunk);
+  idat->pos += *piecesize + 12;
+  return 0;
+}
+
+/*reads the chunks from *pos on until IEND, or the first IDAT when idat is set, which *pos is then left at*/
+static unsigned readRowChunks(LodePNGState* state, const unsigned char* in, size_t insize, size_t* pos, unsigned idat) {
+  for(;;) {
+    const unsigned char* chunk = in + *pos;
+    unsigned error = checkChunk(in, insize, *pos);
+    if(error) return (state->decoder.ignore_end && error != 64) ? 0 : error;
+    if(lodepng_chunk_type_equals(chunk, "IEND") || (idat && lodepng_chunk_type_equals(chunk, "IDAT"))) return 0;
+    /*error: unknown critical chunk (5th bit of first byte of chunk type is 0)*/
+    if(!lodepng_chunk_ancillary(chunk) && !state->decoder.ignore_critical && !lodepng_chunk_type_equals(chunk, "PLTE")
+       && !lodepng_chunk_type_equals(chunk, "IDAT")) {
+      return 69;
+    }
+    error = lodepng_inspect_chunk(state, *pos, in, insize);
+    if(error) return error;
+    *pos += lodepng_chunk_length(chunk) + 12;
+  }
+}
+
+unsigned lodepng_decode_rows(unsigned* w, unsigned* h, LodePNGState* state,
+                             const unsigned char* in, size_t insize,
+                             unsigned (*row)(void* user, unsigned y, const unsigned char* pixels), void* user) {
+  ZStream z;
+  IdatSource idat;
+  unsigned y = 0, convert = 0;
+  size_t bpp = 0, linebytes = 0, outlinebytes = 0;
+  unsigned char* lines = 0; /*the current and the previous unfiltered scanline*/
+  unsigned char* converted = 0;
+  unsigned error;
+
+  state->peak_bytes = 0;
+  idat.in = in;
+  idat.insize = insize;
+  idat.pos = 33; /*first byte of the first chunk after the header*/
+  idat.ignore_crc = state->decoder.ignore_crc;
+  error = lodepng_inspect(w, h, state, in, insize);
+  if(!error && state->info_png.interlace_method != 0) error = 117; /*only rows in order can be streamed*/
+  if(!error && lodepng_pixel_overflow(*w, *h, &state->info_png.color, &state->info_raw)) error = 92;
+  if(!error) error = readRowChunks(state, in, insize, &idat.pos, 1);
+  if(!error && state->info_png.color.colortype == LCT_PALETTE && !state->info_png.color.palette) {
+    error = 106; /* error: PNG file must have PLTE chunk if color type is palette */
+  }
+  if(!error) {
+    convert = state->decoder.color_convert && !lodepng_color_mode_equal(&state->info_raw, &state->info_png.color);
+    if(!state->decoder.color_convert) error = lodepng_color_mode_copy(&state->info_raw, &state->info_png.color);
+    else if(convert && !(state->info_raw.colortype == LCT_RGB || state->info_raw.colortype == LCT_RGBA)
+            && !(state->info_raw.bitdepth == 8)) {
+      error = 56; /*unsupported color mode conversion*/
+    }
+  }
+  if(error) {
+    *w = *h = 0;
+    return state->error = error;
+  }
+
+  bpp = lodepng_get_bpp(&state->info_png.color);
+  linebytes = lodepng_get_raw_size_idat(*w, 1, (unsigned)bpp) - 1u;
+  outlinebytes = convert ? lodepng_get_raw_size(*w, 1, &state->info_raw) : 0;
+  lines = (unsigned char*)lodepng_malloc(linebytes * 2u);
+  if(convert) converted = (unsigned char*)lodepng_malloc(outlinebytes);
+  error = zstream_init(&z, linebytes + 1u, nextIdat, &idat, &state->decoder.zlibsettings);
+  if(!error && (!lines || (convert && !converted))) error = 83; /*alloc fail*/
+  state->peak_bytes = ZSTREAM_INPUT + z.out.allocsize + linebytes * 2u + outlinebytes;
+
+  while(!error) {
+    error = zstream_fill(&z);
+    /*all the whole scanlines in the window, each with its filter type byte in front*/
+    while(!error && y < *h && z.out.size - z.taken >= linebytes + 1u) {
+      const unsigned char* scanline = z.out.data + z.taken;
+      unsigned char* line = &lines[(y & 1u) * linebytes];
+      const unsigned char* prevline = y ? &lines[((y + 1u) & 1u) * linebytes] : 0;
+      error = unfilterScanline(line, scanline + 1, prevline, (bpp + 7u) / 8u, scanline[0], linebytes);
+      if(!error && convert) error = lodepng_convert(converted, line, &state->info_raw, &state->info_png.color, *w, 1);
+      if(!error && row(user, y, convert ? converted : line)) error = 118; /*stopped by the callback*/
+      z.taken += linebytes + 1u;
+      ++y;
+    }
+    if(!error && y == *h && z.out.size != z.taken) error = 91; /*more data than the image needs*/
+    if(z.step == ZSTREAM_DONE) break;
+  }
+  if(!error && y != *h) error = 91; /*decompressed size doesn't match prediction*/
+  if(!error) error = readRowChunks(state, in, insize, &idat.pos, 0);
+
+  zstream_cleanup(&z);
+  lodepng_free(lines);
+  lodepng_free(converted);
+  return state->error = error;
+}
+#else /*no LODEPNG_COMPILE_ZLIB*/
+unsigned lodepng_decode_rows(unsigned* w, unsigned* h, LodePNGState* state,
+                             const unsigned char* in, size_t insize,
+                             unsigned (*row)(void* user, unsigned y, const unsigned char* pixels), void* user) {
+  /*the rows come from the built-in inflate, custom_zlib only works on the whole stream*/
+  (void)in;
+  (void)insize;
+  (void)row;
+  (void)user;
+  *w = *h = 0;
+  return state->error = 87;
+}
+#endif /*LODEPNG_COMPILE_ZLIB*/
+
 unsigned lodepng_decode_memory(unsigned char** out, unsigned* w, unsigned* h, const unsigned char* in,
                                size_t insize, LodePNGColorType colortype, unsigned bitdepth) {
   unsigned error;
@@ -5140,6 +7080,7 @@ void lodepng_state_init(LodePNGState* state) {
   lodepng_color_mode_init(&state->info_raw);
   lodepng_info_init(&state->info_png);
   state->error = 1;
+  state->peak_bytes = 0;
 }
 
 void lodepng_state_cleanup(LodePNGState* state) {
@@ -5559,12 +7500,13 @@ static size_t ilog2i(size_t i) {
   return i * l + ((i - (1u << l)) << 1u);
 }
 
-static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w, unsigned h,
-                       const LodePNGColorMode* color, const LodePNGEncoderSettings* settings) {
+static unsigned filterRows(unsigned char* out, const unsigned char* in, unsigned w, unsigned y0, unsigned y1,
+                           const LodePNGColorMode* color, const LodePNGEncoderSettings* settings) {
   /*
   For PNG filter method 0
   out must be a buffer with as size: h + (w * h * bpp + 7u) / 8u, because there are
   the scanlines with 1 extra byte per scanline
+  Only rows y0 up to y1 are filtered, row y0 - 1 is read as the line above the first one
   */
 
   unsigned bpp = lodepng_get_bpp(color);
@@ -5573,7 +7515,7 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
 
   /*bytewidth is used for filtering, is 1 when bpp < 8, number of bytes per pixel otherwise*/
   size_t bytewidth = (bpp + 7u) / 8u;
-  const unsigned char* prevline = 0;
+  const unsigned char* prevline = y0 == 0 ? 0 : &in[linebytes * (y0 - 1u)];
   unsigned x, y;
   unsigned error = 0;
   LodePNGFilterStrategy strategy = settings->filter_strategy;
@@ -5598,7 +7540,7 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
 
   if(strategy >= LFS_ZERO && strategy <= LFS_FOUR) {
     unsigned char type = (unsigned char)strategy;
-    for(y = 0; y != h; ++y) {
+    for(y = y0; y != y1; ++y) {
       size_t outindex = (1 + linebytes) * y; /*the extra filterbyte added to each row*/
       size_t inindex = linebytes * y;
       out[outindex] = type; /*filter type byte*/
@@ -5617,7 +7559,7 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
     }
 
     if(!error) {
-      for(y = 0; y != h; ++y) {
+      for(y = y0; y != y1; ++y) {
         /*try the 5 filter types*/
         for(type = 0; type != 5; ++type) {
           size_t sum = 0;
@@ -5664,7 +7606,7 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
     }
 
     if(!error) {
-      for(y = 0; y != h; ++y) {
+      for(y = y0; y != y1; ++y) {
         /*try the 5 filter types*/
         for(type = 0; type != 5; ++type) {
           size_t sum = 0;
@@ -5692,7 +7634,7 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
 
     for(type = 0; type != 5; ++type) lodepng_free(attempt[type]);
   } else if(strategy == LFS_PREDEFINED) {
-    for(y = 0; y != h; ++y) {
+    for(y = y0; y != y1; ++y) {
       size_t outindex = (1 + linebytes) * y; /*the extra filterbyte added to each row*/
       size_t inindex = linebytes * y;
       unsigned char type = settings->predefined_filters[y];
@@ -5720,12 +7662,16 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
     images only, so disable it*/
     zlibsettings.custom_zlib = 0;
     zlibsettings.custom_deflate = 0;
+    /*a single scanline is far too small to split up, and bands of rows filtered at the same time can't share one
+    scratch*/
+    zlibsettings.parallel_run = 0;
+    if(settings->zlibsettings.parallel_run) zlibsettings.scratch = 0;
     for(type = 0; type != 5; ++type) {
       attempt[type] = (unsigned char*)lodepng_malloc(linebytes);
       if(!attempt[type]) error = 83; /*alloc fail*/
     }
     if(!error) {
-      for(y = 0; y != h; ++y) /*try the 5 filter types*/ {
+      for(y = y0; y != y1; ++y) /*try the 5 filter types*/ {
         for(type = 0; type != 5; ++type) {
           unsigned testsize = (unsigned)linebytes;
           /*if(testsize > 8) testsize /= 8;*/ /*it already works good enough by testing a part of the row*/
@@ -5753,6 +7699,50 @@ static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w,
   return error;
 }
 
+typedef struct FilterJobs {
+  unsigned char* out;
+  const unsigned char* in;
+  unsigned w, h;
+  unsigned bandrows;
+  const LodePNGColorMode* color;
+  const LodePNGEncoderSettings* settings;
+  unsigned* errors;
+} FilterJobs;
+
+static void filterBand(void* data, size_t index) {
+  FilterJobs* jobs = (FilterJobs*)data;
+  unsigned y0 = (unsigned)index * jobs->bandrows;
+  unsigned y1 = jobs->h - y0 > jobs->bandrows ? y0 + jobs->bandrows : jobs->h;
+  jobs->errors[index] = filterRows(jobs->out, jobs->in, jobs->w, y0, y1, jobs->color, jobs->settings);
+}
+
+static unsigned filter(unsigned char* out, const unsigned char* in, unsigned w, unsigned h,
+                       const LodePNGColorMode* color, const LodePNGEncoderSettings* settings) {
+  /*every row only looks at the unfiltered row above it, so bands of rows can be filtered independently.
+  The bands are about 256KB so that small images don't get split at all.*/
+  size_t linebytes = lodepng_get_raw_size_idat(w, 1, lodepng_get_bpp(color));
+  unsigned bandrows = (unsigned)(262144u / linebytes) + 1u;
+  if(settings->zlibsettings.parallel_run && h > bandrows) {
+    unsigned error = 0;
+    size_t i, count = (h + bandrows - 1u) / bandrows;
+    FilterJobs jobs;
+    jobs.out = out;
+    jobs.in = in;
+    jobs.w = w;
+    jobs.h = h;
+    jobs.bandrows = bandrows;
+    jobs.color = color;
+    jobs.settings = settings;
+    jobs.errors = (unsigned*)lodepng_malloc(count * sizeof(unsigned));
+    if(!jobs.errors) return 83; /*alloc fail*/
+    settings->zlibsettings.parallel_run(filterBand, &jobs, count, settings->zlibsettings.parallel_context);
+    for(i = 0; i != count && !error; ++i) error = jobs.errors[i];
+    lodepng_free(jobs.errors);
+    return error;
+  }
+  return filterRows(out, in, w, 0, h, color, settings);
+}
+
 static void addPaddingBits(unsigned char* out, const unsigned char* in,
                            size_t olinebits, size_t ilinebits, unsigned h) {
   /*The opposite of the removePaddingBits function
@@ -5834,10 +7824,12 @@ static unsigned preProcessScanlines(unsigned char** out, size_t* outsize, const
   */
   unsigned bpp = lodepng_get_bpp(&info_png->color);
   unsigned error = 0;
+  LodePNGScratch* scratch = settings->zlibsettings.scratch; /*if not null, *out stays owned by it*/
 
   if(info_png->interlace_method == 0) {
     *outsize = h + (h * ((w * bpp + 7u) / 8u)); /*image size plus an extra byte per scanline + possible padding bits*/
-    *out = (unsigned char*)lodepng_malloc(*outsize);
+    if(scratch) *out = scratch_reserve(&scratch->data, &scratch->datasize, *outsize);
+    else *out = (unsigned char*)lodepng_malloc(*outsize);
     if(!(*out) && (*outsize)) error = 83; /*alloc fail*/
 
     if(!error) {
@@ -5863,7 +7855,8 @@ static unsigned preProcessScanlines(unsigned char** out, size_t* outsize, const
     Adam7_getpassvalues(passw, passh, filter_passstart, padded_passstart, passstart, w, h, bpp);
 
     *outsize = filter_passstart[7]; /*image size plus an extra byte per scanline + possible padding bits*/
-    *out = (unsigned char*)lodepng_malloc(*outsize);
+    if(scratch) *out = scratch_reserve(&scratch->data, &scratch->datasize, *outsize);
+    else *out = (unsigned char*)lodepng_malloc(*outsize);
     if(!(*out)) error = 83; /*alloc fail*/
 
     adam7 = (unsigned char*)lodepng_malloc(passstart[7]);
@@ -5929,6 +7922,147 @@ static unsigned isRGBICCProfile(const unsigned char* profile, unsigned size) {
 }
 #endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
 
+/*the signature and the chunks that go before the IDAT chunks*/
+static unsigned addChunksBeforeIdat(ucvector* out, unsigned w, unsigned h, const LodePNGInfo* info,
+                                    LodePNGEncoderSettings* settings) {
+  /*write signature and chunks*/
+  unsigned error = writeSignature(out);
+  if(error) return error;
+  /*IHDR*/
+  error = addChunk_IHDR(out, w, h, info->color.colortype, info->color.bitdepth, info->interlace_method);
+  if(error) return error;
+#ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
+  /*unknown chunks between IHDR and PLTE*/
+  if(info->unknown_chunks_data[0]) {
+    error = addUnknownChunks(out, info->unknown_chunks_data[0], info->unknown_chunks_size[0]);
+    if(error) return error;
+  }
+  /*color profile chunks must come before PLTE */
+  if(info->iccp_defined) {
+    error = addChunk_iCCP(out, info, &settings->zlibsettings);
+    if(error) return error;
+  }
+  if(info->srgb_defined) {
+    error = addChunk_sRGB(out, info);
+    if(error) return error;
+  }
+  if(info->gama_defined) {
+    error = addChunk_gAMA(out, info);
+    if(error) return error;
+  }
+  if(info->chrm_defined) {
+    error = addChunk_cHRM(out, info);
+    if(error) return error;
+  }
+  if(info->sbit_defined) {
+    error = addChunk_sBIT(out, info);
+    if(error) return error;
+  }
+#endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
+  /*PLTE*/
+  if(info->color.colortype == LCT_PALETTE) {
+    error = addChunk_PLTE(out, &info->color);
+    if(error) return error;
+  }
+  if(settings->force_palette && (info->color.colortype == LCT_RGB || info->color.colortype == LCT_RGBA)) {
+    /*force_palette means: write suggested palette for truecolor in PLTE chunk*/
+    error = addChunk_PLTE(out, &info->color);
+    if(error) return error;
+  }
+  /*tRNS (this will only add if when necessary) */
+  error = addChunk_tRNS(out, &info->color);
+  if(error) return error;
+#ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
+  /*bKGD (must come between PLTE and the IDAt chunks*/
+  if(info->background_defined) {
+    error = addChunk_bKGD(out, info);
+    if(error) return error;
+  }
+  /*pHYs (must come before the IDAT chunks)*/
+  if(info->phys_defined) {
+    error = addChunk_pHYs(out, info);
+    if(error) return error;
+  }
+
+  /*unknown chunks between PLTE and IDAT*/
+  if(info->unknown_chunks_data[1]) {
+    error = addUnknownChunks(out, info->unknown_chunks_data[1], info->unknown_chunks_size[1]);
+    if(error) return error;
+  }
+#endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
+  return 0;
+}
+
+/*the chunks that go after the IDAT chunks, IEND included*/
+static unsigned addChunksAfterIdat(ucvector* out, const LodePNGInfo* info, LodePNGEncoderSettings* settings) {
+#ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
+  unsigned error;
+  size_t i;
+  /*tIME*/
+  if(info->time_defined) {
+    error = addChunk_tIME(out, &info->time);
+    if(error) return error;
+  }
+  /*tEXt and/or zTXt*/
+  for(i = 0; i != info->text_num; ++i) {
+    if(lodepng_strlen(info->text_keys[i]) > 79) {
+      return 66; /*text chunk too large*/
+    }
+    if(lodepng_strlen(info->text_keys[i]) < 1) {
+      return 67; /*text chunk too small*/
+    }
+    if(settings->text_compression) {
+      error = addChunk_zTXt(out, info->text_keys[i], info->text_strings[i], &settings->zlibsettings);
+      if(error) return error;
+    } else {
+      error = addChunk_tEXt(out, info->text_keys[i], info->text_strings[i]);
+      if(error) return error;
+    }
+  }
+  /*LodePNG version id in text chunk*/
+  if(settings->add_id) {
+    unsigned already_added_id_text = 0;
+    for(i = 0; i != info->text_num; ++i) {
+      const char* k = info->text_keys[i];
+      /* Could use strcmp, but we're not calling or reimplementing this C library function for this use only */
+      if(k[0] == 'L' && k[1] == 'o' && k[2] == 'd' && k[3] == 'e' &&
+         k[4] == 'P' && k[5] == 'N' && k[6] == 'G' && k[7] == '\0') {
+        already_added_id_text = 1;
+        break;
+      }
+    }
+    if(already_added_id_text == 0) {
+      error = addChunk_tEXt(out, "LodePNG", LODEPNG_VERSION_STRING); /*it's shorter as tEXt than as zTXt chunk*/
+      if(error) return error;
+    }
+  }
+  /*iTXt*/
+  for(i = 0; i != info->itext_num; ++i) {
+    if(lodepng_strlen(info->itext_keys[i]) > 79) {
+      return 66; /*text chunk too large*/
+    }
+    if(lodepng_strlen(info->itext_keys[i]) < 1) {
+      return 67; /*text chunk too small*/
+    }
+    error = addChunk_iTXt(
+        out, settings->text_compression,
+        info->itext_keys[i], info->itext_langtags[i], info->itext_transkeys[i], info->itext_strings[i],
+        &settings->zlibsettings);
+    if(error) return error;
+  }
+
+  /*unknown chunks between IDAT and IEND*/
+  if(info->unknown_chunks_data[2]) {
+    error = addUnknownChunks(out, info->unknown_chunks_data[2], info->unknown_chunks_size[2]);
+    if(error) return error;
+  }
+#else /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
+  (void)info;
+  (void)settings;
+#endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
+  return addChunk_IEND(out);
+}
+
 unsigned lodepng_encode(unsigned char** out, size_t* outsize,
                         const unsigned char* image, unsigned w, unsigned h,
                         LodePNGState* state) {
@@ -6112,149 +8246,17 @@ unsigned lodepng_encode(unsigned char** out, size_t* outsize,
     if(state->error) goto cleanup;
   }
 
-  /* output all PNG chunks */ {
-#ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
-    size_t i;
-#endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
-    /*write signature and chunks*/
-    state->error = writeSignature(&outv);
-    if(state->error) goto cleanup;
-    /*IHDR*/
-    state->error = addChunk_IHDR(&outv, w, h, info.color.colortype, info.color.bitdepth, info.interlace_method);
-    if(state->error) goto cleanup;
-#ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
-    /*unknown chunks between IHDR and PLTE*/
-    if(info.unknown_chunks_data[0]) {
-      state->error = addUnknownChunks(&outv, info.unknown_chunks_data[0], info.unknown_chunks_size[0]);
-      if(state->error) goto cleanup;
-    }
-    /*color profile chunks must come before PLTE */
-    if(info.iccp_defined) {
-      state->error = addChunk_iCCP(&outv, &info, &state->encoder.zlibsettings);
-      if(state->error) goto cleanup;
-    }
-    if(info.srgb_defined) {
-      state->error = addChunk_sRGB(&outv, &info);
-      if(state->error) goto cleanup;
-    }
-    if(info.gama_defined) {
-      state->error = addChunk_gAMA(&outv, &info);
-      if(state->error) goto cleanup;
-    }
-    if(info.chrm_defined) {
-      state->error = addChunk_cHRM(&outv, &info);
-      if(state->error) goto cleanup;
-    }
-    if(info_png->sbit_defined) {
-      state->error = addChunk_sBIT(&outv, &info);
-      if(state->error) goto cleanup;
-    }
-#endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
-    /*PLTE*/
-    if(info.color.colortype == LCT_PALETTE) {
-      state->error = addChunk_PLTE(&outv, &info.color);
-      if(state->error) goto cleanup;
-    }
-    if(state->encoder.force_palette && (info.color.colortype == LCT_RGB || info.color.colortype == LCT_RGBA)) {
-      /*force_palette means: write suggested palette for truecolor in PLTE chunk*/
-      state->error = addChunk_PLTE(&outv, &info.color);
-      if(state->error) goto cleanup;
-    }
-    /*tRNS (this will only add if when necessary) */
-    state->error = addChunk_tRNS(&outv, &info.color);
-    if(state->error) goto cleanup;
-#ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
-    /*bKGD (must come between PLTE and the IDAt chunks*/
-    if(info.background_defined) {
-      state->error = addChunk_bKGD(&outv, &info);
-      if(state->error) goto cleanup;
-    }
-    /*pHYs (must come before the IDAT chunks)*/
-    if(info.phys_defined) {
-      state->error = addChunk_pHYs(&outv, &info);
-      if(state->error) goto cleanup;
-    }
-
-    /*unknown chunks between PLTE and IDAT*/
-    if(info.unknown_chunks_data[1]) {
-      state->error = addUnknownChunks(&outv, info.unknown_chunks_data[1], info.unknown_chunks_size[1]);
-      if(state->error) goto cleanup;
-    }
-#endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
-    /*IDAT (multiple IDAT chunks must be consecutive)*/
-    state->error = addChunk_IDAT(&outv, data, datasize, &state->encoder.zlibsettings);
-    if(state->error) goto cleanup;
-#ifdef LODEPNG_COMPILE_ANCILLARY_CHUNKS
-    /*tIME*/
-    if(info.time_defined) {
-      state->error = addChunk_tIME(&outv, &info.time);
-      if(state->error) goto cleanup;
-    }
-    /*tEXt and/or zTXt*/
-    for(i = 0; i != info.text_num; ++i) {
-      if(lodepng_strlen(info.text_keys[i]) > 79) {
-        state->error = 66; /*text chunk too large*/
-        goto cleanup;
-      }
-      if(lodepng_strlen(info.text_keys[i]) < 1) {
-        state->error = 67; /*text chunk too small*/
-        goto cleanup;
-      }
-      if(state->encoder.text_compression) {
-        state->error = addChunk_zTXt(&outv, info.text_keys[i], info.text_strings[i], &state->encoder.zlibsettings);
-        if(state->error) goto cleanup;
-      } else {
-        state->error = addChunk_tEXt(&outv, info.text_keys[i], info.text_strings[i]);
-        if(state->error) goto cleanup;
-      }
-    }
-    /*LodePNG version id in text chunk*/
-    if(state->encoder.add_id) {
-      unsigned already_added_id_text = 0;
-      for(i = 0; i != info.text_num; ++i) {
-        const char* k = info.text_keys[i];
-        /* Could use strcmp, but we're not calling or reimplementing this C library function for this use only */
-        if(k[0] == 'L' && k[1] == 'o' && k[2] == 'd' && k[3] == 'e' &&
-           k[4] == 'P' && k[5] == 'N' && k[6] == 'G' && k[7] == '\0') {
-          already_added_id_text = 1;
-          break;
-        }
-      }
-      if(already_added_id_text == 0) {
-        state->error = addChunk_tEXt(&outv, "LodePNG", LODEPNG_VERSION_STRING); /*it's shorter as tEXt than as zTXt chunk*/
-        if(state->error) goto cleanup;
-      }
-    }
-    /*iTXt*/
-    for(i = 0; i != info.itext_num; ++i) {
-      if(lodepng_strlen(info.itext_keys[i]) > 79) {
-        state->error = 66; /*text chunk too large*/
-        goto cleanup;
-      }
-      if(lodepng_strlen(info.itext_keys[i]) < 1) {
-        state->error = 67; /*text chunk too small*/
-        goto cleanup;
-      }
-      state->error = addChunk_iTXt(
-          &outv, state->encoder.text_compression,
-          info.itext_keys[i], info.itext_langtags[i], info.itext_transkeys[i], info.itext_strings[i],
-          &state->encoder.zlibsettings);
-      if(state->error) goto cleanup;
-    }
-
-    /*unknown chunks between IDAT and IEND*/
-    if(info.unknown_chunks_data[2]) {
-      state->error = addUnknownChunks(&outv, info.unknown_chunks_data[2], info.unknown_chunks_size[2]);
-      if(state->error) goto cleanup;
-    }
-#endif /*LODEPNG_COMPILE_ANCILLARY_CHUNKS*/
-    state->error = addChunk_IEND(&outv);
-    if(state->error) goto cleanup;
-  }
+  /* output all PNG chunks */
+  state->error = addChunksBeforeIdat(&outv, w, h, &info, &state->encoder);
+  if(state->error) goto cleanup;
+  /*IDAT (multiple IDAT chunks must be consecutive)*/
+  state->error = addChunk_IDAT(&outv, data, datasize, &state->encoder.zlibsettings);
+  if(state->error) goto cleanup;
+  state->error = addChunksAfterIdat(&outv, &info, &state->encoder);
 
 cleanup:
   lodepng_info_cleanup(&info);
-  lodepng_free(data);
+  if(!state->encoder.zlibsettings.scratch || data != state->encoder.zlibsettings.scratch->data) lodepng_free(data);
   lodepng_color_mode_cleanup(&auto_color);
 
   /*instead of cleaning the vector up, give it to the output*/
@@ -6264,6 +8266,171 @@ cleanup:
   return state->error;
 }
 
+#ifdef LODEPNG_COMPILE_ZLIB
+struct LodePNGRowEncoder {
+  LodePNGState* state;
+  unsigned w, h;
+  unsigned y; /*rows pushed so far*/
+  size_t linebytes;
+  unsigned char* lines; /*the row before and this one in the PNG's color type, back to back*/
+  unsigned char* filtered; /*room for two scanlines, the second is the filtered one*/
+  ZWriter z;
+  size_t chunksize;
+  ucvector chunks; /*chunks to write*/
+  unsigned (*write)(void* user, const unsigned char* data, size_t size);
+  void* user;
+  unsigned error; /*the first error, every call after it returns it again*/
+};
+
+static unsigned writeRowChunks(LodePNGRowEncoder* encoder) {
+  unsigned error = encoder->write(encoder->user, encoder->chunks.data, encoder->chunks.size) ? 120 : 0;
+  encoder->chunks.size = 0;
+  return error;
+}
+
+/*writes the zlib data out as IDAT chunks of chunksize bytes, and what's left too if all is set*/
+static unsigned writeRowIdat(LodePNGRowEncoder* encoder, unsigned all) {
+  unsigned error = 0;
+  size_t pos = 0;
+  ucvector* z = &encoder->z.out;
+  while(!error && (z->size - pos >= encoder->chunksize || (all && pos < z->size))) {
+    size_t size = z->size - pos < encoder->chunksize ? z->size - pos : encoder->chunksize;
+    error = lodepng_chunk_createv(&encoder->chunks, size, "IDAT", z->data + pos);
+    if(!error) error = writeRowChunks(encoder);
+    pos += size;
+  }
+  lodepng_memmove(z->data, z->data + pos, z->size - pos);
+  z->size -= pos;
+  return error;
+}
+
+unsigned lodepng_row_encoder_new(LodePNGRowEncoder** out, unsigned w, unsigned h, LodePNGState* state,
+                                 size_t chunksize,
+                                 unsigned (*write)(void* user, const unsigned char* data, size_t size), void* user) {
+  LodePNGRowEncoder* encoder;
+  const LodePNGInfo* info_png = &state->info_png;
+  unsigned error = 0;
+
+  *out = 0;
+  /*the same checks as lodepng_encode, and a size it can write a header for*/
+  if(w == 0 || h == 0) error = 93; /*zero width or height is invalid*/
+  else if((info_png->color.colortype == LCT_PALETTE || state->encoder.force_palette)
+          && (info_png->color.palettesize == 0 || info_png->color.palettesize > 256)) {
+    error = 68; /*invalid palette size, it is only allowed to be 1-256*/
+  } else if(state->encoder.zlibsettings.btype > 2) error = 61; /*error: invalid btype*/
+  else if(info_png->interlace_method != 0) error = 117; /*the rows arrive in order*/
+  else if(chunksize > 2147483647u) error = 77; /*chunk too large*/
+  if(!error) error = checkColorValidity(info_png->color.colortype, info_png->color.bitdepth);
+  if(!error) error = checkColorValidity(state->info_raw.colortype, state->info_raw.bitdepth);
+  /*two scanlines of up to 8 bytes per pixel, with room to spare*/
+  if(!error && ((size_t)w * 32u) / 32u != w) error = 92; /*overflow possible due to amount of pixels*/
+  if(error) return state->error = error;
+
+  encoder = (LodePNGRowEncoder*)lodepng_malloc(sizeof(LodePNGRowEncoder));
+  if(!encoder) return state->error = 83; /*alloc fail*/
+  encoder->state = state;
+  encoder->w = w;
+  encoder->h = h;
+  encoder->y = 0;
+  encoder->linebytes = lodepng_get_raw_size_idat(w, 1, lodepng_get_bpp(&info_png->color)) - 1u;
+  encoder->lines = (unsigned char*)lodepng_malloc(encoder->linebytes * 2u);
+  encoder->filtered = (unsigned char*)lodepng_malloc((encoder->linebytes + 1u) * 2u);
+  encoder->chunksize = chunksize ? chunksize : 65536u;
+  encoder->chunks = ucvector_init(NULL, 0);
+  encoder->write = write;
+  encoder->user = user;
+  encoder->error = zwriter_init(&encoder->z, &state->encoder.zlibsettings);
+  *out = encoder;
+  if(!encoder->error && (!encoder->lines || !encoder->filtered)) encoder->error = 83; /*alloc fail*/
+
+  /*everything up to the image data goes out right away*/
+  if(!encoder->error) encoder->error = addChunksBeforeIdat(&encoder->chunks, w, h, info_png, &state->encoder);
+  if(!encoder->error) encoder->error = writeRowChunks(encoder);
+  return state->error = encoder->error;
+}
+
+unsigned lodepng_row_encoder_push(LodePNGRowEncoder* encoder, const unsigned char* row) {
+  LodePNGState* state = encoder->state;
+  unsigned char* line = encoder->lines + encoder->linebytes;
+  unsigned char* scanline = encoder->filtered + encoder->linebytes + 1u;
+  LodePNGEncoderSettings settings = state->encoder;
+  unsigned error = encoder->error;
+
+  if(!error && encoder->y == encoder->h) error = 119; /*more rows than the height*/
+  if(!error) {
+    /*the row pushed before is the one above this one*/
+    lodepng_memcpy(encoder->lines, line, encoder->linebytes);
+    if(lodepng_color_mode_equal(&state->info_raw, &state->info_png.color)) {
+      lodepng_memcpy(line, row, encoder->linebytes);
+    } else {
+      error = lodepng_convert(line, row, &state->info_png.color, &state->info_raw, encoder->w, 1);
+    }
+  }
+  if(!error) {
+    /*filterRows works with row numbers in a whole image, here that's one row, or this row below the one before*/
+    if(encoder->y == 0) {
+      error = filterRows(scanline, line, encoder->w, 0, 1, &state->info_png.color, &settings);
+    } else {
+      if(settings.predefined_filters) settings.predefined_filters += encoder->y - 1u;
+      error = filterRows(encoder->filtered, encoder->lines, encoder->w, 1, 2, &state->info_png.color, &settings);
+    }
+  }
+  if(!error) error = zwriter_add(&encoder->z, scanline, encoder->linebytes + 1u);
+  if(!error) error = writeRowIdat(encoder, 0);
+  if(!error) ++encoder->y;
+  encoder->error = error;
+  return state->error = error;
+}
+
+unsigned lodepng_row_encoder_finish(LodePNGRowEncoder* encoder) {
+  unsigned error = encoder->error;
+  if(!error && encoder->y != encoder->h) error = 119; /*fewer rows than the height*/
+  if(!error) error = zwriter_finish(&encoder->z);
+  if(!error) error = writeRowIdat(encoder, 1);
+  if(!error) error = addChunksAfterIdat(&encoder->chunks, &encoder->state->info_png, &encoder->state->encoder);
+  if(!error) error = writeRowChunks(encoder);
+  encoder->error = error ? error : 119; /*finished, no more rows*/
+  return encoder->state->error = error;
+}
+
+void lodepng_row_encoder_delete(LodePNGRowEncoder* encoder) {
+  if(!encoder) return;
+  zwriter_cleanup(&encoder->z);
+  lodepng_free(encoder->lines);
+  lodepng_free(encoder->filtered);
+  lodepng_free(encoder->chunks.data);
+  lodepng_free(encoder);
+}
+#else /*no LODEPNG_COMPILE_ZLIB*/
+/*the rows go through the built-in deflate, custom_zlib only works on the whole stream*/
+unsigned lodepng_row_encoder_new(LodePNGRowEncoder** out, unsigned w, unsigned h, LodePNGState* state,
+                                 size_t chunksize,
+                                 unsigned (*write)(void* user, const unsigned char* data, size_t size), void* user) {
+  (void)w;
+  (void)h;
+  (void)chunksize;
+  (void)write;
+  (void)user;
+  *out = 0;
+  return state->error = 87;
+}
+
+unsigned lodepng_row_encoder_push(LodePNGRowEncoder* encoder, const unsigned char* row) {
+  (void)encoder;
+  (void)row;
+  return 87;
+}
+
+unsigned lodepng_row_encoder_finish(LodePNGRowEncoder* encoder) {
+  (void)encoder;
+  return 87;
+}
+
+void lodepng_row_encoder_delete(LodePNGRowEncoder* encoder) {
+  (void)encoder;
+}
+#endif /*LODEPNG_COMPILE_ZLIB*/
+
 unsigned lodepng_encode_memory(unsigned char** out, size_t* outsize, const unsigned char* image,
                                unsigned w, unsigned h, LodePNGColorType colortype, unsigned bitdepth) {
   unsigned error;
@@ -6452,6 +8619,11 @@ const char* lodepng_error_text(unsigned code) {
     case 113: return "ICC profile unreasonably large";
     case 114: return "sBIT chunk has wrong size for the color type of the image";
     case 115: return "sBIT value out of range";
+    case 116: return "output buffer given to the decoder is too small for the image";
+    case 117: return "rows can only be streamed in or out of images that are not interlaced";
+    case 118: return "the row callback stopped the decoder";
+    case 119: return "the row encoder was given more or fewer rows than the image height";
+    case 120: return "the row encoder's write function failed";
   }
   return "unknown error code";
 }
@@ -6486,7 +8658,7 @@ unsigned decompress(std::vector<unsigned char>& out, const unsigned char* in, si
                     const LodePNGDecompressSettings& settings) {
   unsigned char* buffer = 0;
   size_t buffersize = 0;
-  unsigned error = zlib_decompress(&buffer, &buffersize, 0, in, insize, &settings);
+  unsigned error = zlib_decompress(&buffer, &buffersize, 0, in, insize, &settings, 0);
   if(buffer) {
     out.insert(out.end(), &buffer[0], &buffer[buffersize]);
     lodepng_free(buffer);
@@ -305,6 +305,26 @@ unsigned encode(const std::string& filename,
 const char* lodepng_error_text(unsigned code);
 #endif /*LODEPNG_COMPILE_ERROR_TEXT*/
 
+#if defined(LODEPNG_COMPILE_DECODER) || defined(LODEPNG_COMPILE_ENCODER)
+/*
+Memory kept from one encode or decode to the next, so that a program going through many images doesn't allocate
+and initialize the same big buffers for each of them. Point the scratch member of the zlib settings at one (for PNG
+that is state->decoder.zlibsettings or state->encoder.zlibsettings) and the buffers grow to the biggest image seen
+and are reused after that. A scratch must not be used by two encodes or decodes at the same time.
+*/
+typedef struct LodePNGScratch {
+  unsigned char* data; /*scanlines: filtered ones to deflate when encoding, inflated ones to unfilter when decoding*/
+  size_t datasize; /*allocated size of data*/
+  unsigned char* zdata; /*the deflate output when encoding, the joined IDAT chunks when decoding*/
+  size_t zdatasize; /*allocated size of zdata*/
+  void* hash; /*the deflate hash chains and LZ77 symbol buffer, for the biggest window used so far*/
+} LodePNGScratch;
+
+void lodepng_scratch_init(LodePNGScratch* scratch);
+/*frees all the buffers, the scratch can be used again afterwards*/
+void lodepng_scratch_cleanup(LodePNGScratch* scratch);
+#endif /*LODEPNG_COMPILE_DECODER || LODEPNG_COMPILE_ENCODER*/
+
 #ifdef LODEPNG_COMPILE_DECODER
 /*Settings for zlib decompression*/
 typedef struct LodePNGDecompressSettings LodePNGDecompressSettings;
@@ -333,6 +353,9 @@ struct LodePNGDecompressSettings {
                              const LodePNGDecompressSettings*);
 
   const void* custom_context; /*optional custom settings for custom functions*/
+
+  /*buffers reused between decodes (default: null), the PNG decoder keeps the IDAT data and scanlines in it*/
+  LodePNGScratch* scratch;
 };
 
 extern const LodePNGDecompressSettings lodepng_default_decompress_settings;
@@ -366,6 +389,19 @@ struct LodePNGCompressSettings /*deflate = compress*/ {
                              const LodePNGCompressSettings*);
 
   const void* custom_context; /*optional custom settings for custom functions*/
+
+  /*Runs independent parts of the encoding concurrently (default: null). lodepng starts no threads itself:
+  parallel_run must call job(data, i) once for every i below count, from whichever threads it likes, and only
+  return once they have all finished. Scanlines are filtered in bands of rows, and deflate is split into pieces
+  that each see the window before them and end in a sync flush, so the result is still one standard zlib stream,
+  a few bytes per piece larger than the serial one. Not used when custom_zlib or custom_deflate is set.*/
+  void (*parallel_run)(void (*job)(void* data, size_t index), void* data, size_t count,
+                       const void* parallel_context);
+  const void* parallel_context; /*passed on to parallel_run*/
+
+  /*buffers reused between encodes (default: null): the deflate hash chains and output, and the PNG encoder's
+  filtered scanlines. Pieces encoded through parallel_run use their own memory.*/
+  LodePNGScratch* scratch;
 };
 
 extern const LodePNGCompressSettings lodepng_default_compress_settings;
@@ -862,6 +898,9 @@ typedef struct LodePNGState {
   LodePNGColorMode info_raw; /*specifies the format in which you would like to get the raw pixel buffer*/
   LodePNGInfo info_png; /*info of the PNG image obtained after decoding*/
   unsigned error;
+  /*after decoding: the most bytes the decoder's buffers took up at the same time, counting the output image but
+  not the input file*/
+  size_t peak_bytes;
 } LodePNGState;
 
 /*init, cleanup and copy functions to use with this struct*/
@@ -879,6 +918,27 @@ unsigned lodepng_decode(unsigned char** out, unsigned* w, unsigned* h,
                         LodePNGState* state,
                         const unsigned char* in, size_t insize);
 
+/*
+Same as lodepng_decode, but into memory the caller owns: out must hold at least
+lodepng_get_raw_size(w, h, &state->info_raw) bytes (the info_png color mode instead if color_convert is off),
+use lodepng_inspect to get w and h first. When the PNG already has the requested color mode the pixels are
+unfiltered straight into out, without a conversion or another full size buffer. Error 116 if out is too small.
+*/
+unsigned lodepng_decode_into(unsigned char* out, size_t outsize, unsigned* w, unsigned* h,
+                             LodePNGState* state,
+                             const unsigned char* in, size_t insize);
+
+/*
+Decodes a PNG a row at a time, for images too big to have in memory: the image data is inflated through a 32KB
+window and two scanlines, so the memory used grows with the width only. row is called for every row from the top
+with its pixels in the state->info_raw color mode (the info_png one if color_convert is off), valid until it returns.
+A nonzero return from row stops the decoding with error 118. Only non-interlaced images, error 117 otherwise.
+Unlike lodepng_decode, custom_zlib, custom_inflate, max_output_size and remember_unknown_chunks are not used.
+*/
+unsigned lodepng_decode_rows(unsigned* w, unsigned* h, LodePNGState* state,
+                             const unsigned char* in, size_t insize,
+                             unsigned (*row)(void* user, unsigned y, const unsigned char* pixels), void* user);
+
 /*
 Read the PNG header, but not the actual data. This returns only the information
 that is in the IHDR chunk of the PNG, such as width, height and color type. The
@@ -909,6 +969,26 @@ unsigned lodepng_inspect_chunk(LodePNGState* state, size_t pos,
 unsigned lodepng_encode(unsigned char** out, size_t* outsize,
                         const unsigned char* image, unsigned w, unsigned h,
                         LodePNGState* state);
+
+/*
+Encodes a PNG from rows pushed one at a time, for images that are never in memory whole. Every row is filtered and
+deflated as it comes, and the PNG goes to write as it is made, in IDAT chunks of chunksize bytes (0 for 64KB). So
+the memory used is a few hundred KB plus two rows, whatever the height, or about 4MB with parallel_run, which
+deflates 16 pieces of 256KB at a time into the same stream. write returns nonzero on failure, which stops the encoder with error 120.
+The rows are in the state->info_raw color mode, each starting on a whole byte, and go into the PNG in the
+info_png color mode as it is given: auto_convert needs all pixels up front and is not used, neither are
+custom_zlib and custom_deflate. Only non-interlaced images, error 117 otherwise.
+Use: lodepng_row_encoder_new, h times lodepng_row_encoder_push, lodepng_row_encoder_finish, which writes the
+rest of the file, then lodepng_row_encoder_delete, also after an error. The state must outlive the encoder. After
+an error every call returns it again, pushing more or fewer than h rows is error 119.
+*/
+typedef struct LodePNGRowEncoder LodePNGRowEncoder;
+unsigned lodepng_row_encoder_new(LodePNGRowEncoder** encoder, unsigned w, unsigned h, LodePNGState* state,
+                                 size_t chunksize,
+                                 unsigned (*write)(void* user, const unsigned char* data, size_t size), void* user);
+unsigned lodepng_row_encoder_push(LodePNGRowEncoder* encoder, const unsigned char* row);
+unsigned lodepng_row_encoder_finish(LodePNGRowEncoder* encoder);
+void lodepng_row_encoder_delete(LodePNGRowEncoder* encoder);
 #endif /*LODEPNG_COMPILE_ENCODER*/
 
 /*
@@ -1072,6 +1152,27 @@ to handle such files and decode in-memory.
 */
 unsigned lodepng_load_file(unsigned char** out, size_t* outsize, const char* filename);
 
+/*
+Gives the contents of a file without copying them, for reading a file once from front to back. Where there is mmap,
+or MapViewOfFile on Windows, the file is mapped read-only and the pages are hinted to be read in order, they are
+shared with the page cache and any other process reading the same file. Elsewhere, or for files that can't be
+mapped (empty ones, pipes), it is loaded with lodepng_load_file instead, and the caller doesn't need to know which
+happened.
+file: output parameter, data and size are the contents, valid until lodepng_unmap_file
+return value: error code (0 means ok), give the file back with lodepng_unmap_file either way
+
+NOTE: a mapped file that is truncated by someone else while in use can crash the reader (SIGBUS), pass
+-DLODEPNG_NO_MMAP to the compiler to always load files instead. Windows doesn't let a mapped file be truncated.
+*/
+typedef struct LodePNGMappedFile {
+  const unsigned char* data;
+  size_t size;
+  unsigned mapped; /*1 if data is a mapping, 0 if it was loaded*/
+} LodePNGMappedFile;
+
+unsigned lodepng_map_file(LodePNGMappedFile* file, const char* filename);
+void lodepng_unmap_file(LodePNGMappedFile* file);
+
 /*
 Save a file from buffer to disk. Warning, if it exists, this function overwrites
 the file without warning!
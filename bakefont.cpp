@@ -0,0 +1,26 @@
+#include "./Graphics/Font.h"
+#include <iostream>
+
+//Bakes font.png into Graphics/FontData.h so stresscalc doesn't have to decode and crop it at startup
+//	bakefont ./font.png > ./Graphics/FontData.h
+int main(int argc, char ** argv){
+	if (argc < 2){
+		std::cerr << "Usage: bakefont font.png" << std::endl;
+		return 255;
+	}
+	
+	//Only the unscaled glyphs are baked, FontSource makes the other sizes from them
+	Font source(argv[1]);
+	if (source.height() <= 0){
+		std::cerr << "Couldn't load " << argv[1] << std::endl;
+		return 1;
+	}
+	
+	std::cout << "//Generated by bakefont from font.png, don't edit by hand" << std::endl;
+	std::cout << "#ifndef FONTDATA_H" << std::endl;
+	std::cout << "#define FONTDATA_H" << std::endl << std::endl;
+	std::cout << "#include \"./Font.h\"" << std::endl << std::endl;
+	source.bake(std::cout, "FontData_Source");
+	std::cout << std::endl << "#endif" << std::endl;
+	return 0;
+}
@@ -0,0 +1,5 @@
+x86_64-w64-mingw32-g++.exe ./Checks/blendcheck.cpp -Wall -Wextra -pedantic -O2 -o ./Checks/blendcheck.exe && ./Checks/blendcheck.exe
+x86_64-w64-mingw32-g++.exe ./Checks/inflatebench.cpp ./Graphics/lodepng.cpp -Wall -Wextra -pedantic -O2 -o ./Checks/inflatebench.exe && ./Checks/inflatebench.exe ./Graphics/lodepng.cpp
+x86_64-w64-mingw32-g++.exe ./Checks/inflatebench.cpp ./Graphics/lodepng.cpp -DLODEPNG_NO_FAST_INFLATE -Wall -Wextra -pedantic -O2 -o ./Checks/inflatebench_regular.exe && ./Checks/inflatebench_regular.exe ./Graphics/lodepng.cpp
+x86_64-w64-mingw32-g++.exe ./Checks/decodecheck.cpp ./Graphics/lodepng.cpp -Wall -Wextra -pedantic -O2 -o ./Checks/decodecheck.exe && ./Checks/decodecheck.exe
+x86_64-w64-mingw32-g++.exe ./Checks/plotbench.cpp ./Graphics/lodepng.cpp -Wall -Wextra -pedantic -O2 -o ./Checks/plotbench.exe && ./Checks/plotbench.exe
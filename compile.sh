@@ -1 +1,2 @@
+x86_64-w64-mingw32-g++.exe ./bakefont.cpp ./Graphics/lodepng.cpp -Wall -Wextra -pedantic -O2 -o ./bakefont.exe && ./bakefont.exe ./font.png > ./Graphics/FontData.h
 x86_64-w64-mingw32-g++.exe -mwindows ./stresscalc.cpp ./Graphics/lodepng.cpp  -Wall -Wextra -pedantic -static -O3 -o ./stresscalc.exe
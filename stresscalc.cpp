@@ -1,5 +1,7 @@
 #include "./Graphics/Image.h"
 #include "./Graphics/Font.h"
+#include "./Graphics/FontData.h"
+#include "./Graphics/DrawList.h"
 #include "./Utils/Shell.h"
 #include <cmath>
 #include <cassert>
@@ -15,8 +17,21 @@
 	#define DEBUG_PLOT_CODE(x)
 #endif
 
-Font font(Shell::getSelfExecutableDir() + "font.png", -1, -1, false, 0.5f);
-Font bigfont(Shell::getSelfExecutableDir() + "font.png", -1, -1, false, 1.0f);
+//Fonts come from the tables bakefont made out of font.png, and are only unpacked and scaled the first time they're used
+FontSource & fontSource(){
+	static FontSource source(FontData_Source);
+	return source;
+}
+
+Font & font(){
+	static std::shared_ptr<Font> f = fontSource().at(0.5f);
+	return *f;
+}
+
+Font & bigfont(){
+	static std::shared_ptr<Font> f = fontSource().at(1.0f);
+	return *f;
+}
 
 inline double catenary(double x, double a) {
     return a * cosh(x / a);
@@ -39,6 +54,25 @@ double getAForWidth(double width, int height){  //Brute force solver
 	return 0;
 }
 
+//The same a solved with Newton's method, exact and a few iterations long, for curves that are only looked at.  plot
+//keeps to getAForWidth since the stress search depends on its exact pixels.  With u = halfWidth / a the arch needs
+//(cosh(u) - 1) / u = height / halfWidth, which rises and bends upward, so from above the root each step comes down
+//toward it without passing it
+double solveAForWidth(double width, int height){
+	const double halfWidth = width / 2.0;
+	if (!(halfWidth > 0.0) || height <= 0) return 0;
+	const double k = static_cast<double>(height) / halfWidth;
+	double u = std::min(2.0 * k, 2.0 * log(2.0 * k + 2.0) + 2.0);  //Both are past the root
+	for(int i = 0; i < 100; ++i){
+		const double half = sinh(u / 2.0);
+		const double rise = 2.0 * half * half;  //cosh(u) - 1 without the cancellation
+		const double next = u - (rise / u - k) * (u * u) / (u * sinh(u) - rise);
+		if (!(next < u)) break;  //As close as doubles get
+		u = next;
+	}
+	return halfWidth / u;
+}
+
 
 void plot(const std::pair<int, int> & point, double midPointOfArch, double topOfArch, Image & testImage, uint32_t col){
 	//std::cout << "Plotting " << x1 << ", " << x2 << ", " << topOfArch << ", " << bottomOfArch << std::endl;
@@ -49,22 +83,100 @@ void plot(const std::pair<int, int> & point, double midPointOfArch, double topOf
 	double a = getAForWidth(width, height);
 	DEBUG_PLOT_MSG("W: " << width << ", H: " << height << ", a: " << a);
 	double yAdjust = catenary(0.0, a);
-	double yLast = topOfArch;
-    for (int x = 0; x <= static_cast<int>(width / 2.0); ++x) {
-        double y = catenary(static_cast<double>(x), a);
-		const double nextY = y - yAdjust + topOfArch;
-		if (point.first < midPointOfArch){
-			testImage.line(static_cast<int>(midPointOfArch) - x, static_cast<int>(nextY), static_cast<int>(midPointOfArch) - (x - 1), static_cast<int>(yLast), col);
+	const int midX = static_cast<int>(midPointOfArch);
+	const int halfWidth = static_cast<int>(width / 2.0);
+	const int direction = (point.first < midPointOfArch) ? -1 : 1;
+	
+	//Walk from the corbel up to the keystone so each segment is drawn the same way it always was
+	std::vector<std::pair<int, int> > curve(static_cast<size_t>(halfWidth) + 3);
+	curve[0] = point;
+	curve[curve.size() - 1] = std::pair<int, int>(midX - direction, static_cast<int>(topOfArch));
+	for (int x = 0; x <= halfWidth; ++x) {
+		const double y = catenary(static_cast<double>(x), a) - yAdjust + topOfArch;
+		curve[static_cast<size_t>(halfWidth - x) + 1] = std::pair<int, int>(midX + direction * x, static_cast<int>(y));
+	}
+	testImage.polyline(curve, col);
+}
+
+//Splits a sample between two neighboring pixels by how close it is to each (Wu style)
+inline void blendCoverage(uint32_t * first, uint32_t * second, double fraction, uint32_t col){
+	const uint32_t weight = static_cast<uint32_t>(fraction * 256.0 + 0.5);
+	if (first) *first = Image::ColorBetween_fixed(*first, col, 256 - weight);
+	if (second) *second = Image::ColorBetween_fixed(*second, col, weight);
+}
+
+//Anti-aliased version of plot for images that are only looked at.  Samples the catenary once per column where it's
+//shallow and once per row where it's steep, and blends straight into the rows.  Don't use it on images that get
+//searched for the exact curve color
+void plotSmooth(const std::pair<int, int> & point, double midPointOfArch, double topOfArch, Image & img, uint32_t col){
+	assert(point.second > topOfArch);
+
+	const double halfWidth = fabs(midPointOfArch - point.first);
+	const int height = point.second - static_cast<int>(topOfArch);
+	const double a = solveAForWidth(halfWidth * 2.0, height);
+	if (a <= 0.0) return;
+	const double direction = (point.first < midPointOfArch) ? -1.0 : 1.0;
+	const int w = img.width();
+	const int h = img.height();
+	uint32_t * pixels = reinterpret_cast<uint32_t*>(img.data());
+	
+	//Pixel i covers [i, i + 1), so samples are taken at pixel centers.  The slope passes 1 at a * asinh(1).  Heights come
+	//from a * cosh(dx / a) with cosh kept as (e + 1 / e) / 2, e = exp(dx / a), so a step of dx is a multiply
+	const double grow = exp(1.0 / a);
+	const double shrink = 1.0 / grow;
+	const double shallowEnd = std::min(halfWidth, a * asinh(1.0));
+	const double shallowEdge = midPointOfArch + direction * shallowEnd;
+	const int colStart = std::max(0, static_cast<int>(ceil(std::min(midPointOfArch, shallowEdge) - 0.5)));
+	const int colEnd = std::min(w - 1, static_cast<int>(floor(std::max(midPointOfArch, shallowEdge) - 0.5)));
+	
+	//Columns run left to right, so dx grows on the right side and shrinks on the left
+	double e = exp(fabs(static_cast<double>(colStart) + 0.5 - midPointOfArch) / a);
+	double inverse = 1.0 / e;
+	for(int x = colStart; x <= colEnd; ++x){
+		const double y = a * 0.5 * (e + inverse) - a + topOfArch - 0.5;
+		if (direction > 0.0){
+			e *= grow;
+			inverse *= shrink;
 		} else {
-			testImage.line(static_cast<int>(midPointOfArch) + x, static_cast<int>(nextY), static_cast<int>(midPointOfArch) + (x - 1), static_cast<int>(yLast), col);
+			e *= shrink;
+			inverse *= grow;
 		}
-		yLast = y - yAdjust + topOfArch;
-    }
+		const int row = static_cast<int>(floor(y));
+		if (row < -1 || row >= h) continue;
+		uint32_t * top = (row >= 0) ? pixels + static_cast<size_t>(row) * static_cast<size_t>(w) + static_cast<size_t>(x) : nullptr;
+		uint32_t * below = (row + 1 < h) ? pixels + static_cast<size_t>(row + 1) * static_cast<size_t>(w) + static_cast<size_t>(x) : nullptr;
+		blendCoverage(top, below, y - floor(y), col);
+	}
 	
-	if (point.first < midPointOfArch){
-		testImage.line(point.first, point.second, static_cast<int>(midPointOfArch) - (static_cast<int>(width / 2.0)), static_cast<int>(yLast), col);
-	} else {
-		testImage.line(point.first, point.second, static_cast<int>(midPointOfArch) + (static_cast<int>(width / 2.0)), static_cast<int>(yLast), col);
+	if (shallowEnd >= halfWidth) return;
+	const double steepStart = a * cosh(shallowEnd / a) - a + topOfArch;
+	const double steepEnd = a * cosh(halfWidth / a) - a + topOfArch;
+	const int rowStart = std::max(0, static_cast<int>(ceil(steepStart - 0.5)));
+	const int rowEnd = std::min(h - 1, static_cast<int>(floor(steepEnd - 0.5)));
+	
+	//Past 45 degrees each row is solved for dx between the heights at whole dx either side of it.  The curve bends away
+	//from that chord by at most 0.18 / a of a pixel across, far below the 1/256 steps of coverage for any real arch
+	double dx = floor(shallowEnd);
+	e = exp(dx / a);
+	inverse = 1.0 / e;
+	double lower = a * 0.5 * (e + inverse) - a + topOfArch;
+	e *= grow;
+	inverse *= shrink;
+	double upper = a * 0.5 * (e + inverse) - a + topOfArch;
+	for(int y = rowStart; y <= rowEnd; ++y){
+		const double center = static_cast<double>(y) + 0.5;
+		while(upper < center){
+			dx += 1.0;
+			lower = upper;
+			e *= grow;
+			inverse *= shrink;
+			upper = a * 0.5 * (e + inverse) - a + topOfArch;
+		}
+		const double x = midPointOfArch + direction * (dx + (center - lower) / (upper - lower)) - 0.5;
+		const int column = static_cast<int>(floor(x));
+		if (column < -1 || column >= w) continue;
+		uint32_t * row = pixels + static_cast<size_t>(y) * static_cast<size_t>(w);
+		blendCoverage((column >= 0) ? row + column : nullptr, (column + 1 < w) ? row + column + 1 : nullptr, x - floor(x), col);
 	}
 }
 
@@ -131,7 +243,7 @@ void fixVector(std::vector<std::pair<int, int> > & arches, double midPointOfArch
 
 
 
-int showErrors(Image original, const std::string & output){
+int showErrors(Image original, const std::string & output, Image::PngPreset preset = Image::PngPreset::Default){
 	Image copy(original);
 	std::vector<std::pair<int, int> > arches = getAllArches(original);
 	if (arches.size() < 4){
@@ -153,8 +265,10 @@ int showErrors(Image original, const std::string & output){
 	const double slope = deltaX / deltaY;
 	fixVector(arches, midPointOfArch_Bottom, bottomOfArch, slope);
 	
-	copy.rect_fill_x2_and_y2(0, arches[0].second, arches[0].first, arches[0].second + 100, Image::Color(255, 0, 255));
-	copy.rect_fill_x2_and_y2(copy.width(), arches[1].second, arches[1].first, arches[1].second + 100, Image::Color(255, 0, 255));
+	//The overlay is recorded and drawn onto copy in one pass once everything is known
+	DrawList overlay;
+	overlay.rect_fill_x2_and_y2(0, arches[0].second, arches[0].first, arches[0].second + 100, Image::Color(255, 0, 255));
+	overlay.rect_fill_x2_and_y2(copy.width(), arches[1].second, arches[1].first, arches[1].second + 100, Image::Color(255, 0, 255));
 	
 	double errorTotal = 0;
 	int errorCount = 0;
@@ -165,7 +279,7 @@ int showErrors(Image original, const std::string & output){
 		DEBUG_PLOT_MSG("Plotting " << arches[i].first << ", " << arches[i].second);
 		const int midForNextCorbel = getMidPointAtHeight(arches[i].second, midPointOfArch_Bottom, bottomOfArch, slope);
 		plot(arches[i], midForNextCorbel, topOfArch, testImage, Image::Color(255, 0, 0));
-		plot(arches[i], midForNextCorbel, topOfArch, original, Image::Color(255, 0, 0));
+		plotSmooth(arches[i], midForNextCorbel, topOfArch, original, Image::Color(255, 0, 0));
 
 		//Since the corbels will go back and forth, the next corbel is actually +2
 		int xSearch = arches[i + 2].first;
@@ -211,11 +325,11 @@ int showErrors(Image original, const std::string & output){
 		errorTotal += stress;
 		++errorCount;
 		if (arches[i].first < midForNextCorbel){
-			copy.rect_fill_x2_and_y2(xPos, arches[i].second, 0, yPos, color);
-			font.write(sss.str(), copy, 1, yPos);
+			overlay.rect_fill_x2_and_y2(xPos, arches[i].second, 0, yPos, color);
+			font().write(sss.str(), overlay, 1, yPos);
 		} else {
-			copy.rect_fill_x2_and_y2(xPos, arches[i].second, copy.width(), yPos, color);
-			font.write(sss.str(), copy, copy.width() - 30, yPos);
+			overlay.rect_fill_x2_and_y2(xPos, arches[i].second, copy.width(), yPos, color);
+			font().write(sss.str(), overlay, copy.width() - 30, yPos);
 		}
 		
 	
@@ -225,15 +339,16 @@ int showErrors(Image original, const std::string & output){
 	//Draw the midpoint, see if it's leaning
 	for(int yy = static_cast<int>(bottomOfArch); yy >= static_cast<int>(topOfArch); --yy){
 		const int xx = getMidPointAtHeight(yy, midPointOfArch_Bottom, bottomOfArch, slope);
-		copy.pset(xx, yy, Image::Color(0, 0, 64));
+		overlay.pset(xx, yy, Image::Color(0, 0, 64));
 	}
+	overlay.render(copy, std::thread::hardware_concurrency());
 	
 	
-	plot(arches[0], midPointOfArch_Bottom, topOfArch, copy, Image::Color(255, 255, 0));
-	plot(arches[1], midPointOfArch_Bottom, topOfArch, copy, Image::Color(255, 255, 0));
-	Image result = Image(original.width() * 2, original.height() + 100, Image::Color(0,0,0));
-	result.put(copy, 0, 100);
-	result.put(original, original.width(), 100);
+	plotSmooth(arches[0], midPointOfArch_Bottom, topOfArch, copy, Image::Color(255, 255, 0));
+	plotSmooth(arches[1], midPointOfArch_Bottom, topOfArch, copy, Image::Color(255, 255, 0));
+	//The report is the text across the top, then copy and original side by side.  Only the text gets an image of its own,
+	//the rest is put together a row at a time as it's written out, or for Smallest before it's saved
+	Image header = Image(original.width() * 2, 100, Image::Color(0,0,0));
 	
 	std::stringstream sss;
 	const int ss = static_cast<int>((100.0f * errorTotal) / static_cast<double>(errorCount));
@@ -253,14 +368,39 @@ int showErrors(Image original, const std::string & output){
 	} else {
 		sss << "Lean: 0%" << std::endl;
 	}
-	bigfont.write(sss.str(), result, 0, 0);
+	bigfont().write(sss.str(), header, 0, 0);
 	
-	result.save(output);
-	return 0;
+	//The report keeps the input's alpha, it goes out as RGB unless the input has some.  What's drawn on copy only ever
+	//makes its pixels more opaque, so original is the one to look at
+	bool opaque = true;
+	const uint32_t * pixels = reinterpret_cast<const uint32_t*>(original.data());
+	const size_t pixelCount = static_cast<size_t>(original.width()) * static_cast<size_t>(original.height());
+	for(size_t i = 0; i < pixelCount && opaque; ++i) opaque = Image::Alpha(pixels[i]) == 255;
+	const size_t rowBytes = static_cast<size_t>(original.width()) * 4;
+	const int height = original.height() + 100;
+	auto reportRow = [&](int y, uint32_t * row, int width){
+		if (y < 100){
+			memcpy(row, header.data() + static_cast<size_t>(y) * rowBytes * 2, rowBytes * 2);
+		} else {
+			const size_t offset = static_cast<size_t>(y - 100) * rowBytes;
+			memcpy(row, copy.data() + offset, rowBytes);
+			memcpy(row + width / 2, original.data() + offset, rowBytes);
+		}
+		return true;
+	};
+	//Smallest still gets lodepng's palette search, which needs the whole report in memory
+	if (preset == Image::PngPreset::Smallest){
+		Image result(header.width(), height, true);
+		for(int y = 0; y < height; ++y) reportRow(y, &result.point_unsafe(0, y), result.width());
+		return result.save(output, preset, Image::PngColor::Detect) ? 0 : 1;
+	}
+	return Image::SaveRows(output, header.width(), height, reportRow, preset, opaque ? Image::PngColor::RGB : Image::PngColor::RGBA) ? 0 : 1;
 }
 
 
 
+//Checks/plotbench includes this file for plot and plotSmooth, without main
+#ifndef STRESSCALC_NO_MAIN
 int main(int argc, char ** argv){
 	if (argc < 2){
 		std::cerr << "No parameters specified" << std::endl;
@@ -268,10 +408,13 @@ int main(int argc, char ** argv){
 	}
 	
 	std::vector<std::string> files;
+	Image::PngPreset preset = Image::PngPreset::Default;
 	for(int i = 1; i < argc; ++i){
 		std::string filename = argv[i];
 		DEBUG_PLOT_MSG("Parameter " << i << ": " << filename);
-		if (std::filesystem::is_directory(filename)){
+		if (filename.compare(0, 6, "--png=") == 0){  //--png=default, fastest, balanced or smallest
+			if (!Image::ParsePngPreset(filename.substr(6), preset)) return 255;
+		} else if (std::filesystem::is_directory(filename)){
 			std::vector<std::string> thisfolder = Shell::getFilesInDir(filename, 0);
 			for(auto & f : thisfolder){
 				std::string ext = Shell::fileExtension(f);
@@ -295,7 +438,7 @@ int main(int argc, char ** argv){
 		Shell::mkdir(dirname);
 		const std::string output = Shell::windowizePaths(dirname + "\\" + Shell::filename(filename));
 		DEBUG_PLOT_MSG("Output: " << output);
-		int result = showErrors(Image(filename), output);
+		int result = showErrors(Image(filename), output, preset);
 		if (result){
 			std::cerr << "Error code " << result << std::endl;
 		} else {
@@ -305,3 +448,4 @@ int main(int argc, char ** argv){
 	
 	return 0;
 }
+#endif